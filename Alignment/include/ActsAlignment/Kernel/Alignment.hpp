@@ -17,9 +17,11 @@
 #include "Acts/TrackFitting/detail/KalmanGlobalCovariance.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "ActsAlignment/Kernel/AlignmentError.hpp"
 #include "ActsAlignment/Kernel/detail/AlignmentEngine.hpp"
+#include "ActsAlignment/Kernel/detail/AlignmentSolver.hpp"
 
 #include <limits>
 #include <map>
@@ -30,6 +32,8 @@ namespace ActsAlignment {
 using AlignedTransformUpdater =
     std::function<bool(Acts::DetectorElementBase*, const Acts::GeometryContext&,
                        const Acts::Transform3&)>;
+using AlignedTransformsCommitter =
+    std::function<void(const Acts::GeometryContext&)>;
 ///
 /// @brief Options for align() call
 ///
@@ -71,6 +75,10 @@ struct AlignmentOptions {
   /// The updater to the aligned transform
   AlignedTransformUpdater alignedTransformUpdater = nullptr;
 
+  /// Called once per iteration after the aligned transforms of all detector
+  /// elements were updated, e.g. to publish them together. Optional.
+  AlignedTransformsCommitter alignedTransformsCommitter = nullptr;
+
   // The detector elements to be aligned
   std::vector<Acts::DetectorElementBase*> alignedDetElements;
 
@@ -86,6 +94,15 @@ struct AlignmentOptions {
 
   // The alignment mask for different iterations
   std::map<unsigned int, AlignmentMask> iterationState;
+
+  // The method to solve for the alignment parameters. The sparse solvers do
+  // not provide the alignment covariance.
+  AlignmentSolver solver = AlignmentSolver::Dense;
+
+  // The executor for fitting the trajectories concurrently, they are fitted
+  // sequentially if empty. The fitter and the fit options extensions need to
+  // be thread-safe if the executor runs tasks concurrently.
+  Acts::ParallelExecutor executor = {};
 };
 
 /// @brief Alignment result struct
@@ -98,7 +115,7 @@ struct AlignmentResult {
   std::unordered_map<Acts::DetectorElementBase*, Acts::Transform3>
       alignedParameters;
 
-  // The covariance of alignment parameters
+  // The covariance of alignment parameters (only for the dense solver)
   Acts::ActsDynamicMatrix alignmentCovariance;
 
   // The average chi2/ndf (ndf is the measurement dim)
@@ -180,13 +197,19 @@ struct Alignment {
   /// @param fitOptions The fit Options steering the fit
   /// @param alignResult [in, out] The aligned result
   /// @param alignMask The alignment mask (same for all measurements now)
+  /// @param solver The method to solve for the alignment parameters
+  /// @param executor The executor for fitting the trajectories concurrently
+  ///
+  /// @return an error if the alignment parameters could not be solved for
   template <typename trajectory_container_t,
             typename start_parameters_container_t, typename fit_options_t>
-  void calculateAlignmentParameters(
+  Acts::Result<void> calculateAlignmentParameters(
       const trajectory_container_t& trajectoryCollection,
       const start_parameters_container_t& startParametersCollection,
       const fit_options_t& fitOptions, AlignmentResult& alignResult,
-      const AlignmentMask& alignMask = AlignmentMask::All) const;
+      const AlignmentMask& alignMask = AlignmentMask::All,
+      AlignmentSolver solver = AlignmentSolver::Dense,
+      const Acts::ParallelExecutor& executor = {}) const;
 
   /// @brief update the detector element alignment parameters
   ///
@@ -194,11 +217,15 @@ struct Alignment {
   /// @param alignedDetElements The detector elements to be aligned
   /// @param alignedTransformUpdater The updater for updating the aligned
   /// @param alignResult [in, out] The aligned result
+  /// @param alignedTransformsCommitter The optional committer called once
+  /// all detector elements are updated
   Acts::Result<void> updateAlignmentParameters(
       const Acts::GeometryContext& gctx,
       const std::vector<Acts::DetectorElementBase*>& alignedDetElements,
       const AlignedTransformUpdater& alignedTransformUpdater,
-      AlignmentResult& alignResult) const;
+      AlignmentResult& alignResult,
+      const AlignedTransformsCommitter& alignedTransformsCommitter =
+          nullptr) const;
 
   /// @brief Alignment implementation
   ///
@@ -9,6 +9,8 @@
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
 
+#include <algorithm>
+
 template <typename fitter_t>
 template <typename source_link_t, typename start_parameters_t,
           typename fit_options_t>
@@ -54,12 +56,15 @@ ActsAlignment::Alignment<fitter_t>::evaluateTrackAlignmentState(
 template <typename fitter_t>
 template <typename trajectory_container_t,
           typename start_parameters_container_t, typename fit_options_t>
-void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
+Acts::Result<void>
+ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
     const trajectory_container_t& trajectoryCollection,
     const start_parameters_container_t& startParametersCollection,
     const fit_options_t& fitOptions,
     ActsAlignment::AlignmentResult& alignResult,
-    const ActsAlignment::AlignmentMask& alignMask) const {
+    const ActsAlignment::AlignmentMask& alignMask,
+    ActsAlignment::AlignmentSolver solver,
+    const Acts::ParallelExecutor& executor) const {
   // The number of trajectories must be equal to the number of starting
   // parameters
   assert(trajectoryCollection.size() == startParametersCollection.size());
@@ -67,63 +72,79 @@ void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
   // The total alignment degree of freedom
   alignResult.alignmentDof =
       alignResult.idxedAlignSurfaces.size() * Acts::eAlignmentSize;
-  // Initialize derivative of chi2 w.r.t. alignment parameters for all tracks
-  Acts::ActsDynamicVector sumChi2Derivative =
-      Acts::ActsDynamicVector::Zero(alignResult.alignmentDof);
-  Acts::ActsDynamicMatrix sumChi2SecondDerivative =
-      Acts::ActsDynamicMatrix::Zero(alignResult.alignmentDof,
-                                    alignResult.alignmentDof);
-  // Copy the fit options
-  fit_options_t fitOptionsWithRefSurface = fitOptions;
   // Calculate contribution to chi2 derivatives from all input trajectories
   // @Todo: How to update the source link error iteratively?
-  alignResult.chi2 = 0;
-  alignResult.measurementDim = 0;
   alignResult.numTracks = trajectoryCollection.size();
-  double sumChi2ONdf = 0;
-  for (unsigned int iTraj = 0; iTraj < trajectoryCollection.size(); iTraj++) {
-    const auto& sourcelinks = trajectoryCollection.at(iTraj);
-    const auto& sParameters = startParametersCollection.at(iTraj);
-    // Set the target surface
-    fitOptionsWithRefSurface.referenceSurface = &sParameters.referenceSurface();
-    // The result for one single track
-    auto evaluateRes = evaluateTrackAlignmentState(
-        fitOptions.geoContext, sourcelinks, sParameters,
-        fitOptionsWithRefSurface, alignResult.idxedAlignSurfaces, alignMask);
-    if (!evaluateRes.ok()) {
-      ACTS_DEBUG("Evaluation of alignment state for track " << iTraj
-                                                            << " failed");
-      continue;
-    }
-    const auto& alignState = evaluateRes.value();
-    for (const auto& [rowSurface, rows] : alignState.alignedSurfaces) {
-      const auto& [dstRow, srcRow] = rows;
-      // Fill the results into full chi2 derivative matrix
-      sumChi2Derivative.segment<Acts::eAlignmentSize>(dstRow *
-                                                      Acts::eAlignmentSize) +=
-          alignState.alignmentToChi2Derivative.segment(
-              srcRow * Acts::eAlignmentSize, Acts::eAlignmentSize);
-
-      for (const auto& [colSurface, cols] : alignState.alignedSurfaces) {
-        const auto& [dstCol, srcCol] = cols;
-        sumChi2SecondDerivative
-            .block<Acts::eAlignmentSize, Acts::eAlignmentSize>(
-                dstRow * Acts::eAlignmentSize, dstCol * Acts::eAlignmentSize) +=
-            alignState.alignmentToChi2SecondDerivative.block(
-                srcRow * Acts::eAlignmentSize, srcCol * Acts::eAlignmentSize,
-                Acts::eAlignmentSize, Acts::eAlignmentSize);
+
+  // The trajectories are split into blocks, each of which accumulates its
+  // chi2 derivatives independently. The partial sums are merged afterwards.
+  // The number of blocks is fixed, so that the result does not depend on the
+  // executor, and limited, as every block holds the full derivatives.
+  constexpr std::size_t maxBlocks = 16;
+  const std::size_t nBlocks = std::max<std::size_t>(
+      1, std::min(maxBlocks, trajectoryCollection.size()));
+  std::vector<detail::Chi2DerivativeAccumulator> partialSums(
+      nBlocks,
+      detail::Chi2DerivativeAccumulator(alignResult.idxedAlignSurfaces.size()));
+
+  Acts::executeTasks(executor, nBlocks, [&](std::size_t iBlock) {
+    // Copy the fit options
+    fit_options_t fitOptionsWithRefSurface = fitOptions;
+    for (std::size_t iTraj = iBlock; iTraj < trajectoryCollection.size();
+         iTraj += nBlocks) {
+      const auto& sourcelinks = trajectoryCollection.at(iTraj);
+      const auto& sParameters = startParametersCollection.at(iTraj);
+      // Set the target surface
+      fitOptionsWithRefSurface.referenceSurface =
+          &sParameters.referenceSurface();
+      // The result for one single track
+      auto evaluateRes = evaluateTrackAlignmentState(
+          fitOptions.geoContext, sourcelinks, sParameters,
+          fitOptionsWithRefSurface, alignResult.idxedAlignSurfaces, alignMask);
+      if (!evaluateRes.ok()) {
+        ACTS_DEBUG("Evaluation of alignment state for track " << iTraj
+                                                              << " failed");
+        continue;
       }
+      partialSums[iBlock].add(evaluateRes.value());
+    }
+  });
+
+  for (std::size_t iBlock = 1; iBlock < nBlocks; ++iBlock) {
+    partialSums.front().merge(partialSums[iBlock]);
+  }
+
+  const auto& sum = partialSums.front();
+  const Acts::ActsDynamicVector& sumChi2Derivative = sum.chi2Derivative();
+  alignResult.chi2 = sum.chi2;
+  alignResult.measurementDim = sum.measurementDim;
+  alignResult.averageChi2ONdf = sum.sumChi2ONdf / alignResult.numTracks;
+
+  std::size_t alignDof = alignResult.alignmentDof;
+
+  if (solver != AlignmentSolver::Dense) {
+    // Solve the sparse linear equation, the covariance is not available as
+    // the inverse would be dense
+    auto delta = detail::solveSparse(sum.sparseChi2SecondDerivative(),
+                                     sumChi2Derivative, solver);
+    if (!delta.has_value()) {
+      ACTS_ERROR("Solving for the alignment parameters failed");
+      return AlignmentError::AlignmentParametersUpdateFailure;
     }
-    alignResult.chi2 += alignState.chi2;
-    alignResult.measurementDim += alignState.measurementDim;
-    sumChi2ONdf += alignState.chi2 / alignState.measurementDim;
+    alignResult.deltaAlignmentParameters = std::move(*delta);
+    alignResult.alignmentCovariance = Acts::ActsDynamicMatrix();
+    // chi2 change
+    alignResult.deltaChi2 = 0.5 * sumChi2Derivative.transpose() *
+                            alignResult.deltaAlignmentParameters;
+    return Acts::Result<void>::success();
   }
-  alignResult.averageChi2ONdf = sumChi2ONdf / alignResult.numTracks;
+
+  const Acts::ActsDynamicMatrix sumChi2SecondDerivative =
+      sum.denseChi2SecondDerivative();
 
   // Get the inverse of chi2 second derivative matrix (we need this to
   // calculate the covariance of the alignment parameters)
   // @Todo: use more stable method for solving the inverse
-  std::size_t alignDof = alignResult.alignmentDof;
   Acts::ActsDynamicMatrix sumChi2SecondDerivativeInverse =
       Acts::ActsDynamicMatrix::Zero(alignDof, alignDof);
   sumChi2SecondDerivativeInverse = sumChi2SecondDerivative.inverse();
@@ -149,6 +170,8 @@ void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
   // chi2 change
   alignResult.deltaChi2 = 0.5 * sumChi2Derivative.transpose() *
                           alignResult.deltaAlignmentParameters;
+
+  return Acts::Result<void>::success();
 }
 
 template <typename fitter_t>
@@ -157,7 +180,9 @@ ActsAlignment::Alignment<fitter_t>::updateAlignmentParameters(
     const Acts::GeometryContext& gctx,
     const std::vector<Acts::DetectorElementBase*>& alignedDetElements,
     const ActsAlignment::AlignedTransformUpdater& alignedTransformUpdater,
-    ActsAlignment::AlignmentResult& alignResult) const {
+    ActsAlignment::AlignmentResult& alignResult,
+    const ActsAlignment::AlignedTransformsCommitter& alignedTransformsCommitter)
+    const {
   // Update the aligned transform
   Acts::AlignmentVector deltaAlignmentParam = Acts::AlignmentVector::Zero();
   for (const auto& [surface, index] : alignResult.idxedAlignSurfaces) {
@@ -207,6 +232,11 @@ ActsAlignment::Alignment<fitter_t>::updateAlignmentParameters(
     }
   }
 
+  // Commit the updates of all detector elements together
+  if (alignedTransformsCommitter) {
+    alignedTransformsCommitter(gctx);
+  }
+
   return Acts::Result<void>::success();
 }
 
@@ -246,9 +276,15 @@ ActsAlignment::Alignment<fitter_t>::align(
       alignMask = iter_it->second;
     }
     // Calculate the alignment parameters delta etc.
-    calculateAlignmentParameters(
+    auto calculateRes = calculateAlignmentParameters(
         trajectoryCollection, startParametersCollection,
-        alignOptions.fitOptions, alignResult, alignMask);
+        alignOptions.fitOptions, alignResult, alignMask, alignOptions.solver,
+        alignOptions.executor);
+    if (!calculateRes.ok()) {
+      ACTS_ERROR("Calculation of alignment parameters failed: "
+                 << calculateRes.error());
+      return calculateRes.error();
+    }
     // Screen out the information
     ACTS_INFO("iIter = " << iIter << ", total chi2 = " << alignResult.chi2
                          << ", total measurementDim = "
@@ -289,7 +325,8 @@ ActsAlignment::Alignment<fitter_t>::align(
     // Not coveraged yet, update the detector element alignment parameters
     auto updateRes = updateAlignmentParameters(
         alignOptions.fitOptions.geoContext, alignOptions.alignedDetElements,
-        alignOptions.alignedTransformUpdater, alignResult);
+        alignOptions.alignedTransformUpdater, alignResult,
+        alignOptions.alignedTransformsCommitter);
     if (!updateRes.ok()) {
       ACTS_ERROR("Update alignment parameters failed: " << updateRes.error());
       return updateRes.error();
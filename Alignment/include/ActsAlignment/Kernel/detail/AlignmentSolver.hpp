@@ -0,0 +1,105 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Alignment.hpp"
+#include "Acts/Definitions/Algebra.hpp"
+#include "ActsAlignment/Kernel/detail/AlignmentEngine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+#include <Eigen/SparseCore>
+
+namespace ActsAlignment {
+
+/// The method used to solve the alignment equation
+enum class AlignmentSolver {
+  /// Dense LU decomposition with full covariance, only feasible for a small
+  /// number of alignable detector elements
+  Dense,
+  /// Sparse Cholesky (LDLT) decomposition, no covariance is provided
+  SparseLDLT,
+  /// Conjugate gradients on the sparse matrix, no covariance is provided
+  ConjugateGradient,
+};
+
+namespace detail {
+
+/// @brief Accumulates the chi2 derivatives of many tracks
+///
+/// A track only contributes to the blocks of the chi2 second derivative that
+/// belong to pairs of surfaces it has crossed. The second derivative is
+/// therefore stored block-sparse by surface pair, which allows alignment of
+/// a full detector where the dense matrix does not fit into memory.
+///
+/// Independent accumulators can be filled concurrently and merged
+/// afterwards.
+class Chi2DerivativeAccumulator {
+ public:
+  using SparseMatrix = Eigen::SparseMatrix<ActsScalar>;
+
+  /// @param nSurfaces The number of alignable surfaces
+  explicit Chi2DerivativeAccumulator(std::size_t nSurfaces);
+
+  /// Add the contribution of a single track
+  ///
+  /// @param alignState The alignment state of the track
+  void add(const TrackAlignmentState& alignState);
+
+  /// Add the contributions of another accumulator
+  ///
+  /// @param other The accumulator to be merged into this one
+  void merge(const Chi2DerivativeAccumulator& other);
+
+  /// The number of alignment degrees of freedom
+  std::size_t alignmentDof() const { return m_nSurfaces * eAlignmentSize; }
+
+  /// The summed first derivative of the chi2
+  const ActsDynamicVector& chi2Derivative() const { return m_chi2Derivative; }
+
+  /// The summed second derivative of the chi2 as dense matrix
+  ActsDynamicMatrix denseChi2SecondDerivative() const;
+
+  /// The summed second derivative of the chi2 as sparse matrix
+  SparseMatrix sparseChi2SecondDerivative() const;
+
+  /// The summed chi2
+  double chi2 = 0;
+  /// The summed measurement dimension
+  std::size_t measurementDim = 0;
+  /// The summed chi2/ndf of the single tracks
+  double sumChi2ONdf = 0;
+
+ private:
+  std::size_t m_nSurfaces;
+  ActsDynamicVector m_chi2Derivative;
+  // Blocks of the second derivative, keyed by row * nSurfaces + column
+  std::unordered_map<std::uint64_t, AlignmentMatrix> m_blocks;
+};
+
+/// Solve the alignment equation H * delta = -g with a sparse solver
+///
+/// Degrees of freedom without any contribution, e.g. because they are masked,
+/// are fixed to zero.
+///
+/// @param chi2SecondDerivative The chi2 second derivative H
+/// @param chi2Derivative The chi2 derivative g
+/// @param solver The sparse solver to be used
+///
+/// @return The change of the alignment parameters or nothing if the solver
+/// did not succeed
+std::optional<ActsDynamicVector> solveSparse(
+    Chi2DerivativeAccumulator::SparseMatrix chi2SecondDerivative,
+    const ActsDynamicVector& chi2Derivative, AlignmentSolver solver);
+
+}  // namespace detail
+}  // namespace ActsAlignment
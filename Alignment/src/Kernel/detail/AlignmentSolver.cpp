@@ -0,0 +1,140 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsAlignment/Kernel/detail/AlignmentSolver.hpp"
+
+#include <cassert>
+#include <vector>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+
+namespace ActsAlignment {
+namespace detail {
+
+Chi2DerivativeAccumulator::Chi2DerivativeAccumulator(std::size_t nSurfaces)
+    : m_nSurfaces(nSurfaces),
+      m_chi2Derivative(ActsDynamicVector::Zero(nSurfaces * eAlignmentSize)) {}
+
+void Chi2DerivativeAccumulator::add(const TrackAlignmentState& alignState) {
+  for (const auto& [rowSurface, rows] : alignState.alignedSurfaces) {
+    const auto& [dstRow, srcRow] = rows;
+    // Fill the results into full chi2 derivative
+    m_chi2Derivative.segment<eAlignmentSize>(dstRow * eAlignmentSize) +=
+        alignState.alignmentToChi2Derivative.segment<eAlignmentSize>(
+            srcRow * eAlignmentSize);
+
+    for (const auto& [colSurface, cols] : alignState.alignedSurfaces) {
+      const auto& [dstCol, srcCol] = cols;
+      auto [it, inserted] = m_blocks.try_emplace(
+          dstRow * m_nSurfaces + dstCol, AlignmentMatrix::Zero());
+      it->second += alignState.alignmentToChi2SecondDerivative
+                        .block<eAlignmentSize, eAlignmentSize>(
+                            srcRow * eAlignmentSize, srcCol * eAlignmentSize);
+    }
+  }
+  chi2 += alignState.chi2;
+  measurementDim += alignState.measurementDim;
+  sumChi2ONdf += alignState.chi2 / alignState.measurementDim;
+}
+
+void Chi2DerivativeAccumulator::merge(const Chi2DerivativeAccumulator& other) {
+  assert(m_nSurfaces == other.m_nSurfaces);
+
+  m_chi2Derivative += other.m_chi2Derivative;
+  for (const auto& [key, block] : other.m_blocks) {
+    auto [it, inserted] = m_blocks.try_emplace(key, block);
+    if (!inserted) {
+      it->second += block;
+    }
+  }
+  chi2 += other.chi2;
+  measurementDim += other.measurementDim;
+  sumChi2ONdf += other.sumChi2ONdf;
+}
+
+ActsDynamicMatrix Chi2DerivativeAccumulator::denseChi2SecondDerivative()
+    const {
+  ActsDynamicMatrix matrix =
+      ActsDynamicMatrix::Zero(alignmentDof(), alignmentDof());
+  for (const auto& [key, block] : m_blocks) {
+    const std::size_t row = key / m_nSurfaces;
+    const std::size_t col = key % m_nSurfaces;
+    matrix.block<eAlignmentSize, eAlignmentSize>(row * eAlignmentSize,
+                                                 col * eAlignmentSize) = block;
+  }
+  return matrix;
+}
+
+Chi2DerivativeAccumulator::SparseMatrix
+Chi2DerivativeAccumulator::sparseChi2SecondDerivative() const {
+  std::vector<Eigen::Triplet<ActsScalar>> triplets;
+  triplets.reserve(m_blocks.size() * eAlignmentSize * eAlignmentSize);
+  for (const auto& [key, block] : m_blocks) {
+    const std::size_t row = key / m_nSurfaces;
+    const std::size_t col = key % m_nSurfaces;
+    for (unsigned int i = 0; i < eAlignmentSize; ++i) {
+      for (unsigned int j = 0; j < eAlignmentSize; ++j) {
+        if (block(i, j) != 0) {
+          triplets.emplace_back(row * eAlignmentSize + i,
+                                col * eAlignmentSize + j, block(i, j));
+        }
+      }
+    }
+  }
+
+  SparseMatrix matrix(alignmentDof(), alignmentDof());
+  matrix.setFromTriplets(triplets.begin(), triplets.end());
+  return matrix;
+}
+
+std::optional<ActsDynamicVector> solveSparse(
+    Chi2DerivativeAccumulator::SparseMatrix chi2SecondDerivative,
+    const ActsDynamicVector& chi2Derivative, AlignmentSolver solver) {
+  using SparseMatrix = Chi2DerivativeAccumulator::SparseMatrix;
+
+  // Degrees of freedom that are not constrained by any track would make the
+  // matrix singular, decouple them with a unit diagonal. Their derivative is
+  // zero, so their change is zero as well.
+  const Eigen::Index dof = chi2SecondDerivative.rows();
+  ActsDynamicVector diagonal = chi2SecondDerivative.diagonal();
+  std::vector<Eigen::Triplet<ActsScalar>> unconstrained;
+  for (Eigen::Index i = 0; i < dof; ++i) {
+    if (diagonal[i] == 0) {
+      unconstrained.emplace_back(i, i, 1);
+    }
+  }
+  if (!unconstrained.empty()) {
+    SparseMatrix identity(dof, dof);
+    identity.setFromTriplets(unconstrained.begin(), unconstrained.end());
+    chi2SecondDerivative += identity;
+  }
+
+  if (solver == AlignmentSolver::SparseLDLT) {
+    Eigen::SimplicialLDLT<SparseMatrix> ldlt(chi2SecondDerivative);
+    if (ldlt.info() != Eigen::Success) {
+      return std::nullopt;
+    }
+    ActsDynamicVector delta = -ldlt.solve(chi2Derivative);
+    if (ldlt.info() != Eigen::Success) {
+      return std::nullopt;
+    }
+    return delta;
+  }
+
+  Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower | Eigen::Upper> cg(
+      chi2SecondDerivative);
+  ActsDynamicVector delta = -cg.solve(chi2Derivative);
+  if (cg.info() != Eigen::Success) {
+    return std::nullopt;
+  }
+  return delta;
+}
+
+}  // namespace detail
+}  // namespace ActsAlignment
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -93,6 +95,59 @@ template <typename CellCollection, typename ClusterCollection,
 ClusterCollection createClusters(CellCollection& cells,
                                  Connect connect = Connect());
 
+/// @brief Reusable scratch memory for the row scan clusterization
+///
+/// Keeping one buffer per thread avoids reallocating the label image and
+/// the label equivalence table for every module.
+class RowScanBuffer {
+ public:
+  /// The label image over the bounding box of the cells, zero if empty
+  std::vector<Label> image;
+  /// The parent of each provisional label, the roots point to themselves
+  std::vector<Label> parent;
+  /// The consecutive label of each provisional label
+  std::vector<Label> resolved;
+  /// The pixel hash table for sparse cells: keys and provisional labels
+  std::vector<std::uint64_t> keys;
+  std::vector<Label> slots;
+  /// The hash table slot of each cell
+  std::vector<std::size_t> cellSlots;
+};
+
+/// @brief labelClustersRowScan
+///
+/// Sort-free connected component labelling on a 2-D grid. The cells are
+/// written into a dense label image spanning their bounding box, which is
+/// then scanned row by row in two passes: the first pass assigns
+/// provisional labels and records equivalences with the already scanned
+/// neighbours, the second pass resolves them. The resulting labels are
+/// consecutive, starting from 1, and the order of the cells is kept.
+///
+/// If the bounding box is much larger than the number of cells the label
+/// image would be mostly empty, in that case the occupied pixels are looked
+/// up in a hash table instead.
+///
+/// The `Cell` type must have the functions required by @c labelClusters.
+///
+/// @param [in] cells the cell collection to be labeled
+/// @param [in] commonCorner use 8-cell instead of 4-cell connectivity
+/// @param [in] buffer the scratch memory, reused between calls
+///
+/// @return the number of clusters
+template <typename CellCollection>
+std::size_t labelClustersRowScan(CellCollection& cells, bool commonCorner,
+                                 RowScanBuffer& buffer);
+
+/// @brief createClustersRowScan
+///
+/// Convenience function which runs @c labelClustersRowScan and merges the
+/// cells into clusters without sorting them. The clusters are ordered by
+/// their label, the cells within a cluster keep their input order.
+template <typename CellCollection, typename ClusterCollection>
+ClusterCollection createClustersRowScan(CellCollection& cells,
+                                        bool commonCorner,
+                                        RowScanBuffer& buffer);
+
 }  // namespace Acts::Ccl
 
 #include "Acts/Clusterization/Clusterization.ipp"
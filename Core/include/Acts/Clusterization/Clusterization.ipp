@@ -6,7 +6,11 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 #include <boost/pending/disjoint_sets.hpp>
@@ -209,6 +213,121 @@ ClusterCollection mergeClustersImpl(CellCollection& cells) {
   return outv;
 }
 
+// The row scan label image may have at most this many pixels per cell,
+// otherwise the occupied pixels are looked up in a hash table
+constexpr std::size_t s_rowScanMaxAreaPerCell = 16;
+
+// Find the root of a provisional label, halving the path on the way
+inline Label findRoot(std::vector<Label>& parent, Label x) {
+  while (parent[x] != x) {
+    parent[x] = parent[parent[x]];
+    x = parent[x];
+  }
+  return x;
+}
+
+// Merge the sets of two provisional labels, the smaller root is kept so a
+// root is always the smallest label of its set
+inline Label unite(std::vector<Label>& parent, Label a, Label b) {
+  a = findRoot(parent, a);
+  b = findRoot(parent, b);
+  if (a < b) {
+    parent[b] = a;
+    return a;
+  }
+  parent[a] = b;
+  return b;
+}
+
+// Assign consecutive labels to the sets of provisional labels, in the order
+// of their roots. A root is the smallest label of its set and therefore
+// resolved before the other members. The provisional label of each cell is
+// given by the @p provisional function of the cell and its index.
+template <typename CellCollection, typename provisional_t>
+std::size_t resolveLabels(CellCollection& cells, RowScanBuffer& buffer,
+                          const provisional_t& provisional) {
+  std::vector<Label>& parent = buffer.parent;
+  std::vector<Label>& resolved = buffer.resolved;
+  resolved.assign(parent.size(), NO_LABEL);
+  std::size_t nClusters = 0;
+  for (std::size_t label = 1; label < parent.size(); ++label) {
+    const Label root = findRoot(parent, static_cast<Label>(label));
+    resolved[label] = root == static_cast<Label>(label)
+                          ? static_cast<Label>(++nClusters)
+                          : resolved[root];
+  }
+  std::size_t i = 0;
+  for (auto& cell : cells) {
+    getCellLabel(cell) = resolved[provisional(cell, i++)];
+  }
+  return nClusters;
+}
+
+// Provisional labels for sparse cells: every occupied pixel is stored in an
+// open addressing hash table and united with its already occupied left and
+// upper neighbours, which does not depend on the order of the cells
+template <typename CellCollection>
+void labelSparsePixels(const CellCollection& cells, bool commonCorner,
+                       RowScanBuffer& buffer) {
+  std::size_t capacity = 16;
+  while (capacity < 2 * cells.size()) {
+    capacity *= 2;
+  }
+  const std::size_t mask = capacity - 1;
+  buffer.keys.resize(capacity);
+  buffer.slots.assign(capacity, NO_LABEL);
+  buffer.cellSlots.resize(cells.size());
+
+  auto key = [](int row, int col) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(row))
+            << 32) |
+           static_cast<std::uint32_t>(col);
+  };
+  auto hash = [&](std::uint64_t k) {
+    return static_cast<std::size_t>((k * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+  };
+  // find the slot of a pixel, or the empty slot where it belongs
+  auto find = [&](std::uint64_t k) {
+    std::size_t slot = hash(k);
+    while (buffer.slots[slot] != NO_LABEL && buffer.keys[slot] != k) {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  };
+
+  std::vector<Label>& parent = buffer.parent;
+  std::size_t i = 0;
+  for (const auto& cell : cells) {
+    const std::uint64_t k = key(getCellRow(cell), getCellColumn(cell));
+    const std::size_t slot = find(k);
+    if (buffer.slots[slot] == NO_LABEL) {
+      buffer.keys[slot] = k;
+      buffer.slots[slot] = static_cast<Label>(parent.size());
+      parent.push_back(buffer.slots[slot]);
+    }
+    buffer.cellSlots[i++] = slot;
+  }
+
+  i = 0;
+  for (const auto& cell : cells) {
+    const int row = getCellRow(cell);
+    const int col = getCellColumn(cell);
+    const Label label = buffer.slots[buffer.cellSlots[i++]];
+    auto connect = [&](int nRow, int nCol) {
+      const Label neighbour = buffer.slots[find(key(nRow, nCol))];
+      if (neighbour != NO_LABEL) {
+        unite(parent, label, neighbour);
+      }
+    };
+    connect(row, col - 1);
+    connect(row - 1, col);
+    if (commonCorner) {
+      connect(row - 1, col - 1);
+      connect(row - 1, col + 1);
+    }
+  }
+}
+
 }  // namespace Acts::Ccl::internal
 
 namespace Acts::Ccl {
@@ -328,3 +447,127 @@ ClusterCollection createClusters(CellCollection& cells, Connect connect) {
 }
 
 }  // namespace Acts::Ccl
+
+namespace Acts::Ccl {
+
+template <typename CellCollection>
+std::size_t labelClustersRowScan(CellCollection& cells, bool commonCorner,
+                                 RowScanBuffer& buffer) {
+  using Cell = typename CellCollection::value_type;
+  internal::staticCheckCellType<Cell, 2>();
+
+  if (cells.empty()) {
+    return 0;
+  }
+
+  // Bounding box of the cells
+  int rowMin = std::numeric_limits<int>::max();
+  int rowMax = std::numeric_limits<int>::lowest();
+  int colMin = std::numeric_limits<int>::max();
+  int colMax = std::numeric_limits<int>::lowest();
+  for (const auto& cell : cells) {
+    const int row = getCellRow(cell);
+    const int col = getCellColumn(cell);
+    rowMin = std::min(rowMin, row);
+    rowMax = std::max(rowMax, row);
+    colMin = std::min(colMin, col);
+    colMax = std::max(colMax, col);
+  }
+  const std::size_t nRows = static_cast<std::size_t>(
+      static_cast<std::int64_t>(rowMax) - rowMin + 1);
+  const std::size_t nCols = static_cast<std::size_t>(
+      static_cast<std::int64_t>(colMax) - colMin + 1);
+
+  std::vector<Label>& parent = buffer.parent;
+  parent.assign(1, NO_LABEL);
+
+  const std::size_t maxArea = internal::s_rowScanMaxAreaPerCell * cells.size();
+  if (nRows > maxArea || nCols > maxArea || nRows * nCols > maxArea) {
+    // Too sparse for a label image, look up the pixels in a hash table
+    internal::labelSparsePixels(cells, commonCorner, buffer);
+    return internal::resolveLabels(cells, buffer,
+                                   [&](const Cell& /*cell*/, std::size_t i) {
+                                     return buffer.slots[buffer.cellSlots[i]];
+                                   });
+  }
+
+  // Empty pixels are zero, all entries are reset to zero after use
+  std::vector<Label>& image = buffer.image;
+  if (image.size() < nRows * nCols) {
+    image.resize(nRows * nCols, NO_LABEL);
+  }
+  auto pixel = [&](const Cell& cell) {
+    return static_cast<std::size_t>(getCellRow(cell) - rowMin) * nCols +
+           static_cast<std::size_t>(getCellColumn(cell) - colMin);
+  };
+  constexpr Label unlabeled = -1;
+  for (const auto& cell : cells) {
+    image[pixel(cell)] = unlabeled;
+  }
+
+  // First pass: provisional labels from the left and upper neighbours
+  for (std::size_t row = 0; row < nRows; ++row) {
+    Label* line = image.data() + row * nCols;
+    const Label* above = row > 0 ? line - nCols : nullptr;
+    for (std::size_t col = 0; col < nCols; ++col) {
+      if (line[col] == NO_LABEL) {
+        continue;
+      }
+      Label label = NO_LABEL;
+      auto connect = [&](Label neighbour) {
+        if (neighbour > NO_LABEL) {
+          label = label == NO_LABEL
+                      ? neighbour
+                      : internal::unite(parent, label, neighbour);
+        }
+      };
+      if (col > 0) {
+        connect(line[col - 1]);
+      }
+      if (above != nullptr) {
+        connect(above[col]);
+        if (commonCorner && col > 0) {
+          connect(above[col - 1]);
+        }
+        if (commonCorner && col + 1 < nCols) {
+          connect(above[col + 1]);
+        }
+      }
+      if (label == NO_LABEL) {
+        label = static_cast<Label>(parent.size());
+        parent.push_back(label);
+      }
+      line[col] = label;
+    }
+  }
+
+  // Second pass: set the resolved labels and reset the image
+  const std::size_t nClusters = internal::resolveLabels(
+      cells, buffer,
+      [&](const Cell& cell, std::size_t /*i*/) { return image[pixel(cell)]; });
+  for (auto& cell : cells) {
+    image[pixel(cell)] = NO_LABEL;
+  }
+
+  return nClusters;
+}
+
+template <typename CellCollection, typename ClusterCollection>
+ClusterCollection createClustersRowScan(CellCollection& cells,
+                                        bool commonCorner,
+                                        RowScanBuffer& buffer) {
+  using Cell = typename CellCollection::value_type;
+  using Cluster = typename ClusterCollection::value_type;
+  internal::staticCheckCellType<Cell, 2>();
+  internal::staticCheckClusterType<Cluster&, const Cell&>();
+
+  const std::size_t nClusters =
+      labelClustersRowScan<CellCollection>(cells, commonCorner, buffer);
+  ClusterCollection clusters(nClusters);
+  for (auto& cell : cells) {
+    clusterAddCell(clusters[getCellLabel(cell) - 1], cell);
+  }
+  return clusters;
+}
+
+}  // namespace Acts::Ccl
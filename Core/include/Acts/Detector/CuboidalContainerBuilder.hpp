@@ -14,6 +14,7 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <memory>
 #include <string>
@@ -60,6 +61,13 @@ class CuboidalContainerBuilder : public IDetectorComponentBuilder {
     bool geoIdReverseGen = false;
     /// Auxiliary information, mainly for screen output
     std::string auxiliary = "";
+    /// Optional executor to run the builders concurrently, they have to be
+    /// independent of each other. The components are connected and the
+    /// geometry ids are assigned in the configured order.
+    /// @note the executor is called again from within the tasks by nested
+    /// builders, it must not block while waiting for them (see
+    /// @c ParallelExecutor)
+    ParallelExecutor executor = {};
   };
 
   /// Constructor with configuration struct
@@ -77,6 +85,8 @@ class CuboidalContainerBuilder : public IDetectorComponentBuilder {
   ///
   /// @param bpNode is the entry blue print node
   /// @param logLevel is the logging output level for the builder tools
+  /// @param executor is the optional executor for the builders of all levels,
+  ///        it is passed on recursively and must not block on nested tasks
   ///
   /// @note no checking is being done on consistency of the blueprint,
   /// it is assumed it has passed first through gap filling via the
@@ -86,7 +96,8 @@ class CuboidalContainerBuilder : public IDetectorComponentBuilder {
   ///
   /// @return a cylindrical container builder representing this blueprint
   CuboidalContainerBuilder(const Acts::Experimental::Blueprint::Node& bpNode,
-                           Acts::Logging::Level logLevel = Acts::Logging::INFO);
+                           Acts::Logging::Level logLevel = Acts::Logging::INFO,
+                           const ParallelExecutor& executor = {});
 
   /// The final implementation of the cylindrical container builder
   ///
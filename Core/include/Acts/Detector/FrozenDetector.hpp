@@ -0,0 +1,342 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Detector/detail/DetectorObjectLookup.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Navigation/NavigationDelegates.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/detail/AxisFwd.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+namespace Experimental {
+
+class Detector;
+class DetectorVolume;
+class Portal;
+
+/// @brief A frozen, flat representation of the navigation graph of a detector
+///
+/// The navigation of a @c Detector is expressed by type-erased delegates
+/// that are attached to the individual volumes and portals. Freezing compiles
+/// them into contiguous arrays of plain structs that are linked by indices:
+///
+/// - volumes with the ranges of their portal and surface candidates,
+/// - portals with their links to the volumes behind them,
+/// - the grids of the indexed surface, portal link and root volume lookups.
+///
+/// The volumes, portals and surfaces themselves are only referenced by index
+/// into the object tables, which are filled from the detector. The index
+/// arrays can be saved to a binary file and restored against the same
+/// detector, which skips the introspection of the navigation delegates.
+///
+/// Delegates that are not known to the freezing step are kept and called
+/// as fallback, their results are mapped back to indices.
+///
+/// The frozen detector can be set as navigation policy of the
+/// @c DetectorNavigator, which then updates the navigation state through
+/// the index arrays instead of the delegates.
+///
+/// @note The frozen detector does not extend the lifetime of the detector,
+/// which has to outlive it.
+class FrozenDetector {
+ public:
+  using Index = std::uint32_t;
+
+  /// Marker for an invalid index, e.g. the end of the world
+  static constexpr Index s_noIndex = std::numeric_limits<Index>::max();
+
+  /// A flat axis of a grid
+  struct Axis {
+    /// The cast of the global position onto this axis
+    BinningValue cast = binValues;
+    /// The boundary type, determines under- and overflow handling
+    Acts::detail::AxisBoundaryType boundaryType =
+        Acts::detail::AxisBoundaryType::Bound;
+    /// Equidistant axes are looked up arithmetically
+    bool equidistant = false;
+    /// The number of bins without under- and overflow
+    Index nBins = 0;
+    /// Offset of the bin edges in the edges array, for equidistant axes
+    /// only the minimum and maximum are stored
+    Index edgesBegin = 0;
+  };
+
+  /// A flat grid of up to two dimensions
+  ///
+  /// The bin contents are stored in compressed row format: for every bin
+  /// including under- and overflow there is an offset into the entries
+  /// array, with a trailing end offset.
+  struct Grid {
+    std::array<Axis, 2u> axes = {};
+    /// The number of used axes
+    Index nAxes = 0;
+    /// Transform applied to the global position, or s_noIndex for identity
+    Index transform = s_noIndex;
+    /// Offset of the bin offsets in the bin offsets array
+    Index binsBegin = 0;
+  };
+
+  /// The type of a link from a portal or the detector to a volume
+  enum class LinkType : std::uint8_t {
+    /// No volume, i.e. leaving the detector
+    EndOfWorld = 0,
+    /// A single volume, the target is the volume index
+    Volume = 1,
+    /// A grid of volume indices, the target is the grid index
+    Grid = 2,
+    /// An unknown delegate that is called as fallback
+    Delegate = 3,
+  };
+
+  /// A link to a volume
+  struct VolumeLink {
+    LinkType type = LinkType::EndOfWorld;
+    Index target = s_noIndex;
+  };
+
+  /// The portal links opposite/along the surface normal
+  struct PortalEntry {
+    std::array<VolumeLink, 2u> links = {};
+  };
+
+  /// The type of the surface candidate lookup of a volume
+  enum class CandidatesType : std::uint8_t {
+    /// Only the portals
+    Portals = 0,
+    /// The portals and all surfaces
+    PortalsAndSurfaces = 1,
+    /// The portals and the surfaces of a grid bin
+    PortalsAndGrid = 2,
+    /// An unknown delegate that is called as fallback
+    Delegate = 3,
+  };
+
+  /// A volume with its candidate ranges
+  struct VolumeEntry {
+    CandidatesType candidates = CandidatesType::Portals;
+    /// Range in the volume portals array, sub volume portals come first
+    Index portalsBegin = 0;
+    Index portalsEnd = 0;
+    /// Range in the volume surfaces array
+    Index surfacesBegin = 0;
+    Index surfacesEnd = 0;
+    /// The surface grid, its entries are relative to surfacesBegin
+    Index grid = s_noIndex;
+  };
+
+  /// A surface or portal candidate with its intersection
+  struct Candidate {
+    ObjectIntersection<Surface> objectIntersection =
+        ObjectIntersection<Surface>::invalid();
+    /// The surface or portal index
+    Index index = s_noIndex;
+    /// Whether this is a portal
+    bool isPortal = false;
+  };
+
+  using Candidates = std::vector<Candidate>;
+
+  /// Freeze the navigation of a detector
+  ///
+  /// @param detector the detector to be frozen
+  explicit FrozenDetector(const Detector& detector);
+
+  /// Restore a frozen detector from a binary file
+  ///
+  /// @param fileName the file written by @c save
+  /// @param detector the detector the file was written from
+  ///
+  /// @note will throw an exception if the file does not match the detector
+  static FrozenDetector load(const std::string& fileName,
+                             const Detector& detector) noexcept(false);
+
+  /// Save the index arrays to a binary file
+  ///
+  /// @param fileName the output file
+  void save(const std::string& fileName) const noexcept(false);
+
+  /// Find the volume at a global position
+  ///
+  /// @param gctx the geometry context of the call
+  /// @param position the global position
+  ///
+  /// @return the volume index or s_noIndex if outside
+  Index findVolume(const GeometryContext& gctx, const Vector3& position) const;
+
+  /// Find the volume behind a portal
+  ///
+  /// @param gctx the geometry context of the call
+  /// @param portal the portal index
+  /// @param position the global position on the portal
+  /// @param direction the global direction
+  ///
+  /// @return the volume index or s_noIndex if leaving the detector
+  Index portalTarget(const GeometryContext& gctx, Index portal,
+                     const Vector3& position, const Vector3& direction) const;
+
+  /// Fill the intersected and sorted surface and portal candidates of a volume
+  ///
+  /// @param gctx the geometry context of the call
+  /// @param volume the volume index
+  /// @param position the global position
+  /// @param direction the global direction
+  /// @param surfaceCheck the boundary check for surfaces, portals are
+  ///        always checked
+  /// @param overstepTolerance candidates behind this path length are dropped
+  /// @param candidates [out] the candidates, cleared before filling
+  void fillCandidates(const GeometryContext& gctx, Index volume,
+                      const Vector3& position, const Vector3& direction,
+                      const BoundaryCheck& surfaceCheck,
+                      ActsScalar overstepTolerance,
+                      Candidates& candidates) const;
+
+  /// Update the surface candidates of the current volume, this replaces
+  /// @c DetectorVolume::updateNavigationState
+  ///
+  /// @param gctx the geometry context of the call
+  /// @param nState [in,out] the navigation state with the current volume set
+  void updateNavigationState(const GeometryContext& gctx,
+                             NavigationState& nState) const;
+
+  /// Update the current volume when stepping through a portal, this
+  /// replaces @c Portal::updateDetectorVolume
+  ///
+  /// @param gctx the geometry context of the call
+  /// @param portal the portal that is crossed
+  /// @param nState [in,out] the navigation state to be updated
+  void updateDetectorVolume(const GeometryContext& gctx, const Portal& portal,
+                            NavigationState& nState) const;
+
+  /// Find the volume at a global position, this replaces
+  /// @c Detector::findDetectorVolume
+  ///
+  /// @param gctx the geometry context of the call
+  /// @param position the global position
+  ///
+  /// @return the volume or nullptr if outside
+  const DetectorVolume* findDetectorVolume(const GeometryContext& gctx,
+                                           const Vector3& position) const;
+
+  /// The detector this was frozen from
+  const Detector& detector() const { return *m_detector; }
+
+  /// Object access by index
+  const DetectorVolume* volume(Index index) const {
+    return m_volumeObjects[index];
+  }
+  const Portal* portal(Index index) const { return m_portalObjects[index]; }
+  const Surface* surface(Index index) const { return m_surfaceObjects[index]; }
+
+  /// The surface representation of a candidate
+  const Surface& candidateSurface(const Candidate& candidate) const;
+
+  /// Const access to the flat arrays
+  const std::vector<VolumeEntry>& volumes() const { return m_volumes; }
+  const std::vector<PortalEntry>& portals() const { return m_portals; }
+  const std::vector<Grid>& grids() const { return m_grids; }
+  const VolumeLink& rootVolumeLink() const { return m_rootLink; }
+  std::size_t numberOfSurfaces() const { return m_surfaceObjects.size(); }
+
+ private:
+  FrozenDetector() = default;
+
+  /// The portal candidates of a volume, the portals of the sub volumes come
+  /// first as in the portal providers
+  static std::vector<const Portal*> candidatePortals(
+      const DetectorVolume& volume);
+
+  /// Fill the object tables in a deterministic order
+  void collectObjects(const Detector& detector);
+
+  /// Check the index arrays against each other and the object tables
+  ///
+  /// @return false if any index is out of range
+  bool consistent() const;
+
+  /// Intersect the candidates of a volume and call @c push for every
+  /// candidate in front of the overstep tolerance
+  template <typename push_t>
+  void intersectCandidates(const GeometryContext& gctx,
+                           const VolumeEntry& entry, const Vector3& position,
+                           const Vector3& direction,
+                           const BoundaryCheck& surfaceCheck,
+                           ActsScalar overstepTolerance,
+                           const push_t& push) const;
+
+  /// Compile the navigation delegates into the index arrays
+  void compile();
+
+  /// Follow a volume link
+  Index followLink(const GeometryContext& gctx, const VolumeLink& link,
+                   const Vector3& position, const Vector3& direction,
+                   Index portal) const;
+
+  /// The global bin of a position in a grid, following the axis lookups
+  std::size_t globalBin(const Grid& grid, const Vector3& position) const;
+
+  /// Flatten an index grid, the entries are translated by @c map
+  template <typename grid_t, typename map_t>
+  Index addGrid(const grid_t& grid,
+                const std::array<BinningValue, grid_t::DIM>& casts,
+                const Transform3& transform, const map_t& map);
+
+  /// Compile a volume finding delegate into a link
+  VolumeLink compileLink(const DetectorVolumeUpdater& delegate);
+
+  /// The volume index of a volume, s_noIndex if unknown
+  Index volumeIndex(const DetectorVolume* volume) const;
+
+  /// The portal index of a portal, s_noIndex if unknown
+  Index portalIndex(const Portal* portal) const;
+
+  const Detector* m_detector = nullptr;
+
+  /// The index arrays
+  std::vector<VolumeEntry> m_volumes;
+  std::vector<PortalEntry> m_portals;
+  std::vector<Index> m_volumePortals;
+  std::vector<Index> m_volumeSurfaces;
+  std::vector<Grid> m_grids;
+  std::vector<ActsScalar> m_gridEdges;
+  std::vector<Index> m_gridBinOffsets;
+  std::vector<Index> m_gridEntries;
+  std::vector<Transform3> m_transforms;
+  VolumeLink m_rootLink;
+
+  /// The object tables
+  std::vector<const DetectorVolume*> m_volumeObjects;
+  std::vector<const Portal*> m_portalObjects;
+  std::vector<const Surface*> m_surfaceObjects;
+
+  /// Reverse lookup of volumes and portals by geometry identifier
+  detail::DetectorObjectLookup m_lookup;
+
+  /// Reverse lookups of all objects, for objects without unique geometry
+  /// identifiers and the candidates of fallback delegates
+  std::unordered_map<const DetectorVolume*, Index> m_volumeIndices;
+  std::unordered_map<const Portal*, Index> m_portalIndices;
+  std::unordered_map<const Surface*, Index> m_surfaceIndices;
+};
+
+}  // namespace Experimental
+}  // namespace Acts
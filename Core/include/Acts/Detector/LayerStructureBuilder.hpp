@@ -19,6 +19,7 @@
 #include "Acts/Utilities/BinningData.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <array>
 #include <cstddef>
@@ -94,6 +95,8 @@ class LayerStructureBuilder : public IInternalStructureBuilder {
     unsigned int nMinimalSurfaces = 4u;
     /// Polyhedron approximations
     unsigned int nSegments = 1u;
+    /// Optional executor to fill the surface grid concurrently
+    ParallelExecutor executor = {};
     /// Extra information, mainly for screen output
     std::string auxiliary = "";
   };
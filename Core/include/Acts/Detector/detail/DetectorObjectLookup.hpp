@@ -0,0 +1,93 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Detector/Portal.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Acts {
+namespace Experimental {
+namespace detail {
+
+/// @brief Flat lookup of the dense indices of volumes and portals
+///
+/// The indices are given by the position in the object lists handed to the
+/// constructor. They are looked up through tables indexed by the volume and
+/// the boundary number of the geometry identifiers, which avoids hashing
+/// the object pointers during navigation.
+///
+/// Objects without a volume or boundary number, or with a number that is
+/// already taken by another object, are not registered and not found.
+class DetectorObjectLookup {
+ public:
+  /// Marker for objects that are not registered
+  static constexpr std::size_t s_noIndex =
+      std::numeric_limits<std::size_t>::max();
+
+  DetectorObjectLookup() = default;
+
+  /// Build the lookup tables
+  ///
+  /// @param volumes the volumes, the index is the position in this list
+  /// @param portals the portals, the index is the position in this list
+  DetectorObjectLookup(std::vector<const DetectorVolume*> volumes,
+                       std::vector<const Portal*> portals);
+
+  /// @param volume the volume to look up
+  ///
+  /// @return the index of the volume or s_noIndex if not registered
+  std::size_t volumeIndex(const DetectorVolume* volume) const {
+    const std::size_t id = volume->geometryId().volume();
+    if (id < m_volumeTable.size()) {
+      const std::size_t index = m_volumeTable[id];
+      if (index != s_noIndex && m_volumes[index] == volume) {
+        return index;
+      }
+    }
+    return s_noIndex;
+  }
+
+  /// @param portal the portal to look up
+  ///
+  /// @return the index of the portal or s_noIndex if not registered
+  std::size_t portalIndex(const Portal* portal) const {
+    const auto& geoId = portal->surface().geometryId();
+    const std::size_t id = geoId.volume();
+    if (id + 1u < m_portalOffsets.size()) {
+      const std::size_t slot = m_portalOffsets[id] + geoId.boundary();
+      if (slot < m_portalOffsets[id + 1u]) {
+        const std::size_t index = m_portalTable[slot];
+        if (index != s_noIndex && m_portals[index] == portal) {
+          return index;
+        }
+      }
+    }
+    return s_noIndex;
+  }
+
+ private:
+  std::vector<const DetectorVolume*> m_volumes;
+  std::vector<const Portal*> m_portals;
+
+  /// Volume index per volume number
+  std::vector<std::size_t> m_volumeTable;
+  /// Portal index per volume and boundary number, the boundary numbers of
+  /// volume number v start at m_portalOffsets[v]
+  std::vector<std::size_t> m_portalOffsets;
+  std::vector<std::size_t> m_portalTable;
+};
+
+}  // namespace detail
+}  // namespace Experimental
+}  // namespace Acts
@@ -19,6 +19,7 @@
 #include "Acts/Utilities/GridAccessHelpers.hpp"
 #include "Acts/Utilities/IAxis.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <algorithm>
 #include <array>
@@ -163,6 +164,9 @@ struct IndexedGridFiller {
   /// Bin expansion where needed
   std::vector<std::size_t> binExpansion = {};
 
+  /// Optional executor to generate the bins of the objects concurrently
+  ParallelExecutor executor = {};
+
   /// Screen output logger
   std::unique_ptr<const Logger> oLogger =
       getDefaultLogger("IndexedGridFiller", Logging::INFO);
@@ -192,14 +196,17 @@ struct IndexedGridFiller {
       const GeometryContext& gctx, index_grid& iGrid,
       const indexed_objects& iObjects, const reference_generator& rGenerator,
       const typename index_grid::grid_type::value_type& aToAll = {}) const {
-    // Loop over the surfaces to be filled
-    for (auto [io, o] : enumerate(iObjects)) {
+    using index_t = typename decltype(iGrid.grid)::index_t;
+    // Generate the bins of the objects, this can be done concurrently as
+    // the grid is only read, the objects are filled in order afterwards
+    std::vector<std::set<index_t>> objectIndices(iObjects.size());
+    executeTasks(executor, iObjects.size(), [&](std::size_t io) {
       // Exclude indices that should be handled differently
       if (std::find(aToAll.begin(), aToAll.end(), io) != aToAll.end()) {
-        continue;
+        return;
       }
       // Get the reference positions
-      auto refs = rGenerator.references(gctx, *o);
+      auto refs = rGenerator.references(gctx, *iObjects[io]);
       std::vector<typename index_grid::grid_type::point_t> gridQueries;
       gridQueries.reserve(refs.size());
       for (const auto& ref : refs) {
@@ -208,9 +215,15 @@ struct IndexedGridFiller {
             GridAccessHelpers::castPosition<decltype(iGrid.grid)>(
                 iGrid.transform * ref, iGrid.casts));
       }
-      ACTS_DEBUG(gridQueries.size() << " reference points generated.");
-      auto lIndices = localIndices<decltype(iGrid.grid)>(
+      objectIndices[io] = localIndices<decltype(iGrid.grid)>(
           iGrid.grid, gridQueries, binExpansion);
+    });
+
+    // Loop over the surfaces to be filled
+    for (auto [io, lIndices] : enumerate(objectIndices)) {
+      if (lIndices.empty()) {
+        continue;
+      }
       ACTS_DEBUG(lIndices.size() << " indices assigned.");
       if (oLogger->level() <= Logging::VERBOSE) {
         ACTS_VERBOSE("- list of indices: " << outputIndices(lIndices));
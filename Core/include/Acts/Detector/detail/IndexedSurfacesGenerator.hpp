@@ -12,6 +12,7 @@
 #include "Acts/Detector/detail/IndexedGridFiller.hpp"
 #include "Acts/Navigation/SurfaceCandidatesUpdaters.hpp"
 #include "Acts/Utilities/Enumerate.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <algorithm>
 #include <array>
@@ -48,6 +49,8 @@ struct IndexedSurfacesGenerator {
   /// Screen output logger
   std::unique_ptr<const Logger> oLogger =
       getDefaultLogger("IndexedSurfacesGenerator", Logging::INFO);
+  /// Optional executor for the grid filling
+  ParallelExecutor executor = {};
 
   /// Create the Surface candidate updator
   ///
@@ -79,6 +82,7 @@ struct IndexedSurfacesGenerator {
                                               transform);
     // Fill the bin indices
     IndexedGridFiller filler{binExpansion};
+    filler.executor = executor;
     filler.oLogger = oLogger->cloneWithSuffix("_filler");
     filler.fill(gctx, indexedSurfaces, surfaces, rGenerator, assignToAll);
 
@@ -632,7 +632,22 @@ class MultiTrajectory {
     self().setReferenceSurface_impl(istate, std::move(surface));
   }
 
+ protected:
+  /// Copy the uncalibrated source link of a track state in another container.
+  /// Backends can hide this, e.g. to avoid copying the source link itself.
+  template <typename T, bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  void copyUncalibratedSourceLinkFrom_impl(IndexType dstIdx, const T& src,
+                                           IndexType srcIdx) {
+    setUncalibratedSourceLink(dstIdx, src.getUncalibratedSourceLink(srcIdx));
+  }
+
  private:
+  template <typename T, bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  void copyUncalibratedSourceLinkFrom(IndexType dstIdx, const T& src,
+                                      IndexType srcIdx) {
+    self().copyUncalibratedSourceLinkFrom_impl(dstIdx, src.self(), srcIdx);
+  }
+
   template <typename T, bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
   void copyDynamicFrom(IndexType dstIdx, const T& src, IndexType srcIdx) {
     const auto& dynamicKeys = src.self().dynamicKeys_impl();
@@ -66,6 +66,13 @@ class SourceLink final {
     return m_upstream.as<T>();
   }
 
+  /// @tparam T The source link type
+  /// @return true if @p T is stored without a heap allocation
+  template <typename T>
+  static constexpr bool fitsLocally() {
+    return any_type::fitsLocally<T>();
+  }
+
  private:
   any_type m_upstream{};
 };
@@ -0,0 +1,100 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Utilities/Delegate.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Event-level storage of source links which are referred to by a handle.
+///
+/// Containers which hold many copies of the same source links, like the
+/// track states of a multi-trajectory, can store a compact 64 bit handle
+/// into this table instead of a copy of every source link. Every source link
+/// is stored once per event, so experiment source links which do not fit
+/// into the source link buffer are only allocated once.
+///
+/// Source links which are already stored can be found with a lookup
+/// delegate, e.g. from the measurement index in the experiment source link
+/// when the table is filled with all the measurements of the event in order.
+///
+/// @note Adding source links is not thread-safe, a table should only be
+///       used by the containers of one event at a time.
+class SourceLinkTable {
+ public:
+  /// Handle of a source link in the table
+  using Handle = std::uint64_t;
+
+  /// Handle which does not refer to any source link
+  static constexpr Handle kInvalidHandle = std::numeric_limits<Handle>::max();
+
+  /// Delegate to find the handle of a source link already in the table, or
+  /// to return @c kInvalidHandle if it is not
+  using Lookup = Delegate<Handle(const SourceLink&)>;
+
+  /// Create an empty table
+  ///
+  /// @param lookup the optional lookup of source links already in the table
+  explicit SourceLinkTable(Lookup lookup = {}) : m_lookup(std::move(lookup)) {}
+
+  /// Add a source link to the table
+  ///
+  /// @param sourceLink the source link to add
+  /// @return the handle of the new source link
+  Handle insert(SourceLink sourceLink) {
+    m_sourceLinks.push_back(std::move(sourceLink));
+    return m_sourceLinks.size() - 1;
+  }
+
+  /// Get the handle of a source link, adding it to the table if the lookup
+  /// does not find it
+  ///
+  /// @param sourceLink the source link to find or add
+  /// @return the handle of the source link
+  Handle handle(const SourceLink& sourceLink) {
+    if (m_lookup.connected()) {
+      Handle found = m_lookup(sourceLink);
+      if (found != kInvalidHandle) {
+        assert(found < size() && "Source link lookup out of range");
+        return found;
+      }
+    }
+    return insert(sourceLink);
+  }
+
+  /// @param handle the handle of the source link
+  /// @return the source link with the given @p handle
+  const SourceLink& at(Handle handle) const {
+    assert(handle < size() && "Source link handle out of range");
+    return m_sourceLinks[handle];
+  }
+
+  /// @return the number of source links in the table
+  std::size_t size() const { return m_sourceLinks.size(); }
+
+  /// Reserve space for @p n source links
+  void reserve(std::size_t n) { m_sourceLinks.reserve(n); }
+
+  /// Remove all source links, which invalidates all the handles
+  void clear() { m_sourceLinks.clear(); }
+
+ private:
+  Lookup m_lookup;
+  std::vector<SourceLink> m_sourceLinks;
+};
+
+}  // namespace Acts
@@ -930,7 +930,8 @@ class TrackStateProxy {
       }
 
       if (other.hasUncalibratedSourceLink()) {
-        setUncalibratedSourceLink(other.getUncalibratedSourceLink());
+        m_traj->copyUncalibratedSourceLinkFrom(m_istate, other.container(),
+                                               other.index());
       }
 
       if (ACTS_CHECK_BIT(src, PM::Jacobian)) {
@@ -974,7 +975,8 @@ class TrackStateProxy {
       }
 
       if (other.hasUncalibratedSourceLink()) {
-        setUncalibratedSourceLink(other.getUncalibratedSourceLink());
+        m_traj->copyUncalibratedSourceLinkFrom(m_istate, other.container(),
+                                               other.index());
       }
 
       if (ACTS_CHECK_BIT(mask, PM::Jacobian) && has<hashString("jacobian")>() &&
@@ -12,6 +12,7 @@
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/MultiTrajectoryBackendConcept.hpp"
 #include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/SourceLinkTable.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/EventData/detail/DynamicColumn.hpp"
 #include "Acts/EventData/detail/DynamicKeyIterator.hpp"
@@ -89,6 +90,10 @@ class VectorMultiTrajectoryBase {
 
     auto h = make_histogram(axes);
 
+    const std::size_t sourceLinkSize = m_sourceLinkTable != nullptr
+                                           ? sizeof(SourceLinkTable::Handle)
+                                           : sizeof(SourceLink);
+
     for (IndexType i = 0; i < instance.size(); i++) {
       auto ts = instance.getTrackState(i);
 
@@ -118,7 +123,7 @@ class VectorMultiTrajectoryBase {
         h("parSmth", isMeas, weight(par_size));
         h("covSmth", isMeas, weight(cov_size));
       }
-      h("sourceLinks", isMeas, weight(sizeof(SourceLink)));
+      h("sourceLinks", isMeas, weight(sourceLinkSize));
       h("measOffset", isMeas,
         weight(sizeof(decltype(m_measOffset)::value_type)));
       h("measCovOffset", isMeas,
@@ -131,7 +136,7 @@ class VectorMultiTrajectoryBase {
 
         h("meas", isMeas, weight(meas_size));
         h("measCov", isMeas, weight(meas_cov_size));
-        h("sourceLinks", isMeas, weight(sizeof(const SourceLink)));
+        h("sourceLinks", isMeas, weight(sourceLinkSize));
         h("projectors", isMeas, weight(sizeof(ProjectorBitset)));
       }
 
@@ -177,6 +182,8 @@ class VectorMultiTrajectoryBase {
         m_measCovOffset{other.m_measCovOffset},
         m_jac{other.m_jac},
         m_sourceLinks{other.m_sourceLinks},
+        m_sourceLinkTable{other.m_sourceLinkTable},
+        m_sourceLinkHandles{other.m_sourceLinkHandles},
         m_projectors{other.m_projectors},
         m_referenceSurfaces{other.m_referenceSurfaces} {
     for (const auto& [key, value] : other.m_dynamic) {
@@ -208,6 +215,11 @@ class VectorMultiTrajectoryBase {
       case "projector"_hash:
         return instance.m_index[istate].iprojector != kInvalid;
       case "uncalibratedSourceLink"_hash:
+        if (instance.m_sourceLinkTable != nullptr) {
+          return instance.m_sourceLinkHandles[instance.m_index[istate]
+                                                  .iuncalibrated] !=
+                 SourceLinkTable::kInvalidHandle;
+        }
         return instance.m_sourceLinks[instance.m_index[istate].iuncalibrated]
             .has_value();
       case "previous"_hash:
@@ -303,9 +315,35 @@ class VectorMultiTrajectoryBase {
   }
 
   SourceLink getUncalibratedSourceLink_impl(IndexType istate) const {
+    return uncalibratedSourceLink(istate);
+  }
+
+  /// Access the uncalibrated source link without a copy
+  ///
+  /// @param istate the track state index
+  /// @return the uncalibrated source link, which stays valid until the
+  ///         track state or the source link table is modified
+  const SourceLink& uncalibratedSourceLink(IndexType istate) const {
+    if (m_sourceLinkTable != nullptr) {
+      return m_sourceLinkTable->at(uncalibratedSourceLinkHandle(istate));
+    }
     return m_sourceLinks[m_index[istate].iuncalibrated].value();
   }
 
+  /// @note Only available with a source link table
+  /// @param istate the track state index
+  /// @return the handle of the uncalibrated source link in the table
+  SourceLinkTable::Handle uncalibratedSourceLinkHandle(IndexType istate) const {
+    assert(m_sourceLinkTable != nullptr && "No source link table");
+    return m_sourceLinkHandles[m_index[istate].iuncalibrated];
+  }
+
+  /// @return the source link table, or nullptr if the source links are
+  ///         stored in the track states
+  const std::shared_ptr<SourceLinkTable>& sourceLinkTable() const {
+    return m_sourceLinkTable;
+  }
+
   const Surface* referenceSurface_impl(IndexType istate) const {
     return m_referenceSurfaces[istate].get();
   }
@@ -325,6 +363,10 @@ class VectorMultiTrajectoryBase {
 
   std::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_jac;
   std::vector<std::optional<SourceLink>> m_sourceLinks;
+  // with a source link table, the track states only store handles into it
+  // and the source link column stays empty
+  std::shared_ptr<SourceLinkTable> m_sourceLinkTable;
+  std::vector<SourceLinkTable::Handle> m_sourceLinkHandles;
   std::vector<ProjectorBitset> m_projectors;
 
   // owning vector of shared pointers to surfaces
@@ -355,6 +397,18 @@ class VectorMultiTrajectory final
 
  public:
   VectorMultiTrajectory() = default;
+
+  /// Create a trajectory which stores the source links in an event-level
+  /// table and only keeps a handle per track state
+  ///
+  /// @param sourceLinkTable the table, shared with other containers of the
+  ///        same event
+  explicit VectorMultiTrajectory(
+      std::shared_ptr<SourceLinkTable> sourceLinkTable) {
+    throw_assert(sourceLinkTable != nullptr, "Source link table is null");
+    m_sourceLinkTable = std::move(sourceLinkTable);
+  }
+
   VectorMultiTrajectory(const VectorMultiTrajectory& other)
       : VectorMultiTrajectoryBase{other} {}
 
@@ -424,8 +478,18 @@ class VectorMultiTrajectory final
       TrackStatePropMask mask = TrackStatePropMask::All,
       IndexType iprevious = kInvalid);
 
+  /// Reserve storage for an expected number of track states
+  ///
+  /// The storage is kept on @c clear, reserving once for the expected
+  /// number of track states per event makes adding track states to a reused
+  /// trajectory allocation free.
+  ///
+  /// @param n the expected number of track states
   void reserve(std::size_t n);
 
+  /// @return the number of track states that can be added without allocating
+  std::size_t capacity() const { return m_index.capacity(); }
+
   void shareFrom_impl(IndexType iself, IndexType iother,
                       TrackStatePropMask shareSource,
                       TrackStatePropMask shareTarget);
@@ -482,18 +546,58 @@ class VectorMultiTrajectory final
   }
 
   void setUncalibratedSourceLink_impl(IndexType istate, SourceLink sourceLink) {
+    if (m_sourceLinkTable != nullptr) {
+      setUncalibratedSourceLinkHandle(istate,
+                                      m_sourceLinkTable->handle(sourceLink));
+      return;
+    }
     m_sourceLinks[m_index[istate].iuncalibrated] = std::move(sourceLink);
   }
 
+  /// Set the uncalibrated source link from its handle, without a copy
+  ///
+  /// @note Only available with a source link table
+  /// @param istate the track state index
+  /// @param handle the handle of the source link in the table
+  void setUncalibratedSourceLinkHandle(IndexType istate,
+                                       SourceLinkTable::Handle handle) {
+    assert(m_sourceLinkTable != nullptr && "No source link table");
+    assert(handle < m_sourceLinkTable->size() && "Invalid source link handle");
+    m_sourceLinkHandles[m_index[istate].iuncalibrated] = handle;
+  }
+
   void setReferenceSurface_impl(IndexType istate,
                                 std::shared_ptr<const Surface> surface) {
     m_referenceSurfaces[istate] = std::move(surface);
   }
 
+  template <typename T>
+  void copyUncalibratedSourceLinkFrom_impl(IndexType istate, const T& src,
+                                           IndexType isrc) {
+    if constexpr (std::is_base_of_v<detail_vmt::VectorMultiTrajectoryBase,
+                                    T>) {
+      if (m_sourceLinkTable != nullptr &&
+          m_sourceLinkTable == src.sourceLinkTable()) {
+        // Both refer to the same table, only the handle is copied
+        setUncalibratedSourceLinkHandle(istate,
+                                        src.uncalibratedSourceLinkHandle(isrc));
+        return;
+      }
+      setUncalibratedSourceLink_impl(istate, src.uncalibratedSourceLink(isrc));
+    } else {
+      setUncalibratedSourceLink_impl(istate,
+                                     src.getUncalibratedSourceLink(isrc));
+    }
+  }
+
   void copyDynamicFrom_impl(IndexType dstIdx, HashedString key,
                             const std::any& srcPtr);
 
   // END INTERFACE
+
+ private:
+  /// Add an empty source link, or source link handle with a table
+  IndexType addSourceLinkSlot();
 };
 
 ACTS_STATIC_CHECK_CONCEPT(MutableMultiTrajectoryBackend, VectorMultiTrajectory);
@@ -14,6 +14,7 @@
 #include "Acts/Geometry/ITrackingVolumeHelper.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <algorithm>
 #include <array>
@@ -488,6 +489,9 @@ class CylinderVolumeBuilder : public ITrackingVolumeBuilder {
     double ringTolerance = 0 * UnitConstants::mm;
     /// Builder to construct layers within the volume
     std::shared_ptr<const ILayerBuilder> layerBuilder = nullptr;
+    /// Optional executor to build the negative, central and positive layers
+    /// concurrently, the layer builder has to support concurrent calls
+    ParallelExecutor layerExecutor = {};
     /// Builder to construct confined volumes within the volume
     std::shared_ptr<const IConfinedTrackingVolumeBuilder> ctVolumeBuilder =
         nullptr;
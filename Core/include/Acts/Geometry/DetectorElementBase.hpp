@@ -39,6 +39,17 @@ class DetectorElementBase {
   /// @param gctx The current geometry context object, e.g. alignment
   virtual const Transform3& transform(const GeometryContext& gctx) const = 0;
 
+  /// Return the inverse transform for the Element proxy mechanism
+  ///
+  /// The default computes the inverse on every call, detector elements
+  /// that hold their alignment per context can precompute it together
+  /// with the transform when the alignment context is created.
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  virtual Transform3 inverseTransform(const GeometryContext& gctx) const {
+    return transform(gctx).inverse();
+  }
+
   /// Return surface representation - const return pattern
   virtual const Surface& surface() const = 0;
 
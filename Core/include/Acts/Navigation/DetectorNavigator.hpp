@@ -11,11 +11,13 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Detector/Detector.hpp"
 #include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Detector/FrozenDetector.hpp"
 #include "Acts/Detector/Portal.hpp"
 #include "Acts/Geometry/BoundarySurfaceT.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/Layer.hpp"
 #include "Acts/Navigation/NavigationState.hpp"
+#include "Acts/Navigation/StaticNavigationPolicy.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -38,6 +40,14 @@ class DetectorNavigator {
     /// Detector for this Navigation
     const Detector* detector = nullptr;
 
+    /// Optional statically dispatched navigation delegates of the detector,
+    /// the type-erased delegates are called if not set
+    const StaticNavigationPolicy* staticPolicy = nullptr;
+
+    /// Optional frozen navigation graph of the detector, which has to be
+    /// frozen from @c detector, takes precedence over the static policy
+    const FrozenDetector* frozenDetector = nullptr;
+
     /// Configuration for this Navigator
     /// stop at every sensitive surface (whether it has material or not)
     bool resolveSensitive = true;
@@ -194,7 +204,7 @@ class DetectorNavigator {
       nState.surfaceCandidates.clear();
       nState.surfaceCandidateIndex = 0;
 
-      nState.currentPortal->updateDetectorVolume(state.geoContext, nState);
+      updateDetectorVolume(state.geoContext, nState);
 
       initializeTarget(state, stepper);
     }
@@ -363,6 +373,44 @@ class DetectorNavigator {
     return false;
   }
 
+  /// Find the volume at the current position, through the frozen detector
+  /// if configured
+  const DetectorVolume* findDetectorVolume(
+      const GeometryContext& gctx, const NavigationState& nState) const {
+    if (m_cfg.frozenDetector != nullptr) {
+      return m_cfg.frozenDetector->findDetectorVolume(gctx, nState.position);
+    }
+    return nState.currentDetector->findDetectorVolume(gctx, nState.position);
+  }
+
+  /// Update the current volume through the current portal, using the
+  /// configured navigation policy
+  void updateDetectorVolume(const GeometryContext& gctx,
+                            NavigationState& nState) const {
+    if (m_cfg.frozenDetector != nullptr) {
+      m_cfg.frozenDetector->updateDetectorVolume(gctx, *nState.currentPortal,
+                                                 nState);
+    } else if (m_cfg.staticPolicy != nullptr) {
+      m_cfg.staticPolicy->updateDetectorVolume(gctx, *nState.currentPortal,
+                                               nState);
+    } else {
+      nState.currentPortal->updateDetectorVolume(gctx, nState);
+    }
+  }
+
+  /// Update the surface candidates of the current volume, using the
+  /// configured navigation policy
+  void updateNavigationState(const GeometryContext& gctx,
+                             NavigationState& nState) const {
+    if (m_cfg.frozenDetector != nullptr) {
+      m_cfg.frozenDetector->updateNavigationState(gctx, nState);
+    } else if (m_cfg.staticPolicy != nullptr) {
+      m_cfg.staticPolicy->updateNavigationState(gctx, nState);
+    } else {
+      nState.currentVolume->updateNavigationState(gctx, nState);
+    }
+  }
+
   /// @brief Navigation (re-)initialisation for the target
   ///
   /// @note This is only called a few times every propagation/extrapolation
@@ -389,8 +437,7 @@ class DetectorNavigator {
     auto& nState = state.navigation;
 
     if (nState.currentVolume == nullptr) {
-      nState.currentVolume = nState.currentDetector->findDetectorVolume(
-          state.geoContext, nState.position);
+      nState.currentVolume = findDetectorVolume(state.geoContext, nState);
 
       if (nState.currentVolume != nullptr) {
         ACTS_VERBOSE(volInfo(state)
@@ -404,7 +451,7 @@ class DetectorNavigator {
       return;
     }
 
-    nState.currentVolume->updateNavigationState(state.geoContext, nState);
+    updateNavigationState(state.geoContext, nState);
 
     // Sort properly the surface candidates
     auto& nCandidates = nState.surfaceCandidates;
@@ -0,0 +1,161 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Detector/Portal.hpp"
+#include "Acts/Detector/detail/DetectorObjectLookup.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Navigation/DetectorVolumeUpdaters.hpp"
+#include "Acts/Navigation/NavigationState.hpp"
+#include "Acts/Navigation/SurfaceCandidatesUpdaters.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/GridAxisGenerators.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <variant>
+#include <vector>
+
+namespace Acts {
+namespace Experimental {
+
+class Detector;
+
+/// @brief Statically dispatched navigation delegates of a detector
+///
+/// The surface candidate and volume updaters of volumes and portals are
+/// type-erased delegates, every navigation update is an indirect call that
+/// the compiler can not inline. This policy resolves the delegates of a
+/// detector once against a closed list of the common implementations:
+///
+/// - volumes with all portals, or all portals and surfaces,
+/// - cylindrical barrels (z, phi) and endcaps (r, phi) with an indexed
+///   surface grid and all portals,
+/// - portals linking to the end of the world, a single volume or a bound
+///   1D grid of volumes.
+///
+/// The resolved implementations are held as pointers in a closed
+/// @c std::variant and called through @c std::visit, which allows to
+/// inline the candidate generation into the navigator.
+///
+/// The resolved implementations are stored in flat tables, which are
+/// indexed through the volume and boundary numbers of the geometry
+/// identifiers.
+///
+/// Volumes and portals with delegates outside of this list, or without
+/// unique geometry identifiers, are not resolved and are updated through
+/// their delegates as before.
+///
+/// @note The policy does not extend the lifetime of the detector,
+/// which has to outlive it.
+class StaticNavigationPolicy {
+ public:
+  /// The indexed surface grids of barrels and endcaps
+  using EqClosedGrid =
+      GridAxisGenerators::EqClosed::grid_type<std::vector<std::size_t>>;
+  using EqBoundEqClosedGrid =
+      GridAxisGenerators::EqBoundEqClosed::grid_type<std::vector<std::size_t>>;
+  using EqClosedEqBoundGrid =
+      GridAxisGenerators::EqClosedEqBound::grid_type<std::vector<std::size_t>>;
+  using VarBoundEqClosedGrid =
+      GridAxisGenerators::VarBoundEqClosed::grid_type<std::vector<std::size_t>>;
+
+  /// The closed list of surface candidate updaters
+  using SurfaceCandidatesImpl = std::variant<
+      const AllPortalsImpl*, const AllPortalsAndSurfacesImpl*,
+      const IndexedSurfacesAllPortalsImpl<EqClosedGrid, IndexedSurfacesImpl>*,
+      const IndexedSurfacesAllPortalsImpl<EqBoundEqClosedGrid,
+                                          IndexedSurfacesImpl>*,
+      const IndexedSurfacesAllPortalsImpl<EqClosedEqBoundGrid,
+                                          IndexedSurfacesImpl>*,
+      const IndexedSurfacesAllPortalsImpl<VarBoundEqClosedGrid,
+                                          IndexedSurfacesImpl>*>;
+
+  /// The closed list of detector volume updaters
+  using DetectorVolumeImpl =
+      std::variant<const EndOfWorldImpl*, const SingleDetectorVolumeImpl*,
+                   const BoundVolumesGrid1Impl*>;
+
+  /// Resolve the navigation delegates of a detector
+  ///
+  /// @param detector the detector whose volumes and portals are resolved
+  explicit StaticNavigationPolicy(const Detector& detector);
+
+  /// Update the surface candidates of the current volume, this replaces
+  /// @c DetectorVolume::updateNavigationState
+  ///
+  /// @param gctx is the current geometry context
+  /// @param nState [in,out] the navigation state with the current volume set
+  void updateNavigationState(const GeometryContext& gctx,
+                             NavigationState& nState) const {
+    const DetectorVolume* volume = nState.currentVolume;
+    const std::size_t index = m_lookup.volumeIndex(volume);
+    if (index == detail::DetectorObjectLookup::s_noIndex ||
+        !m_surfaceCandidatesImpls[index].has_value()) {
+      volume->updateNavigationState(gctx, nState);
+      return;
+    }
+    std::visit([&](const auto* impl) { impl->update(gctx, nState); },
+               *m_surfaceCandidatesImpls[index]);
+    nState.surfaceCandidateIndex = 0;
+  }
+
+  /// Update the current volume when stepping through a portal, this
+  /// replaces @c Portal::updateDetectorVolume
+  ///
+  /// @param gctx is the current geometry context
+  /// @param portal the portal that is crossed
+  /// @param nState [in,out] the navigation state to be updated
+  void updateDetectorVolume(const GeometryContext& gctx, const Portal& portal,
+                            NavigationState& nState) const {
+    const std::size_t index = m_lookup.portalIndex(&portal);
+    if (index == detail::DetectorObjectLookup::s_noIndex ||
+        !m_detectorVolumeImpls[index].has_value()) {
+      portal.updateDetectorVolume(gctx, nState);
+      return;
+    }
+    const Vector3 normal = portal.surface().normal(gctx, nState.position);
+    Direction dir = Direction::fromScalar(normal.dot(nState.direction));
+    std::visit([&](const auto* impl) { impl->update(gctx, nState); },
+               (*m_detectorVolumeImpls[index])[dir.index()]);
+  }
+
+  /// @return the number of volumes with resolved surface candidate updaters
+  std::size_t resolvedVolumes() const;
+
+  /// @return the number of portals with resolved detector volume updaters
+  std::size_t resolvedPortals() const;
+
+ private:
+  /// Resolve the updaters of a portal, unconnected sides end the world
+  ///
+  /// @return the updaters of both sides, or nothing if one is not resolved
+  static std::optional<std::array<DetectorVolumeImpl, 2u>> resolvePortal(
+      const Portal& portal);
+
+  /// The end of world for unconnected portal sides
+  static const EndOfWorldImpl s_endOfWorld;
+
+  /// The dense indices of the volumes and portals
+  detail::DetectorObjectLookup m_lookup;
+
+  /// The resolved surface candidate updaters per volume index
+  std::vector<std::optional<SurfaceCandidatesImpl>> m_surfaceCandidatesImpls;
+
+  /// The resolved detector volume updaters per portal index
+  std::vector<std::optional<std::array<DetectorVolumeImpl, 2u>>>
+      m_detectorVolumeImpls;
+};
+
+}  // namespace Experimental
+}  // namespace Acts
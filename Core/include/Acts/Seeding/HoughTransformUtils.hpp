@@ -13,13 +13,17 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
 #include <map>
 #include <optional>
-#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
-
-#include "HoughVectors.hpp"
+#include <utility>
+#include <vector>
 
 namespace Acts {
 namespace HoughTransformUtils {
@@ -90,45 +94,6 @@ double binCenter(double min, double max, unsigned nSteps,
   return min + (max - min) * 0.5 * (2 * binIndex + 1) / nSteps;
 }
 
-/// @brief data class for the information to store for each
-/// cell of the hough histogram.
-/// @tparam identifier_t: Type of the identifier to associate to the hits
-///                       Should be sortable. Used to uniquely identify each
-///                       hit and to eventually return the list of hits per cell
-template <class identifier_t>
-class HoughCell {
- public:
-  /// @brief construct the cell as empty
-  HoughCell() = default;
-  /// @brief add an entry to this cell
-  /// @param identifier: Identifier of the hit (used to distinguish hits from another)
-  /// @param layer: Layer of the hit (used when counting layers)
-  /// @param weight: Optional weight to assign to the hit
-  void fill(const identifier_t& identifier, unsigned int layer,
-            YieldType weight = 1.);
-  /// @brief access the number of layers with hits compatible with this cell
-  YieldType nLayers() const { return m_nLayers; }
-  /// @brief access the number of unique hits compatible with this cell
-  YieldType nHits() const { return m_nHits; }
-  /// @brief access the set of layers compatible with this cell
-  const std::unordered_set<unsigned>& layers() const { return m_layers; }
-  /// @brief access the set of unique hits compatible with this cell
-  const std::unordered_set<identifier_t>& hits() const { return m_hits; }
-  /// @brief reset this cell, removing any existing content.
-  void reset();
-
- private:
-  /// data members
-
-  YieldType m_nLayers =
-      0;                  // (weighted) number of layers with hits on this cell
-  YieldType m_nHits = 0;  // (weighted) number of unique hits on this cell
-  std::unordered_set<unsigned> m_layers =
-      {};  // set of layers with hits on this cell
-  std::unordered_set<identifier_t> m_hits =
-      {};  // set of unique hits on this cell
-};
-
 /// @brief Configuration - number of bins in each axis.
 /// The Hough plane is agnostic of how the bins map to
 /// coordinates, allowing to re-use a plane for several
@@ -142,11 +107,18 @@ struct HoughPlaneConfig {
 /// @brief Representation of the hough plane - the histogram used
 /// for the hough transform with methods to fill and evaluate
 /// the histogram. Templated to a class used as identifier for the hits
+///
+/// The histogram is stored as a compact accumulator: dense arrays of the
+/// (weighted) hit and layer counts and a bit mask of the layers with hits
+/// for each bin. The hits contributing to a bin are not stored per bin,
+/// instead the bin range covered by each filled hit is kept and the hit
+/// list is only assembled when requested, e.g. for the bins of a maximum.
+/// Layer indices are limited to @c s_maxLayers.
 template <class identifier_t>
 class HoughPlane {
  public:
-  /// @brief hough histogram representation as a 2D-indexable vector of hough cells
-  using HoughHist = MultiIndexedVector2D<HoughCell<identifier_t>>;
+  /// @brief the maximum number of layers supported by the layer bit masks
+  static constexpr unsigned s_maxLayers = 64;
 
   /// @brief instantiate the (empty) hough plane
   /// @param cfg: configuration
@@ -162,8 +134,9 @@ class HoughPlane {
   /// @param widthPar: The function dy(x) parametrising the width of the y(x) curve
   ///                   for a given measurement
   /// @param identifier: The unique identifier for the given hit
-  /// @param layer: A layer index for this hit
+  /// @param layer: A layer index for this hit, smaller than s_maxLayers
   /// @param weight: An optional weight to assign to this hit
+  /// @throws std::out_of_range if the layer index is not smaller than s_maxLayers
   template <class PointType>
   void fill(const PointType& measurement, const HoughAxisRanges& axisRanges,
             LineParametrisation<PointType> linePar,
@@ -180,33 +153,29 @@ class HoughPlane {
   /// @param xBin: bin index in the first coordinate
   /// @param yBin: bin index in the second coordinate
   /// @return the set of layer indices that have hits for this cell
-  const std::unordered_set<unsigned>& layers(std::size_t xBin,
-                                             std::size_t yBin) const {
-    return m_houghHist(xBin, yBin).layers();
-  }
+  std::unordered_set<unsigned> layers(std::size_t xBin,
+                                      std::size_t yBin) const;
 
   /// @brief get the (weighted) number of layers  with hits in one cell of the histogram
   /// @param xBin: bin index in the first coordinate
   /// @param yBin: bin index in the second coordinate
   /// @return the (weighed) number of layers that have hits for this cell
   YieldType nLayers(std::size_t xBin, std::size_t yBin) const {
-    return m_houghHist(xBin, yBin).nLayers();
+    return m_nLayers[globalBin(xBin, yBin)];
   }
 
   /// @brief get the identifiers of all hits in one cell of the histogram
   /// @param xBin: bin index in the first coordinate
   /// @param yBin: bin index in the second coordinate
   /// @return the set of identifiers of the hits for this cell
-  const std::unordered_set<identifier_t>& hitIds(std::size_t xBin,
-                                                 std::size_t yBin) const {
-    return m_houghHist(xBin, yBin).hits();
-  }
+  std::unordered_set<identifier_t> hitIds(std::size_t xBin,
+                                          std::size_t yBin) const;
   /// @brief get the (weighted) number of hits in one cell of the histogram
   /// @param xBin: bin index in the first coordinate
   /// @param yBin: bin index in the second coordinate
   /// @return the (weighted) number of hits for this cell
   YieldType nHits(std::size_t xBin, std::size_t yBin) const {
-    return m_houghHist(xBin, yBin).nHits();
+    return m_nHits[globalBin(xBin, yBin)];
   }
 
   /// @brief get the number of bins on the first coordinate
@@ -218,12 +187,11 @@ class HoughPlane {
   /// cell across the entire histrogram.
   YieldType maxHits() const { return m_maxHits; }
 
-  /// @brief get the list of cells with non-zero content.
+  /// @brief get the list of cells with non-zero content, ordered in
+  /// the first and then the second coordinate.
   /// Useful for peak-finders in sparse data
   /// to avoid looping over all cells
-  const std::set<std::pair<std::size_t, std::size_t>>& getNonEmptyBins() const {
-    return m_touchedBins;
-  }
+  std::vector<std::pair<std::size_t, std::size_t>> getNonEmptyBins() const;
 
   /// @brief get the bin indices of the cell containing the largest number
   /// of (weighted) hits across the entire histogram
@@ -242,15 +210,43 @@ class HoughPlane {
   }
 
  private:
-  /// @brief Helper method to fill a bin of the hough histogram.
+  /// @brief the bin range in the second coordinate covered by a hit
+  /// for each bin of the first coordinate. Empty if first > second
+  using BinRange = std::pair<int, int>;
+
+  /// @brief the content of one fill call
+  struct Trace {
+    std::size_t hit = 0;     // index of the hit identifier
+    std::size_t ranges = 0;  // offset of the bin ranges of this trace
+  };
+
+  /// @brief Helper to get the global index of a bin
+  std::size_t globalBin(std::size_t binX, std::size_t binY) const {
+    return binX * m_cfg.nBinsY + binY;
+  }
+
+  /// @brief Helper method to fill a range of bins of the hough histogram
+  /// with a hit that was not filled before.
+  /// Updates the internal helper data structures (maximum tracker etc).
+  /// @param binX: bin number along x
+  /// @param range: the bin range along y
+  /// @param layer: layer index
+  /// @param w: hit weight
+  void fillRange(std::size_t binX, const BinRange& range, unsigned layer,
+                 YieldType w);
+
+  /// @brief Helper method to fill a single bin of the hough histogram.
   /// Updates the internal helper data structures (maximum tracker etc).
   /// @param binX: bin number along x
   /// @param binY: bin number along y
-  /// @param identifier: hit identifier
+  /// @param newHit: whether the hit is not yet counted in this bin
   /// @param layer: layer index
-  /// @param w: optional hit weight
-  void fillBin(std::size_t binX, std::size_t binY,
-               const identifier_t& identifier, unsigned layer, double w = 1.0f);
+  /// @param w: hit weight
+  void fillBin(std::size_t binX, std::size_t binY, bool newHit,
+               unsigned layer, YieldType w);
+
+  /// @brief Helper method to update the cached maxima after filling a bin
+  void updateMaxima(std::size_t binX, std::size_t binY);
 
   YieldType m_maxHits = 0.0f;    // track the maximum number of hits seen
   YieldType m_maxLayers = 0.0f;  // track the maximum number of layers seen
@@ -258,10 +254,21 @@ class HoughPlane {
       0, 0};  // track the location of the maximum in hits
   std::pair<std::size_t, std::size_t> m_maxLocLayers = {
       0, 0};  // track the location of the maximum in layers
-  std::set<std::pair<std::size_t, std::size_t>> m_touchedBins =
+  std::vector<std::size_t> m_touchedBins =
       {};                  // track the bins with non-trivial content
   HoughPlaneConfig m_cfg;  // the configuration object
-  HoughHist m_houghHist;   // the histogram data object
+
+  std::vector<YieldType> m_nHits;            // (weighted) hits per bin
+  std::vector<YieldType> m_nLayers;          // (weighted) layers per bin
+  std::vector<std::uint64_t> m_layerMasks;  // layers with hits per bin
+
+  std::vector<identifier_t> m_hitIds;  // the identifiers of the filled hits
+  std::unordered_map<identifier_t, std::size_t>
+      m_hitIndices;  // the index of each identifier in m_hitIds
+  std::vector<std::vector<std::size_t>>
+      m_hitTraces;              // the traces of each hit
+  std::vector<Trace> m_traces;  // the traces of all fill calls
+  std::vector<BinRange> m_traceRanges;  // the bin ranges of all traces
 };
 
 /// example peak finders.
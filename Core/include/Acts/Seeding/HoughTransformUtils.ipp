@@ -6,6 +6,17 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+template <class identifier_t>
+Acts::HoughTransformUtils::HoughPlane<identifier_t>::HoughPlane(
+    const HoughPlaneConfig& cfg)
+    : m_cfg(cfg) {
+  // instantiate our histogram.
+  const std::size_t nBins = m_cfg.nBinsX * m_cfg.nBinsY;
+  m_nHits.resize(nBins, 0.0f);
+  m_nLayers.resize(nBins, 0.0f);
+  m_layerMasks.resize(nBins, 0u);
+}
+
 template <class identifier_t>
 template <class PointType>
 void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fill(
@@ -13,79 +24,126 @@ void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fill(
     LineParametrisation<PointType> linePar,
     LineParametrisation<PointType> widthPar, const identifier_t& identifier,
     unsigned layer, YieldType weight) {
-  // loop over all bins in the first coordinate to populate the line
+  if (layer >= s_maxLayers) {
+    throw std::out_of_range("HoughPlane: layer index " +
+                            std::to_string(layer) + " exceeds the maximum");
+  }
+  // find the hit, or register it if it is new
+  auto [hitIndex, newHit] =
+      m_hitIndices.try_emplace(identifier, m_hitIds.size());
+  if (newHit) {
+    m_hitIds.push_back(identifier);
+    m_hitTraces.emplace_back();
+  }
+  const std::size_t hit = hitIndex->second;
+
+  // loop over all bins in the first coordinate to evaluate the line
+  const std::size_t rangesOffset = m_traceRanges.size();
+  m_traceRanges.resize(rangesOffset + m_cfg.nBinsX);
+  BinRange* ranges = m_traceRanges.data() + rangesOffset;
+  const int lastBinY = static_cast<int>(m_cfg.nBinsY) - 1;
   for (std::size_t xBin = 0; xBin < m_cfg.nBinsX; xBin++) {
     // get the x-coordinate for the given bin
     auto x = binCenter(axisRanges.xMin, axisRanges.xMax, m_cfg.nBinsX, xBin);
     // now evaluate the line equation provided by the user
     CoordType y = linePar(x, measurement);
     CoordType dy = widthPar(x, measurement);
-    // translate the y-coordinate range to a bin range
+    // translate the y-coordinate range to a bin range,
+    // skipping 'out of bounds' cases
     int yBinDown =
         binIndex(axisRanges.yMin, axisRanges.yMax, m_cfg.nBinsY, y - dy);
     int yBinUp =
         binIndex(axisRanges.yMin, axisRanges.yMax, m_cfg.nBinsY, y + dy);
-    // now we can loop over the bin range to fill the corresponding cells
-    for (int yBin = yBinDown; yBin <= yBinUp; ++yBin) {
-      // skip 'out of bounds' cases
-      if (yBin >= static_cast<int>(m_cfg.nBinsY) || yBin < 0) {
-        continue;
+    ranges[xBin] = {std::max(yBinDown, 0), std::min(yBinUp, lastBinY)};
+  }
+
+  // now we can fill the corresponding cells
+  const std::vector<std::size_t>& previousTraces = m_hitTraces[hit];
+  for (std::size_t xBin = 0; xBin < m_cfg.nBinsX; xBin++) {
+    const BinRange& range = ranges[xBin];
+    if (range.first > range.second) {
+      continue;
+    }
+    if (previousTraces.empty()) {
+      fillRange(xBin, range, layer, weight);
+      continue;
+    }
+    // the hit was filled before, only count it in the bins it did not reach
+    for (int yBin = range.first; yBin <= range.second; ++yBin) {
+      bool counted = false;
+      for (std::size_t trace : previousTraces) {
+        const BinRange& previous =
+            m_traceRanges[m_traces[trace].ranges + xBin];
+        counted =
+            counted || (yBin >= previous.first && yBin <= previous.second);
       }
-      fillBin(xBin, yBin, identifier, layer, weight);
+      fillBin(xBin, yBin, !counted, layer, weight);
     }
   }
+  m_hitTraces[hit].push_back(m_traces.size());
+  m_traces.push_back({hit, rangesOffset});
 }
 
 template <class identifier_t>
-void Acts::HoughTransformUtils::HoughCell<identifier_t>::fill(
-    const identifier_t& identifier, unsigned layer, YieldType weight) {
-  // add the hit to the list of hits in the cell
-  if (m_hits.insert(identifier).second) {
-    // if new, increment the weighted hit counter
-    m_nHits += weight;
-  }
-  // and to the same for layer counts
-  if (m_layers.insert(layer).second) {
-    m_nLayers += weight;
+void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fillRange(
+    std::size_t binX, const BinRange& range, unsigned layer, YieldType w) {
+  const std::size_t first = globalBin(binX, range.first);
+  const std::size_t last = globalBin(binX, range.second);
+  YieldType* nHits = m_nHits.data();
+  YieldType* nLayers = m_nLayers.data();
+  std::uint64_t* layerMasks = m_layerMasks.data();
+  const std::uint64_t layerBit = std::uint64_t{1} << layer;
+  // mark the bins that are filled with non trivial content for the first time
+  for (std::size_t bin = first; bin <= last; ++bin) {
+    if (layerMasks[bin] == 0u) {
+      m_touchedBins.push_back(bin);
+    }
   }
-}
-template <class identifier_t>
-void Acts::HoughTransformUtils::HoughCell<identifier_t>::reset() {
-  // avoid expensive clear calls on empty cells
-  if (m_nLayers > 0) {
-    m_layers.clear();
+  // add content to the cells, branch free to allow vectorisation
+  for (std::size_t bin = first; bin <= last; ++bin) {
+    const bool newLayer = (layerMasks[bin] & layerBit) == 0u;
+    nHits[bin] += w;
+    nLayers[bin] += newLayer ? w : 0.0f;
+    layerMasks[bin] |= layerBit;
   }
-  if (m_nHits > 0) {
-    m_hits.clear();
+  // and update our cached maxima
+  for (int binY = range.first; binY <= range.second; ++binY) {
+    updateMaxima(binX, binY);
   }
-  m_nHits = 0;
-  m_nLayers = 0;
 }
 
-template <class identifier_t>
-Acts::HoughTransformUtils::HoughPlane<identifier_t>::HoughPlane(
-    const HoughPlaneConfig& cfg)
-    : m_cfg(cfg) {
-  // instantiate our histogram.
-  m_houghHist = HoughHist(m_cfg.nBinsX, m_cfg.nBinsY);
-}
 template <class identifier_t>
 void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fillBin(
-    std::size_t binX, std::size_t binY, const identifier_t& identifier,
-    unsigned layer, double w) {
+    std::size_t binX, std::size_t binY, bool newHit, unsigned layer,
+    YieldType w) {
+  const std::size_t bin = globalBin(binX, binY);
+  const std::uint64_t layerBit = std::uint64_t{1} << layer;
   // mark that this bin was filled with non trivial content
-  m_touchedBins.insert({binX, binY});
+  if (m_layerMasks[bin] == 0u) {
+    m_touchedBins.push_back(bin);
+  }
   // add content to the cell
-  m_houghHist(binX, binY).fill(identifier, layer, w);
+  if (newHit) {
+    m_nHits[bin] += w;
+  }
+  if ((m_layerMasks[bin] & layerBit) == 0u) {
+    m_nLayers[bin] += w;
+    m_layerMasks[bin] |= layerBit;
+  }
   // and update our cached maxima
-  YieldType nLayers = m_houghHist(binX, binY).nLayers();
-  YieldType nHits = m_houghHist(binX, binY).nHits();
-  if (nLayers > m_maxLayers) {
-    m_maxLayers = nLayers;
+  updateMaxima(binX, binY);
+}
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::HoughPlane<identifier_t>::updateMaxima(
+    std::size_t binX, std::size_t binY) {
+  const std::size_t bin = globalBin(binX, binY);
+  if (m_nLayers[bin] > m_maxLayers) {
+    m_maxLayers = m_nLayers[bin];
     m_maxLocLayers = {binX, binY};
   }
-  if (nHits > m_maxHits) {
-    m_maxHits = nHits;
+  if (m_nHits[bin] > m_maxHits) {
+    m_maxHits = m_nHits[bin];
     m_maxLocHits = {binX, binY};
   }
 }
@@ -94,14 +152,64 @@ template <class identifier_t>
 void Acts::HoughTransformUtils::HoughPlane<identifier_t>::reset() {
   // reset all bins that were previously filled
   // avoid calling this on empty cells to save time
-  for (auto bin : m_touchedBins) {
-    m_houghHist(bin).reset();
+  for (std::size_t bin : m_touchedBins) {
+    m_nHits[bin] = 0.0f;
+    m_nLayers[bin] = 0.0f;
+    m_layerMasks[bin] = 0u;
   }
   // don't forget to reset our cached maxima
   m_maxHits = 0.;
   m_maxLayers = 0.;
-  // and reset the list of nontrivial bins
+  // and reset the list of nontrivial bins and the filled hits
   m_touchedBins.clear();
+  m_hitIds.clear();
+  m_hitIndices.clear();
+  m_hitTraces.clear();
+  m_traces.clear();
+  m_traceRanges.clear();
+}
+
+template <class identifier_t>
+std::unordered_set<unsigned>
+Acts::HoughTransformUtils::HoughPlane<identifier_t>::layers(
+    std::size_t xBin, std::size_t yBin) const {
+  std::unordered_set<unsigned> layers;
+  const std::uint64_t layerMask = m_layerMasks[globalBin(xBin, yBin)];
+  for (unsigned layer = 0; layer < s_maxLayers; ++layer) {
+    if ((layerMask >> layer) & 1u) {
+      layers.insert(layer);
+    }
+  }
+  return layers;
+}
+
+template <class identifier_t>
+std::unordered_set<identifier_t>
+Acts::HoughTransformUtils::HoughPlane<identifier_t>::hitIds(
+    std::size_t xBin, std::size_t yBin) const {
+  // collect the hits whose traces cover this cell
+  std::unordered_set<identifier_t> hits;
+  const int binY = static_cast<int>(yBin);
+  for (const Trace& trace : m_traces) {
+    const BinRange& range = m_traceRanges[trace.ranges + xBin];
+    if (binY >= range.first && binY <= range.second) {
+      hits.insert(m_hitIds[trace.hit]);
+    }
+  }
+  return hits;
+}
+
+template <class identifier_t>
+std::vector<std::pair<std::size_t, std::size_t>>
+Acts::HoughTransformUtils::HoughPlane<identifier_t>::getNonEmptyBins() const {
+  std::vector<std::size_t> bins = m_touchedBins;
+  std::sort(bins.begin(), bins.end());
+  std::vector<std::pair<std::size_t, std::size_t>> nonEmptyBins;
+  nonEmptyBins.reserve(bins.size());
+  for (std::size_t bin : bins) {
+    nonEmptyBins.emplace_back(bin / m_cfg.nBinsY, bin % m_cfg.nBinsY);
+  }
+  return nonEmptyBins;
 }
 
 template <class identifier_t>
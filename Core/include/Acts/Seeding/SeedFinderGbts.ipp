@@ -16,6 +16,7 @@
 #include "Acts/Seeding/SeedFinderGbtsConfig.hpp"
 #include "Acts/Seeding/SeedFinderUtils.hpp"
 #include "Acts/Utilities/BinningType.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <cmath>
 #include <fstream>
@@ -79,21 +80,26 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
   const float maxKappa_high_eta = 0.8 / m_minR_squ;
   const float maxKappa_low_eta = 0.6 / m_minR_squ;
 
-  // 1. loop over stages
-
-  int currentStage = 0;
+  // 1. collect the pairs of eta bins to connect, in the order of the stages
 
   const Acts::GbtsConnector& connector = *(gbtsGeo.connector());
 
-  std::vector<Acts::GbtsEdge<external_spacepoint_t>> edgeStorage;
+  // a pair of eta bins with the phi window between them
+  struct GbtsBinPair {
+    const GbtsEtaBin<external_spacepoint_t>* B1;  // inner bin
+    const GbtsEtaBin<external_spacepoint_t>* B2;  // outer bin
+    float deltaPhi;
+  };
 
-  edgeStorage.reserve(m_config.MaxEdges);
-
-  int nEdges = 0;
+  std::vector<GbtsBinPair> binPairs;
+  // the first bin pair of each stage, with one extra entry at the end
+  std::vector<std::size_t> stageBegins;
 
   for (std::map<int, std::vector<GbtsConnector::LayerGroup>>::const_iterator
            it = connector.m_layerGroups.begin();
-       it != connector.m_layerGroups.end(); ++it, currentStage++) {
+       it != connector.m_layerGroups.end(); ++it) {
+    stageBegins.push_back(binPairs.size());
+
     // loop over L1 layers for the current stage
 
     for (const auto& layerGroup : (*it).second) {
@@ -161,165 +167,253 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
               deltaPhi = 0.001f + m_maxCurv * std::fabs(rb2 - rb1);
             }
 
-            unsigned int first_it = 0;
-            for (typename std::vector<
-                     GbtsNode<external_spacepoint_t>*>::const_iterator n1It =
-                     B1.m_vn.begin();
-                 n1It != B1.m_vn.end(); ++n1It) {  // loop over nodes in Layer 1
+            binPairs.push_back({&B1, &B2, deltaPhi});
+          }  // loop over source eta bins
+        }    // loop over dst eta bins
+      }      // loop over L2(L1) layers
+    }        // loop over dst layers
+  }          // loop over the stages of doublet making
+
+  stageBegins.push_back(binPairs.size());
+
+  // 2. make the doublets stage by stage. The candidates of all bin pairs of
+  // a stage are found in parallel, then the edges are created serially in
+  // the original order since the cuts on the number of edges per node depend
+  // on the edges created before.
+
+  // an edge candidate [n1 <- n2] with the edge parameters
+  struct GbtsDoubletCandidate {
+    GbtsNode<external_spacepoint_t>* n1;
+    GbtsNode<external_spacepoint_t>* n2;
+    float p[4];
+    // the result of the match against the edges incoming to n2, and their
+    // number at the time of the match
+    bool isGood;
+    std::size_t nMatchedIn;
+  };
+
+  std::vector<Acts::GbtsEdge<external_spacepoint_t>> edgeStorage;
 
-              GbtsNode<external_spacepoint_t>* n1 = (*n1It);
+  edgeStorage.reserve(m_config.MaxEdges);
 
-              if (n1->m_in.size() >= MAX_SEG_PER_NODE) {
-                continue;
-              }
+  int nEdges = 0;
+
+  // match the edge candidate against the edges incoming to n2
+  auto matchesIncoming = [&](const GbtsNode<external_spacepoint_t>* n2,
+                             float exp_eta) {
+    bool isGood =
+        n2->m_in.size() <= 2;  // we must have enough incoming edges to decide
+
+    if (!isGood) {
+      float uat_1 = 1.0f / exp_eta;
+
+      for (const auto& n2_in_idx : n2->m_in) {
+        float tau2 = edgeStorage.at(n2_in_idx).m_p[0];
+        float tau_ratio = tau2 * uat_1 - 1.0f;
+
+        if (std::fabs(tau_ratio) > m_config.cut_tau_ratio_max) {  // bad
+                                                                  // match
+          continue;
+        }
+        isGood = true;  // good match found
+        break;
+      }
+    }
+    return isGood;
+  };
+
+  std::vector<std::vector<GbtsDoubletCandidate>> candidates(binPairs.size());
+
+  // the candidates only read the edges of the previous stages
+  auto findCandidates = [&](std::size_t pairIdx) {
+    const GbtsEtaBin<external_spacepoint_t>& B1 = *binPairs[pairIdx].B1;
+    const GbtsEtaBin<external_spacepoint_t>& B2 = *binPairs[pairIdx].B2;
+    const float deltaPhi = binPairs[pairIdx].deltaPhi;
+    std::vector<GbtsDoubletCandidate>& pairCandidates = candidates[pairIdx];
+
+    unsigned int first_it = 0;
+    for (typename std::vector<
+             GbtsNode<external_spacepoint_t>*>::const_iterator n1It =
+             B1.m_vn.begin();
+         n1It != B1.m_vn.end(); ++n1It) {  // loop over nodes in Layer 1
+
+      GbtsNode<external_spacepoint_t>* n1 = (*n1It);
+
+      float r1 = n1->m_spGbts.SP->r();
+      float x1 = n1->m_spGbts.SP->x();
+      float y1 = n1->m_spGbts.SP->y();
+      float z1 = n1->m_spGbts.SP->z();
+      float phi1 = std::atan(x1 / y1);
+
+      float minPhi = phi1 - deltaPhi;
+      float maxPhi = phi1 + deltaPhi;
+
+      for (unsigned int n2PhiIdx = first_it; n2PhiIdx < B2.m_vPhiNodes.size();
+           n2PhiIdx++) {  // sliding window over nodes in Layer 2
+
+        float phi2 = B2.m_vPhiNodes.at(n2PhiIdx).first;
+
+        if (phi2 < minPhi) {
+          first_it = n2PhiIdx;
+          continue;
+        }
+        if (phi2 > maxPhi) {
+          break;
+        }
+
+        GbtsNode<external_spacepoint_t>* n2 =
+            B2.m_vn.at(B2.m_vPhiNodes.at(n2PhiIdx).second);
+
+        float r2 = n2->m_spGbts.SP->r();
+
+        float dr = r2 - r1;
+
+        if (dr < m_config.m_minDeltaRadius) {
+          continue;
+        }
+
+        float z2 = n2->m_spGbts.SP->z();
+
+        float dz = z2 - z1;
+        float tau = dz / dr;
+        float ftau = std::fabs(tau);
+        if (ftau > 36.0) {
+          continue;
+        }
+
+        if (ftau < n1->m_minCutOnTau) {
+          continue;
+        }
+        if (ftau < n2->m_minCutOnTau) {
+          continue;
+        }
+        if (ftau > n1->m_maxCutOnTau) {
+          continue;
+        }
+        if (ftau > n2->m_maxCutOnTau) {
+          continue;
+        }
+
+        if (m_config.m_doubletFilterRZ) {
+          float z0 = z1 - r1 * tau;
+
+          if (z0 < min_z0 || z0 > max_z0) {
+            continue;
+          }
+
+          float zouter = z0 + m_config.maxOuterRadius * tau;
+
+          if (zouter < cut_zMinU || zouter > cut_zMaxU) {
+            continue;
+          }
+        }
 
-              float r1 = n1->m_spGbts.SP->r();
-              float x1 = n1->m_spGbts.SP->x();
-              float y1 = n1->m_spGbts.SP->y();
-              float z1 = n1->m_spGbts.SP->z();
-              float phi1 = std::atan(x1 / y1);
+        float dx = n2->m_spGbts.SP->x() - x1;
+        float dy = n2->m_spGbts.SP->y() - y1;
 
-              float minPhi = phi1 - deltaPhi;
-              float maxPhi = phi1 + deltaPhi;
+        float L2 = 1 / (dx * dx + dy * dy);
 
-              for (unsigned int n2PhiIdx = first_it;
-                   n2PhiIdx < B2.m_vPhiNodes.size();
-                   n2PhiIdx++) {  // sliding window over nodes in Layer 2
+        float D = (n2->m_spGbts.SP->y() * x1 - y1 * n2->m_spGbts.SP->x()) /
+                  (r1 * r2);
 
-                float phi2 = B2.m_vPhiNodes.at(n2PhiIdx).first;
+        float kappa = D * D * L2;
 
-                if (phi2 < minPhi) {
-                  first_it = n2PhiIdx;
-                  continue;
-                }
-                if (phi2 > maxPhi) {
-                  break;
-                }
-
-                GbtsNode<external_spacepoint_t>* n2 =
-                    B2.m_vn.at(B2.m_vPhiNodes.at(n2PhiIdx).second);
-
-                if (n2->m_out.size() >= MAX_SEG_PER_NODE) {
-                  continue;
-                }
-                if (n2->isFull()) {
-                  continue;
-                }
-
-                float r2 = n2->m_spGbts.SP->r();
-
-                float dr = r2 - r1;
-
-                if (dr < m_config.m_minDeltaRadius) {
-                  continue;
-                }
-
-                float z2 = n2->m_spGbts.SP->z();
-
-                float dz = z2 - z1;
-                float tau = dz / dr;
-                float ftau = std::fabs(tau);
-                if (ftau > 36.0) {
-                  continue;
-                }
-
-                if (ftau < n1->m_minCutOnTau) {
-                  continue;
-                }
-                if (ftau < n2->m_minCutOnTau) {
-                  continue;
-                }
-                if (ftau > n1->m_maxCutOnTau) {
-                  continue;
-                }
-                if (ftau > n2->m_maxCutOnTau) {
-                  continue;
-                }
-
-                if (m_config.m_doubletFilterRZ) {
-                  float z0 = z1 - r1 * tau;
-
-                  if (z0 < min_z0 || z0 > max_z0) {
-                    continue;
-                  }
-
-                  float zouter = z0 + m_config.maxOuterRadius * tau;
-
-                  if (zouter < cut_zMinU || zouter > cut_zMaxU) {
-                    continue;
-                  }
-                }
-
-                float dx = n2->m_spGbts.SP->x() - x1;
-                float dy = n2->m_spGbts.SP->y() - y1;
-
-                float L2 = 1 / (dx * dx + dy * dy);
-
-                float D =
-                    (n2->m_spGbts.SP->y() * x1 - y1 * n2->m_spGbts.SP->x()) /
-                    (r1 * r2);
-
-                float kappa = D * D * L2;
-
-                if (ftau < 4.0) {  // eta = 2.1
-                  if (kappa > maxKappa_low_eta) {
-                    continue;
-                  }
-
-                } else {
-                  if (kappa > maxKappa_high_eta) {
-                    continue;
-                  }
-                }
-
-                // match edge candidate against edges incoming to n2
-
-                float exp_eta = std::sqrt(1 + tau * tau) - tau;
-
-                bool isGood =
-                    n2->m_in.size() <=
-                    2;  // we must have enough incoming edges to decide
-
-                if (!isGood) {
-                  float uat_1 = 1.0f / exp_eta;
-
-                  for (const auto& n2_in_idx : n2->m_in) {
-                    float tau2 = edgeStorage.at(n2_in_idx).m_p[0];
-                    float tau_ratio = tau2 * uat_1 - 1.0f;
-
-                    if (std::fabs(tau_ratio) >
-                        m_config.cut_tau_ratio_max) {  // bad
-                                                       // match
-                      continue;
-                    }
-                    isGood = true;  // good match found
-                    break;
-                  }
-                }
-                if (!isGood) {
-                  continue;  // no moatch found, skip creating [n1 <- n2] edge
-                }
-
-                float curv = D * std::sqrt(L2);  // signed curvature
-                float dPhi2 = std::asin(curv * r2);
-                float dPhi1 = std::asin(curv * r1);
-
-                if (nEdges < m_config.MaxEdges) {
-                  edgeStorage.emplace_back(n1, n2, exp_eta, curv, phi1 + dPhi1,
-                                           phi2 + dPhi2);
-
-                  n1->addIn(nEdges);
-                  n2->addOut(nEdges);
-
-                  nEdges++;
-                }
-              }  // loop over n2 (outer) nodes
-            }    // loop over n1 (inner) nodes
-          }      // loop over source eta bins
-        }        // loop over dst eta bins
-      }          // loop over L2(L1) layers
-    }            // loop over dst layers
-  }              // loop over the stages of doublet making
+        if (ftau < 4.0) {  // eta = 2.1
+          if (kappa > maxKappa_low_eta) {
+            continue;
+          }
+
+        } else {
+          if (kappa > maxKappa_high_eta) {
+            continue;
+          }
+        }
+
+        // match edge candidate against edges incoming to n2
+
+        float exp_eta = std::sqrt(1 + tau * tau) - tau;
+
+        bool isGood = matchesIncoming(n2, exp_eta);
+
+        float curv = D * std::sqrt(L2);  // signed curvature
+        float dPhi2 = std::asin(curv * r2);
+        float dPhi1 = std::asin(curv * r1);
+
+        pairCandidates.push_back({n1,
+                                  n2,
+                                  {exp_eta, curv, phi1 + dPhi1, phi2 + dPhi2},
+                                  isGood,
+                                  n2->m_in.size()});
+      }  // loop over n2 (outer) nodes
+    }    // loop over n1 (inner) nodes
+  };
+
+  // create the edges of the candidates in the original order
+  auto createEdges =
+      [&](const std::vector<GbtsDoubletCandidate>& pairCandidates) {
+    const GbtsNode<external_spacepoint_t>* lastN1 = nullptr;
+    bool n1IsFull = false;
+
+    for (const auto& candidate : pairCandidates) {
+      GbtsNode<external_spacepoint_t>* n1 = candidate.n1;
+      GbtsNode<external_spacepoint_t>* n2 = candidate.n2;
+
+      // the inner node is checked once before its sliding window
+      if (n1 != lastN1) {
+        lastN1 = n1;
+        n1IsFull = n1->m_in.size() >= MAX_SEG_PER_NODE;
+      }
+      if (n1IsFull) {
+        continue;
+      }
+
+      if (n2->m_out.size() >= MAX_SEG_PER_NODE) {
+        continue;
+      }
+      if (n2->isFull()) {
+        continue;
+      }
+
+      // The edges incoming to n2 only change within a stage if the layer of
+      // n2 is also a destination in this stage. The GbtsConnector constructor
+      // only puts connections into a stage whose destination layers are not
+      // the source of any remaining connection (the "zeroLayers" in
+      // GbtsConnector.cpp), so the match only has to be repeated for layer
+      // groups which were modified after the construction.
+      bool isGood = candidate.nMatchedIn == n2->m_in.size()
+                        ? candidate.isGood
+                        : matchesIncoming(n2, candidate.p[0]);
+      if (!isGood) {
+        continue;  // no moatch found, skip creating [n1 <- n2] edge
+      }
+
+      if (nEdges < m_config.MaxEdges) {
+        edgeStorage.emplace_back(n1, n2, candidate.p[0], candidate.p[1],
+                                 candidate.p[2], candidate.p[3]);
+
+        n1->addIn(nEdges);
+        n2->addOut(nEdges);
+
+        nEdges++;
+      }
+    }
+  };
+
+  for (std::size_t stage = 0; stage + 1 < stageBegins.size(); stage++) {
+    const std::size_t firstPair = stageBegins[stage];
+    const std::size_t nPairs = stageBegins[stage + 1] - firstPair;
+
+    executeTasks(m_config.executor, nPairs, [&](std::size_t pairIdx) {
+      findCandidates(firstPair + pairIdx);
+    });
+
+    for (std::size_t pairIdx = firstPair; pairIdx < firstPair + nPairs;
+         pairIdx++) {
+      createEdges(candidates[pairIdx]);
+      // release the memory early
+      candidates[pairIdx] = {};
+    }
+  }
 
   std::vector<const GbtsNode<external_spacepoint_t>*> vNodes;
 
@@ -331,7 +425,10 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
 
   int nNodes = vNodes.size();
 
-  for (int nodeIdx = 0; nodeIdx < nNodes; nodeIdx++) {
+  // 3. connect the edges, the nodes only update their own incoming edges and
+  // are processed in parallel
+
+  executeTasks(m_config.executor, nNodes, [&](std::size_t nodeIdx) {
     const GbtsNode<external_spacepoint_t>* pN = vNodes.at(nodeIdx);
 
     std::vector<std::pair<float, int>> in_sort, out_sort;
@@ -413,7 +510,7 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
         }
       }
     }
-  }
+  });
 
   const int maxIter = 15;
 
@@ -433,11 +530,13 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
   }
 
   for (; iter < maxIter; iter++) {
-    // generate proposals
-    std::vector<Acts::GbtsEdge<external_spacepoint_t>*> v_new;
-    v_new.clear();
+    // generate proposals, every edge only updates its own proposal so the
+    // edges are processed in parallel
+    std::vector<char> hasProposal(v_old.size(), 0);
+
+    executeTasks(m_config.executor, v_old.size(), [&](std::size_t oldIdx) {
+      Acts::GbtsEdge<external_spacepoint_t>* pS = v_old[oldIdx];
 
-    for (auto pS : v_old) {
       int next_level = pS->m_level;
 
       for (int nIdx = 0; nIdx < pS->m_nNei; nIdx++) {
@@ -448,12 +547,20 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
 
         if (pS->m_level == pN->m_level) {
           next_level = pS->m_level + 1;
-          v_new.push_back(pS);
+          hasProposal[oldIdx] = 1;
           break;
         }
       }
 
       pS->m_next = next_level;  // proposal
+    });
+
+    std::vector<Acts::GbtsEdge<external_spacepoint_t>*> v_new;
+
+    for (std::size_t oldIdx = 0; oldIdx < v_old.size(); oldIdx++) {
+      if (hasProposal[oldIdx] != 0) {
+        v_new.push_back(v_old[oldIdx]);
+      }
     }
     // update
 
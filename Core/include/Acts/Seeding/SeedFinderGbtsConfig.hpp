@@ -14,6 +14,7 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Seeding/GbtsBase.hpp"  //definition of Trigsispacepoint base and trigtriplets
 #include "Acts/Seeding/SeedConfirmationRangeConfig.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <memory>
 
@@ -73,6 +74,10 @@ struct SeedFinderGbtsConfig {
   double ptCoeff =
       0.29997 * 1.9972 / 2.0;  // ~0.3*B/2 - assumes nominal field of 2*T
 
+  // optional executor for the doublet making, the edge connection and the
+  // edge level updates; the seeds do not depend on the executor
+  ParallelExecutor executor = {};
+
   // ROI:
   bool containsPhi() {
     return false;
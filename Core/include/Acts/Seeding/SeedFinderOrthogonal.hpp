@@ -192,6 +192,19 @@ class SeedFinderOrthogonal {
   bool validTuple(const SeedFinderOptions &options, const internal_sp_t &low,
                   const internal_sp_t &high, bool isMiddleInverted) const;
 
+  /**
+   * @brief The candidate bottom and top spacepoints of one middle spacepoint.
+   *
+   * The bottom_lh_v and top_lh_v vectors hold the candidates assuming that
+   * the track has monotonically _increasing_ z position, bottom_hl_v and
+   * top_hl_v the candidates for a track with decreasing z position.
+   */
+  struct MiddleSpCandidates {
+    internal_sp_t *middle = nullptr;
+    std::vector<internal_sp_t *> bottom_lh_v, bottom_hl_v, top_lh_v, top_hl_v;
+    SeedFilterState seedFilterState;
+  };
+
   /**
    * @brief Create a k-d tree from a set of spacepoints.
    *
@@ -222,6 +235,19 @@ class SeedFinderOrthogonal {
           &candidates_collector,
       Acts::SpacePointData &spacePointData) const;
 
+  /**
+   * @brief Search for the bottom and top candidates of a middle space point.
+   *
+   * This only reads the k-d tree and the spacepoints, so the candidates of
+   * several middle space points can be searched concurrently.
+   *
+   * @param options frequently changing configuration (like beam position)
+   * @param tree The k-d tree to use for searching.
+   * @param candidates The middle spacepoint, and the output candidates.
+   */
+  void findCandidates(const SeedFinderOptions &options, const tree_t &tree,
+                      MiddleSpCandidates &candidates) const;
+
   /**
    * @brief Search for seeds starting from a given middle space point.
    *
@@ -229,15 +255,15 @@ class SeedFinderOrthogonal {
    * @tparam NDims Number of dimensions for our spatial embedding (probably 3).
    * @tparam output_container_t Type of the output container.
    *
-   * @param tree The k-d tree to use for searching.
    * @param out_cont The container write output seeds to.
-   * @param middle_p The middle spacepoint to find seeds for.
+   * @param candidates The middle spacepoint and its candidates, as found by
+   * findCandidates.
    * @param spacePointData Aux data for the spacepoints
    */
   template <typename output_container_t>
-  void processFromMiddleSP(const SeedFinderOptions &options, const tree_t &tree,
+  void processFromMiddleSP(const SeedFinderOptions &options,
                            output_container_t &out_cont,
-                           const typename tree_t::pair_t &middle_p,
+                           MiddleSpCandidates &candidates,
                            Acts::SpacePointData &spacePointData) const;
 
   /**
@@ -12,7 +12,9 @@
 #include "Acts/Seeding/SeedFinderOrthogonalConfig.hpp"
 #include "Acts/Seeding/SeedFinderUtils.hpp"
 #include "Acts/Utilities/BinningType.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <numeric>
@@ -479,16 +481,14 @@ void SeedFinderOrthogonal<external_spacepoint_t>::filterCandidates(
 }
 
 template <typename external_spacepoint_t>
-template <typename output_container_t>
-void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
+void SeedFinderOrthogonal<external_spacepoint_t>::findCandidates(
     const SeedFinderOptions &options, const tree_t &tree,
-    output_container_t &out_cont, const typename tree_t::pair_t &middle_p,
-    Acts::SpacePointData &spacePointData) const {
+    MiddleSpCandidates &candidates) const {
   using range_t = typename tree_t::range_t;
-  internal_sp_t &middle = *middle_p.second;
+  internal_sp_t &middle = *candidates.middle;
 
   /*
-   * Prepare four output vectors for seed candidates:
+   * Four output vectors for seed candidates:
    *
    * bottom_lh_v denotes the candidates bottom seed points, assuming that the
    * track has monotonically _increasing_ z position. bottom_hl_v denotes the
@@ -497,20 +497,11 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
    * increasing z track, and top_hl_v are the candidate top points for a
    * decreasing z track.
    */
-  std::vector<internal_sp_t *> bottom_lh_v, bottom_hl_v, top_lh_v, top_hl_v;
-
-  /*
-   * Storage for seed candidates
-   */
-  std::size_t max_num_quality_seeds_per_spm =
-      m_config.seedFilter->getSeedFilterConfig().maxQualitySeedsPerSpMConf;
-  std::size_t max_num_seeds_per_spm =
-      m_config.seedFilter->getSeedFilterConfig().maxSeedsPerSpMConf;
-
-  CandidatesForMiddleSp<const InternalSpacePoint<external_spacepoint_t>>
-      candidates_collector;
-  candidates_collector.setMaxElements(max_num_seeds_per_spm,
-                                      max_num_quality_seeds_per_spm);
+  std::vector<internal_sp_t *> &bottom_lh_v = candidates.bottom_lh_v;
+  std::vector<internal_sp_t *> &bottom_hl_v = candidates.bottom_hl_v;
+  std::vector<internal_sp_t *> &top_lh_v = candidates.top_lh_v;
+  std::vector<internal_sp_t *> &top_hl_v = candidates.top_hl_v;
+  SeedFilterState &seedFilterState = candidates.seedFilterState;
 
   /*
    * Calculate the search ranges for bottom and top candidates for this middle
@@ -602,7 +593,7 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
   }
 
   // apply cut on the number of top SP if seedConfirmation is true
-  SeedFilterState seedFilterState;
+  seedFilterState = SeedFilterState();
   bool search_bot_hl = true;
   bool search_bot_lh = true;
   if (m_config.seedConfirmation) {
@@ -656,6 +647,33 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
           }
         });
   }
+}
+
+template <typename external_spacepoint_t>
+template <typename output_container_t>
+void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
+    const SeedFinderOptions &options, output_container_t &out_cont,
+    MiddleSpCandidates &candidates,
+    Acts::SpacePointData &spacePointData) const {
+  internal_sp_t &middle = *candidates.middle;
+  std::vector<internal_sp_t *> &bottom_lh_v = candidates.bottom_lh_v;
+  std::vector<internal_sp_t *> &bottom_hl_v = candidates.bottom_hl_v;
+  std::vector<internal_sp_t *> &top_lh_v = candidates.top_lh_v;
+  std::vector<internal_sp_t *> &top_hl_v = candidates.top_hl_v;
+  SeedFilterState &seedFilterState = candidates.seedFilterState;
+
+  /*
+   * Storage for seed candidates
+   */
+  std::size_t max_num_quality_seeds_per_spm =
+      m_config.seedFilter->getSeedFilterConfig().maxQualitySeedsPerSpMConf;
+  std::size_t max_num_seeds_per_spm =
+      m_config.seedFilter->getSeedFilterConfig().maxSeedsPerSpMConf;
+
+  CandidatesForMiddleSp<const InternalSpacePoint<external_spacepoint_t>>
+      candidates_collector;
+  candidates_collector.setMaxElements(max_num_seeds_per_spm,
+                                      max_num_quality_seeds_per_spm);
 
   /*
    * If we have candidates for increasing z tracks, we try to combine them.
@@ -702,7 +720,7 @@ auto SeedFinderOrthogonal<external_spacepoint_t>::createTree(
     points.emplace_back(point, sp);
   }
 
-  return tree_t(std::move(points));
+  return tree_t(std::move(points), m_config.executor);
 }
 
 template <typename external_spacepoint_t>
@@ -764,6 +782,7 @@ void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
    * Run the seeding algorithm by iterating over all the points in the tree
    * and seeing what happens if we take them to be our middle spacepoint.
    */
+  std::vector<internal_sp_t *> middleSpacePoints;
   for (const typename tree_t::pair_t &middle_p : tree) {
     internal_sp_t &middle = *middle_p.second;
     auto rM = middle.radius();
@@ -792,7 +811,29 @@ void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
       continue;
     }
 
-    processFromMiddleSP(options, tree, out_cont, middle_p, spacePointData);
+    middleSpacePoints.push_back(middle_p.second);
+  }
+
+  /*
+   * The candidate search for a middle spacepoint only reads the tree, so the
+   * searches for a batch of middle spacepoints can run concurrently. The seed
+   * filter updates the qualities of the spacepoints, so the seeds are then
+   * formed in the original order of the middle spacepoints.
+   */
+  constexpr std::size_t middleBatchSize = 1024;
+  std::vector<MiddleSpCandidates> candidates(
+      std::min(middleBatchSize, middleSpacePoints.size()));
+  for (std::size_t first = 0; first < middleSpacePoints.size();
+       first += middleBatchSize) {
+    const std::size_t nMiddle =
+        std::min(middleBatchSize, middleSpacePoints.size() - first);
+    executeTasks(m_config.executor, nMiddle, [&](std::size_t i) {
+      candidates[i].middle = middleSpacePoints[first + i];
+      findCandidates(options, tree, candidates[i]);
+    });
+    for (std::size_t i = 0; i < nMiddle; ++i) {
+      processFromMiddleSP(options, out_cont, candidates[i], spacePointData);
+    }
   }
 
   /*
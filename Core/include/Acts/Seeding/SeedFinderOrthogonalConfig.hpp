@@ -12,6 +12,7 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Seeding/SeedConfirmationRangeConfig.hpp"
 #include "Acts/Utilities/Delegate.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <memory>
 
@@ -145,6 +146,10 @@ struct SeedFinderOrthogonalConfig {
   Delegate<bool(float /*bottomRadius*/, float /*cotTheta*/)> experimentCuts{
       DelegateFuncTag<&noopExperimentCuts>{}};
 
+  /// Optional executor for the k-d tree build and the candidate searches of
+  /// the middle space-points; the seeds do not depend on the executor
+  ParallelExecutor executor = {};
+
   bool isInInternalUnits = false;
 
   SeedFinderOrthogonalConfig calculateDerivedQuantities() const {
@@ -0,0 +1,117 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Acts {
+
+class PlaneSurface;
+
+/// @brief A batch of plane surfaces that are intersected together
+///
+/// @c Surface::intersect is a virtual call per surface, which returns
+/// a multi intersection. Navigation calls it for every candidate of a
+/// layer one by one. This class stores the placement and the bounds of
+/// a set of plane surfaces as structure of arrays and intersects one ray
+/// with all of them in a single loop without branches or virtual calls,
+/// which the compiler can vectorize.
+///
+/// Rectangle and trapezoid bounds are checked within the loop, exactly
+/// as @c RectangleBounds and @c TrapezoidBounds do for absolute tolerances.
+/// Other bounds, covariance based checks and trapezoid corners within the
+/// tolerance are resolved with the scalar check of the surface afterwards.
+///
+/// @note The transforms are taken from the geometry context given at
+/// construction, the batch has to be rebuilt for a different alignment.
+class PlaneSurfaceBatch {
+ public:
+  /// The intersections of one ray with the surfaces of a batch
+  struct Intersections {
+    /// The ray start position
+    Vector3 position = Vector3::Zero();
+    /// The ray direction
+    Vector3 direction = Vector3::Zero();
+    /// The path lengths to the surfaces
+    std::vector<ActsScalar> pathLength;
+    /// The local positions on the surfaces
+    std::vector<ActsScalar> loc0;
+    std::vector<ActsScalar> loc1;
+    /// The intersection status, missed if outside of the bounds
+    std::vector<Intersection3D::Status> status;
+    /// The boundary check decision: 0 outside, 1 inside, 2 undecided
+    std::vector<std::uint8_t> boundsDecision;
+  };
+
+  /// Constructor from plane surfaces
+  ///
+  /// @param gctx the geometry context for the surface transforms
+  /// @param surfaces the surfaces of the batch
+  PlaneSurfaceBatch(const GeometryContext& gctx,
+                    std::vector<const PlaneSurface*> surfaces);
+
+  /// @return the number of surfaces in the batch
+  std::size_t size() const { return m_surfaces.size(); }
+
+  /// @return the surfaces of the batch
+  const std::vector<const PlaneSurface*>& surfaces() const {
+    return m_surfaces;
+  }
+
+  /// Intersect a ray with all surfaces of the batch
+  ///
+  /// @param position the start position of the ray
+  /// @param direction the direction of the ray
+  /// @param bcheck the boundary check directive
+  /// @param tolerance the tolerance for the on-surface status
+  /// @param intersections [out] the intersections, resized to the batch
+  void intersect(const Vector3& position, const Vector3& direction,
+                 const BoundaryCheck& bcheck, ActsScalar tolerance,
+                 Intersections& intersections) const;
+
+  /// Create the surface intersection of a surface of the batch, equal to
+  /// the first solution of @c Surface::intersect
+  ///
+  /// @param intersections the intersections of the batch
+  /// @param index the index of the surface in the batch
+  SurfaceIntersection intersection(const Intersections& intersections,
+                                   std::size_t index) const;
+
+ private:
+  /// The surfaces
+  std::vector<const PlaneSurface*> m_surfaces;
+
+  /// The surface centers
+  std::vector<ActsScalar> m_cx, m_cy, m_cz;
+  /// The local x axes
+  std::vector<ActsScalar> m_ux, m_uy, m_uz;
+  /// The local y axes
+  std::vector<ActsScalar> m_vx, m_vy, m_vz;
+  /// The normal vectors
+  std::vector<ActsScalar> m_nx, m_ny, m_nz;
+
+  /// The bounds as trapezoid in the local frame: the center, the half
+  /// length in y, the half length in x at the center with the slope in y,
+  /// and the smaller and larger half length in x
+  std::vector<ActsScalar> m_bx, m_by, m_bhy, m_bhx, m_bslope, m_bhxMin,
+      m_bhxMax;
+  /// The surfaces with bounds that can only be checked by the surface
+  std::vector<std::uint8_t> m_generic;
+};
+
+}  // namespace Acts
@@ -181,6 +181,16 @@ class Surface : public virtual GeometryObject,
   /// @return the contextual transform
   virtual const Transform3& transform(const GeometryContext& gctx) const;
 
+  /// Return method for the inverse of the surface Transform3
+  /// The inverse is cached for surfaces that own their transform, in case
+  /// a detector element is associated it is forwarded to the detector
+  /// element, which can cache it per alignment context
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  ///
+  /// @return the inverse contextual transform
+  virtual Transform3 inverseTransform(const GeometryContext& gctx) const;
+
   /// Return method for the surface center by reference
   /// @note the center is always recalculated in order to not keep a cache
   ///
@@ -472,6 +482,10 @@ class Surface : public virtual GeometryObject,
   /// (translation, rotation) the surface in global space
   Transform3 m_transform = Transform3::Identity();
 
+  /// The cached inverse of m_transform, has to be updated whenever
+  /// m_transform is changed
+  Transform3 m_inverseTransform = Transform3::Identity();
+
   /// Pointer to the a DetectorElementBase
   const DetectorElementBase* m_associatedDetElement{nullptr};
 
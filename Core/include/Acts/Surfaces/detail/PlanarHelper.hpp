@@ -11,11 +11,26 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 
+#include <cmath>
+
 namespace Acts {
 
 /// @brief Helpers for planar surfaces that share the same maths
 namespace PlanarHelper {
 
+/// Status of an intersection with a planar surface
+///
+/// @param path The path length to the surface
+/// @param tolerance The tolerance for the on-surface status
+///
+/// @return onSurface within the tolerance, reachable otherwise
+inline Intersection3D::Status intersectionStatus(ActsScalar path,
+                                                 ActsScalar tolerance) {
+  return std::abs(path) < std::abs(tolerance)
+             ? Intersection3D::Status::onSurface
+             : Intersection3D::Status::reachable;
+}
+
 /// Intersection with a planar surface
 ///
 /// @param transform The 3D affine transform that places the surface
@@ -37,9 +52,7 @@ inline Intersection3D intersect(const Transform3& transform,
     // Translate that into a path
     ActsScalar path = (pnormal.dot((pcenter - position))) / (denom);
     // Is valid hence either on surface or reachable
-    Intersection3D::Status status = std::abs(path) < std::abs(tolerance)
-                                        ? Intersection3D::Status::onSurface
-                                        : Intersection3D::Status::reachable;
+    Intersection3D::Status status = intersectionStatus(path, tolerance);
     // Return the intersection
     return Intersection3D{(position + path * direction), path, status};
   }
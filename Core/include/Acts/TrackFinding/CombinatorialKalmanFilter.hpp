@@ -88,6 +88,8 @@ struct CombinatorialKalmanFilterExtensions {
           candidate_container_t& trackStates, bool&, const Logger&)>;
   using BranchStopper = Delegate<bool(const CombinatorialKalmanFilterTipState&,
                                       typename traj_t::TrackStateProxy&)>;
+  using SourceLinkPreSelector =
+      Delegate<bool(const BoundTrackParameters&, const SourceLink&)>;
 
   /// The Calibrator is a dedicated calibration algorithm that allows
   /// to calibrate measurements using track information, this could be
@@ -103,6 +105,14 @@ struct CombinatorialKalmanFilterExtensions {
   /// The measurement selector is called during the filtering by the Actor.
   MeasurementSelector measurementSelector;
 
+  /// The optional source link pre-selector is called with the predicted
+  /// parameters for each source link on a surface before a track state is
+  /// created and calibrated for it. Source links it rejects are skipped,
+  /// unless all of them are rejected, in which case all are passed on so the
+  /// measurement selector can still pick an outlier. It should therefore
+  /// only reject source links that the measurement selector would reject.
+  SourceLinkPreSelector sourceLinkPreSelector;
+
   BranchStopper branchStopper;
 
   /// Default constructor which connects the default void components
@@ -889,7 +899,10 @@ class CombinatorialKalmanFilter {
                                      std::size_t prevTip,
                                      source_link_iterator_t slBegin,
                                      source_link_iterator_t slEnd) const {
-      const auto& [boundParams, jacobian, pathLength] = boundState;
+      // no structured bindings, they can not be captured before C++20
+      const auto& boundParams = std::get<0>(boundState);
+      const auto& jacobian = std::get<1>(boundState);
+      const double pathLength = std::get<2>(boundState);
 
       result.trackStateCandidates.clear();
       if constexpr (std::is_same_v<
@@ -903,16 +916,14 @@ class CombinatorialKalmanFilter {
 
       using PM = TrackStatePropMask;
 
-      // Calibrate all the source links on the surface since the selection has
-      // to be done based on calibrated measurement
-      for (auto it = slBegin; it != slEnd; ++it) {
-        // get the source link
-        const auto sourceLink = *it;
+      // Add a track state for a source link to the candidates
+      auto addCandidate = [&](const SourceLink& sourceLink) {
+        const bool first = result.trackStateCandidates.empty();
 
         // prepare the track state
         PM mask = PM::Predicted | PM::Jacobian | PM::Calibrated;
 
-        if (it != slBegin) {
+        if (!first) {
           // not the first TrackState, only need uncalibrated and calibrated
           mask = PM::Calibrated;
         }
@@ -927,7 +938,7 @@ class CombinatorialKalmanFilter {
         // fail!
         auto ts = result.stateBuffer->getTrackState(tsi);
 
-        if (it == slBegin) {
+        if (first) {
           // only set these for first
           ts.predicted() = boundParams.parameters();
           if (boundParams.covariance()) {
@@ -936,9 +947,9 @@ class CombinatorialKalmanFilter {
           ts.jacobian() = jacobian;
         } else {
           // subsequent track states can reuse
-          auto& first = result.trackStateCandidates.front();
-          ts.shareFrom(first, PM::Predicted);
-          ts.shareFrom(first, PM::Jacobian);
+          auto& firstTrackState = result.trackStateCandidates.front();
+          ts.shareFrom(firstTrackState, PM::Predicted);
+          ts.shareFrom(firstTrackState, PM::Jacobian);
         }
 
         ts.pathLength() = pathLength;
@@ -949,6 +960,27 @@ class CombinatorialKalmanFilter {
         m_extensions.calibrator(gctx, calibrationContext, sourceLink, ts);
 
         result.trackStateCandidates.push_back(ts);
+      };
+
+      // Calibrate all the source links on the surface since the selection has
+      // to be done based on calibrated measurement. If a pre-selector is
+      // given, track states are only created for the source links passing it
+      const bool preSelect = m_extensions.sourceLinkPreSelector.connected();
+      for (auto it = slBegin; it != slEnd; ++it) {
+        // get the source link
+        const auto sourceLink = *it;
+        if (preSelect &&
+            !m_extensions.sourceLinkPreSelector(boundParams, sourceLink)) {
+          continue;
+        }
+        addCandidate(sourceLink);
+      }
+
+      if (preSelect && result.trackStateCandidates.empty()) {
+        ACTS_VERBOSE("No source link passed the pre-selection, use all");
+        for (auto it = slBegin; it != slEnd; ++it) {
+          addCandidate(*it);
+        }
       }
     }
 
@@ -19,11 +19,13 @@
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <iterator>
 #include <limits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace Acts {
@@ -205,6 +207,56 @@ class MeasurementSelector {
     return std::pair{candidates.begin(), trackStateIterEnd};
   }
 
+  /// @brief Function that checks if a measurement can be compatible with
+  /// the given track parameter on a surface, before a track state is created
+  ///
+  /// The chi2 of the measurement is compared to the largest chi2 cut of the
+  /// surface. Measurements failing it are rejected by @c select as well,
+  /// which allows to use this as source link pre-selection in the CKF.
+  ///
+  /// @param predicted The predicted track parameters on the surface
+  /// @param measurement The measurement on the surface
+  ///
+  /// @return false if the measurement can not be selected
+  template <typename indices_t, std::size_t kSize>
+  bool isCompatible(const BoundTrackParameters& predicted,
+                    const Measurement<indices_t, kSize>& measurement) const {
+    auto cuts = m_config.find(predicted.referenceSurface().geometryId());
+    if (cuts == m_config.end() || !predicted.covariance().has_value()) {
+      // leave the decision to the selection
+      return true;
+    }
+    const auto& chi2CutOff = cuts->chi2CutOff;
+    const double maxChi2Cut =
+        *std::max_element(chi2CutOff.begin(), chi2CutOff.end());
+
+    const auto H = measurement.projector();
+    const ActsVector<kSize> res =
+        measurement.parameters() - H * predicted.parameters();
+    const double chi2 =
+        (res.transpose() *
+         (measurement.covariance() +
+          H * (*predicted.covariance()) * H.transpose())
+             .inverse() *
+         res)
+            .eval()(0, 0);
+    return chi2 < maxChi2Cut;
+  }
+
+  /// @brief Function that checks if a measurement can be compatible with
+  /// the given track parameter on a surface, before a track state is created
+  ///
+  /// @param predicted The predicted track parameters on the surface
+  /// @param measurement The measurement on the surface
+  ///
+  /// @return false if the measurement can not be selected
+  bool isCompatible(const BoundTrackParameters& predicted,
+                    const BoundVariantMeasurement& measurement) const {
+    return std::visit(
+        [&](const auto& meas) { return isCompatible(predicted, meas); },
+        measurement);
+  }
+
  private:
   template <typename traj_t, typename cut_value_t>
   static cut_value_t VariableCut(
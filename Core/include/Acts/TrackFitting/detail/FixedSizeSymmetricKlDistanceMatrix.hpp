@@ -0,0 +1,210 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Acts::detail {
+
+/// @brief Symmetric KL-distance matrix with a compile-time capacity
+///
+/// Drop-in replacement for @c SymmetricKLDistanceMatrix with the same
+/// interface, but without any internal heap allocation. Large capacities
+/// take tens of kilobytes, @c reduceWithKLDistance therefore only keeps
+/// small matrices on the stack. The q/p values and variances
+/// of the components are cached in contiguous arrays, so that a full row of
+/// distances can be computed with vectorized array operations. Additionally
+/// the minimum of each row is cached, so that finding the closest pair only
+/// requires a scan over the rows and a merge step only touches the row and
+/// column of the affected components.
+///
+/// The distances are stored as a packed lower triangular matrix, with the
+/// same index layout and tie-breaking as @c SymmetricKLDistanceMatrix, so
+/// both produce identical merge sequences.
+///
+/// @tparam N the maximum number of components
+template <std::size_t N>
+class FixedSizeSymmetricKLDistanceMatrix {
+  static_assert(N >= 2, "Need space for at least two components");
+
+  using ArrayMap = Eigen::Map<Eigen::Array<ActsScalar, Eigen::Dynamic, 1>>;
+  using ConstArrayMap =
+      Eigen::Map<const Eigen::Array<ActsScalar, Eigen::Dynamic, 1>>;
+
+  static constexpr ActsScalar s_masked =
+      std::numeric_limits<ActsScalar>::infinity();
+
+  // Packed lower triangular matrix, row i starts at i * (i - 1) / 2
+  std::array<ActsScalar, N * (N - 1) / 2> m_distances;
+
+  // Structure of arrays for the q/p-dimension of the components
+  std::array<ActsScalar, N> m_qop;
+  std::array<ActsScalar, N> m_var;
+  std::array<ActsScalar, N> m_invVar;
+  // Is zero for active components and infinity for masked ones, so that it
+  // can simply be added to a computed distance
+  std::array<ActsScalar, N> m_penalty;
+
+  // Cached minimum of each row
+  std::array<ActsScalar, N> m_rowMin;
+  std::array<std::size_t, N> m_rowArgMin;
+
+  std::size_t m_numberComponents = 0;
+
+  static constexpr std::size_t rowOffset(std::size_t i) {
+    return i * (i - 1) / 2;
+  }
+
+  template <typename component_t, typename projector_t>
+  void cacheComponent(std::size_t i, const component_t &cmp,
+                      const projector_t &proj) {
+    const auto &c = proj(cmp);
+    m_qop[i] = c.boundPars[eBoundQOverP];
+    m_var[i] = c.boundCov(eBoundQOverP, eBoundQOverP);
+
+    assert(m_var[i] != 0.0);
+    assert(std::isfinite(m_var[i]));
+
+    m_invVar[i] = 1.0 / m_var[i];
+  }
+
+  /// Computes the distances of component @p i to all components [0, n)
+  /// in a vectorized way and writes them to @p out
+  void computeDistances(std::size_t i, std::size_t n, ArrayMap out) const {
+    ConstArrayMap qop(m_qop.data(), n);
+    ConstArrayMap var(m_var.data(), n);
+    ConstArrayMap invVar(m_invVar.data(), n);
+    ConstArrayMap penalty(m_penalty.data(), n);
+
+    const auto dq = qop - m_qop[i];
+    out = m_var[i] * invVar + var * m_invVar[i] +
+          dq.square() * (m_invVar[i] + invVar) + penalty + m_penalty[i];
+  }
+
+  void rescanRow(std::size_t i) {
+    if (i == 0) {
+      m_rowMin[0] = s_masked;
+      m_rowArgMin[0] = 0;
+      return;
+    }
+
+    ConstArrayMap row(m_distances.data() + rowOffset(i), i);
+    Eigen::Index idx = 0;
+    m_rowMin[i] = row.minCoeff(&idx);
+    m_rowArgMin[i] = static_cast<std::size_t>(idx);
+  }
+
+  /// Updates the cached minimum of row @p k > @p n after the entry (k, n)
+  /// has been changed
+  void updateRowAfterChange(std::size_t k, std::size_t n) {
+    const auto d = m_distances[rowOffset(k) + n];
+
+    if (m_rowArgMin[k] == n) {
+      if (d <= m_rowMin[k]) {
+        m_rowMin[k] = d;
+      } else {
+        rescanRow(k);
+      }
+    } else if (d < m_rowMin[k] || (d == m_rowMin[k] && n < m_rowArgMin[k])) {
+      m_rowMin[k] = d;
+      m_rowArgMin[k] = n;
+    }
+  }
+
+ public:
+  static constexpr std::size_t capacity() { return N; }
+
+  template <typename component_t, typename projector_t>
+  FixedSizeSymmetricKLDistanceMatrix(const std::vector<component_t> &cmps,
+                                     const projector_t &proj)
+      : m_numberComponents(cmps.size()) {
+    assert(cmps.size() <= N && "too many components for fixed size matrix");
+
+    for (auto i = 0ul; i < m_numberComponents; ++i) {
+      cacheComponent(i, cmps[i], proj);
+      m_penalty[i] = 0.0;
+    }
+
+    for (auto i = 1ul; i < m_numberComponents; ++i) {
+      computeDistances(i, i, ArrayMap(m_distances.data() + rowOffset(i), i));
+    }
+
+    for (auto i = 0ul; i < m_numberComponents; ++i) {
+      rescanRow(i);
+    }
+  }
+
+  auto at(std::size_t i, std::size_t j) const {
+    return m_distances[rowOffset(i) + j];
+  }
+
+  template <typename component_t, typename projector_t>
+  void recomputeAssociatedDistances(std::size_t n,
+                                    const std::vector<component_t> &cmps,
+                                    const projector_t &proj) {
+    assert(cmps.size() == m_numberComponents && "size mismatch");
+
+    cacheComponent(n, cmps[n], proj);
+
+    // Compute the full row and column at once and scatter it afterwards
+    std::array<ActsScalar, N> buffer;
+    computeDistances(n, m_numberComponents,
+                     ArrayMap(buffer.data(), m_numberComponents));
+
+    std::copy(buffer.begin(), buffer.begin() + n,
+              m_distances.begin() + rowOffset(n));
+    rescanRow(n);
+
+    for (auto k = n + 1; k < m_numberComponents; ++k) {
+      m_distances[rowOffset(k) + n] = buffer[k];
+      updateRowAfterChange(k, n);
+    }
+  }
+
+  void maskAssociatedDistances(std::size_t n) {
+    m_penalty[n] = s_masked;
+
+    std::fill_n(m_distances.begin() + rowOffset(n), n, s_masked);
+    m_rowMin[n] = s_masked;
+    m_rowArgMin[n] = 0;
+
+    for (auto k = n + 1; k < m_numberComponents; ++k) {
+      m_distances[rowOffset(k) + n] = s_masked;
+      if (m_rowArgMin[k] == n) {
+        rescanRow(k);
+      }
+    }
+  }
+
+  std::pair<std::size_t, std::size_t> minDistancePair() const {
+    auto min = std::numeric_limits<ActsScalar>::max();
+    std::size_t row = 1;
+
+    for (auto i = 1ul; i < m_numberComponents; ++i) {
+      if (m_rowMin[i] < min) {
+        min = m_rowMin[i];
+        row = i;
+      }
+    }
+
+    return {row, m_rowArgMin[row]};
+  }
+};
+
+}  // namespace Acts::detail
@@ -14,6 +14,8 @@
 #include "Acts/TrackFitting/detail/GsfComponentMerging.hpp"
 #include "Acts/TrackFitting/detail/GsfUtils.hpp"
 
+#include <memory>
+
 namespace Acts::detail {
 
 /// Computes the Kullback-Leibler distance between two components as shown in
@@ -171,4 +173,76 @@ class SymmetricKLDistanceMatrix {
   }
 };
 
+/// Distance matrices larger than this are allocated on the heap to keep the
+/// stack usage bounded
+constexpr std::size_t s_maxStackDistanceMatrixSize = 32 * 1024;
+
+/// Greedy reduction of a component mixture with a given distance matrix
+/// @param distances the distance matrix, initialized from @p cmpCache
+/// @param cmpCache the component collection
+/// @param maxCmpsAfterMerge the number of components we want to reach
+/// @param proj the projector to access the components' properties
+/// @param desc the angle description of the surface
+template <typename distance_matrix_t, typename component_t, typename proj_t,
+          typename angle_desc_t>
+void reduceWithDistanceMatrix(distance_matrix_t &distances,
+                              std::vector<component_t> &cmpCache,
+                              std::size_t maxCmpsAfterMerge,
+                              const proj_t &proj, const angle_desc_t &desc) {
+  auto remainingComponents = cmpCache.size();
+
+  while (remainingComponents > maxCmpsAfterMerge) {
+    const auto [minI, minJ] = distances.minDistancePair();
+
+    // Set one component and compute associated distances
+    cmpCache[minI] =
+        mergeComponents(cmpCache[minI], cmpCache[minJ], proj, desc);
+    distances.recomputeAssociatedDistances(minI, cmpCache, proj);
+
+    // Set weight of the other component to -1 so we can remove it later and
+    // mask its distances
+    proj(cmpCache[minJ]).weight = -1.0;
+    distances.maskAssociatedDistances(minJ);
+
+    remainingComponents--;
+  }
+
+  // Remove all components which are labeled with weight -1
+  std::sort(cmpCache.begin(), cmpCache.end(),
+            [&](const auto &a, const auto &b) {
+              return proj(a).weight < proj(b).weight;
+            });
+  cmpCache.erase(
+      std::remove_if(cmpCache.begin(), cmpCache.end(),
+                     [&](const auto &a) { return proj(a).weight == -1.0; }),
+      cmpCache.end());
+
+  assert(cmpCache.size() == maxCmpsAfterMerge && "size mismatch");
+}
+
+/// Greedy reduction of a component mixture based on the symmetric
+/// KL-distance in the q/p-dimension
+/// @tparam distance_matrix_t the distance matrix implementation, either
+///         @c SymmetricKLDistanceMatrix or
+///         @c FixedSizeSymmetricKLDistanceMatrix
+/// @param cmpCache the component collection
+/// @param maxCmpsAfterMerge the number of components we want to reach
+/// @param proj the projector to access the components' properties
+/// @param desc the angle description of the surface
+template <typename distance_matrix_t, typename component_t, typename proj_t,
+          typename angle_desc_t>
+void reduceWithKLDistance(std::vector<component_t> &cmpCache,
+                          std::size_t maxCmpsAfterMerge, const proj_t &proj,
+                          const angle_desc_t &desc) {
+  if constexpr (sizeof(distance_matrix_t) > s_maxStackDistanceMatrixSize) {
+    auto distances = std::make_unique<distance_matrix_t>(cmpCache, proj);
+    reduceWithDistanceMatrix(*distances, cmpCache, maxCmpsAfterMerge, proj,
+                             desc);
+  } else {
+    distance_matrix_t distances(cmpCache, proj);
+    reduceWithDistanceMatrix(distances, cmpCache, maxCmpsAfterMerge, proj,
+                             desc);
+  }
+}
+
 }  // namespace Acts::detail
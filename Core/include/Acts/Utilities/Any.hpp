@@ -18,6 +18,7 @@
 // #define _ACTS_ANY_ENABLE_VERBOSE
 // #define _ACTS_ANY_ENABLE_DEBUG
 // #define _ACTS_ANY_ENABLE_TRACK_ALLOCATIONS
+// #define _ACTS_ANY_ENABLE_COUNT_ALLOCATIONS
 
 #if defined(_ACTS_ANY_ENABLE_TRACK_ALLOCATIONS)
 #include <iostream>
@@ -27,6 +28,10 @@
 #include <typeinfo>
 #endif
 
+#if defined(_ACTS_ANY_ENABLE_COUNT_ALLOCATIONS)
+#include <atomic>
+#endif
+
 #if defined(_ACTS_ANY_ENABLE_VERBOSE) || defined(_ACTS_ANY_ENABLE_DEBUG)
 #include <iomanip>
 #include <iostream>
@@ -55,6 +60,48 @@
 
 namespace Acts {
 
+#if defined(_ACTS_ANY_ENABLE_COUNT_ALLOCATIONS)
+/// Number of objects which did not fit into the local buffer of an
+/// @c AnyBase, of any size, and were allocated on the heap instead
+struct AnyHeapAllocations {
+  /// Number of heap allocations
+  std::size_t allocations = 0;
+  /// Number of heap deallocations
+  std::size_t deallocations = 0;
+};
+
+namespace detail {
+inline std::atomic<std::size_t> s_anyHeapAllocations{0};
+inline std::atomic<std::size_t> s_anyHeapDeallocations{0};
+}  // namespace detail
+
+/// Get the heap allocation counters of all @c AnyBase instances.
+///
+/// Only available if @c _ACTS_ANY_ENABLE_COUNT_ALLOCATIONS is defined. The
+/// counters are only touched when an object is allocated on the heap. This
+/// can be used to verify that e.g. no source link spills.
+///
+/// @return the counters accumulated since the start of the program
+inline AnyHeapAllocations anyHeapAllocations() {
+  AnyHeapAllocations counters;
+  counters.allocations = detail::s_anyHeapAllocations.load();
+  counters.deallocations = detail::s_anyHeapDeallocations.load();
+  return counters;
+}
+
+#define _ACTS_ANY_COUNT_ALLOCATION() \
+  detail::s_anyHeapAllocations.fetch_add(1, std::memory_order_relaxed)
+#define _ACTS_ANY_COUNT_DEALLOCATION() \
+  detail::s_anyHeapDeallocations.fetch_add(1, std::memory_order_relaxed)
+#else
+#define _ACTS_ANY_COUNT_ALLOCATION() \
+  do {                               \
+  } while (0)
+#define _ACTS_ANY_COUNT_DEALLOCATION() \
+  do {                                 \
+  } while (0)
+#endif
+
 #if defined(_ACTS_ANY_ENABLE_TRACK_ALLOCATIONS)
 static std::mutex _s_any_mutex;
 static std::set<std::pair<std::type_index, void*>> _s_any_allocations;
@@ -131,6 +178,7 @@ class AnyBase : public AnyBaseAll {
       // too large, heap allocate
       U* heap = new U(std::forward<Args>(args)...);
       _ACTS_ANY_TRACK_ALLOCATION(T, heap);
+      _ACTS_ANY_COUNT_ALLOCATION();
       setDataPtr(heap);
     }
   }
@@ -251,6 +299,13 @@ class AnyBase : public AnyBaseAll {
     return m_handler != nullptr;
   }
 
+  /// @tparam T the type to check
+  /// @return true if @p T is stored in the local buffer without allocating
+  template <typename T>
+  static constexpr bool fitsLocally() {
+    return !heapAllocated<std::decay_t<T>>();
+  }
+
  private:
   void* dataPtr() {
     if (m_handler->heapAllocated) {
@@ -434,6 +489,7 @@ class AnyBase : public AnyBaseAll {
                                       << " heap at: " << obj);
       _ACTS_ANY_TRACK_DEALLOCATION(T, obj);
       delete obj;
+      _ACTS_ANY_COUNT_DEALLOCATION();
     }
   }
 
@@ -467,6 +523,7 @@ class AnyBase : public AnyBaseAll {
       assert(heapAllocated<T>() && "Received nullptr in local buffer case");
       to = new T(*_from);
       _ACTS_ANY_TRACK_ALLOCATION(T, to);
+      _ACTS_ANY_COUNT_ALLOCATION();
 
     } else {
       assert(!heapAllocated<T>() && "Received non-nullptr in heap case");
@@ -510,5 +567,7 @@ using Any = AnyBase<sizeof(void*)>;
 #undef _ACTS_ANY_VERBOSE
 #undef _ACTS_ANY_VERBOSE_BUFFER
 #undef _ACTS_ANY_ENABLE_VERBOSE
+#undef _ACTS_ANY_COUNT_ALLOCATION
+#undef _ACTS_ANY_COUNT_DEALLOCATION
 
 }  // namespace Acts
@@ -0,0 +1,347 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/DBScan.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @brief A DBScan clustering using a uniform grid for the neighbour search.
+///
+/// This is an alternative to @c Acts::DBScan for low dimensional inputs. The
+/// points are binned into a uniform grid with a cell size of epsilon, so all
+/// the neighbours of a point are found in the 3^kDims cells around it. The
+/// clustering then runs in three passes:
+///
+/// 1. The core points, with at least minPoints points (including themself)
+///    within the epsilon radius, are found. Every point is independent and
+///    the pass can be run concurrently with an executor.
+/// 2. Core points within the epsilon radius of each other are merged with a
+///    union-find.
+/// 3. Every other point is attached to the cluster of its first core
+///    neighbour or is left as noise. This pass can run concurrently as well.
+///
+/// The clusters are numbered in the order of their first point, and the
+/// result does not depend on the executor. The core points are clustered as
+/// in the textbook DBScan; in contrast to @c Acts::DBScan, points which are
+/// not core points never add their own neighbours to a cluster.
+///
+/// @tparam kDims The number of dimensions.
+/// @tparam scalar_t The scalar type used to construct position vectors.
+template <std::size_t kDims, typename scalar_t = double>
+class GridDBScan {
+ public:
+  // The type of coordinates for points.
+  using Point = std::array<scalar_t, kDims>;
+
+  // The type of a vector of coordinate.
+  using VectorPoints = std::vector<Point>;
+
+  // Remove the default constructor.
+  GridDBScan() = delete;
+
+  /// @brief Construct the DBScan algorithm with a given epsilon and minPoints.
+  ///
+  /// @param epsilon The epsilon radius used to find the neighbours.
+  /// @param minPoints The minimum number of points to form a cluster.
+  /// @param onePointCluster If true, all the noise points are considered as
+  /// individual one point clusters.
+  /// @param executor Optional executor for the neighbour searches
+  GridDBScan(scalar_t epsilon = 1.0, std::size_t minPoints = 1,
+             bool onePointCluster = false, ParallelExecutor executor = {})
+      : m_eps(epsilon),
+        m_minPoints(minPoints),
+        m_onePointCluster(onePointCluster),
+        m_executor(std::move(executor)) {}
+
+  /// @brief Cluster the input points.
+  ///
+  /// @param inputPoints The input points to cluster.
+  /// @param clusteredPoints Vector containing the cluster ID of each point.
+  /// @return The number of clusters (excluding noise if
+  /// onePointCluster==False).
+  int cluster(const VectorPoints& inputPoints,
+              std::vector<int>& clusteredPoints) const {
+    const std::size_t nPoints = inputPoints.size();
+    const Grid grid = buildGrid(inputPoints);
+
+    // Find the core points, stop counting once there are enough neighbours
+    std::vector<char> isCore(nPoints, 0);
+    executeTasks(m_executor, nPoints, [&](std::size_t id) {
+      std::size_t nNeighbours = 0;
+      forEachNeighbour(grid, inputPoints, id, [&](std::size_t) {
+        return ++nNeighbours < m_minPoints;
+      });
+      isCore[id] = nNeighbours >= m_minPoints;
+    });
+
+    // Merge the core points within the epsilon radius
+    std::vector<std::size_t> parent(nPoints);
+    std::iota(parent.begin(), parent.end(), 0u);
+    for (std::size_t id = 0; id < nPoints; ++id) {
+      if (isCore[id] == 0) {
+        continue;
+      }
+      std::size_t root = findRoot(parent, id);
+      auto merge = [&](std::size_t other) {
+        if (isCore[other] != 0) {
+          // link the larger root to the smaller one
+          std::size_t otherRoot = findRoot(parent, other);
+          if (otherRoot < root) {
+            std::swap(root, otherRoot);
+          }
+          parent[otherRoot] = root;
+        }
+        return true;
+      };
+      forEachNeighbour(grid, inputPoints, id, merge, true);
+    }
+
+    // Attach the other points to their first core neighbour
+    std::vector<std::size_t> attachedTo(nPoints, s_noise);
+    executeTasks(m_executor, nPoints, [&](std::size_t id) {
+      if (isCore[id] != 0) {
+        attachedTo[id] = id;
+        return;
+      }
+      forEachNeighbour(grid, inputPoints, id, [&](std::size_t other) {
+        if (isCore[other] != 0 && other < attachedTo[id]) {
+          attachedTo[id] = other;
+        }
+        return true;
+      });
+    });
+
+    // Number the clusters in the order of their first point
+    int clusterID = 0;
+    clusteredPoints.assign(nPoints, -1);
+    std::vector<int> rootClusterID(nPoints, -1);
+    for (std::size_t id = 0; id < nPoints; ++id) {
+      if (attachedTo[id] == s_noise) {
+        continue;
+      }
+      int& rootID = rootClusterID[findRoot(parent, attachedTo[id])];
+      if (rootID == -1) {
+        rootID = clusterID++;
+      }
+      clusteredPoints[id] = rootID;
+    }
+    if (m_onePointCluster) {
+      // All the noise points are individual one point clusters
+      for (auto& cluster : clusteredPoints) {
+        if (cluster == -1) {
+          cluster = clusterID++;
+        }
+      }
+    }
+    return clusterID;
+  }
+
+ private:
+  using Cell = std::array<std::int64_t, kDims>;
+
+  struct CellHash {
+    std::size_t operator()(const Cell& cell) const {
+      std::uint64_t hash = 0xcbf29ce484222325u;
+      for (auto index : cell) {
+        hash = (hash ^ static_cast<std::uint64_t>(index)) * 0x100000001b3u;
+      }
+      return static_cast<std::size_t>(hash);
+    }
+  };
+
+  /// The points sorted by grid cell
+  struct Grid {
+    /// The cell index of each point
+    std::vector<std::size_t> pointCells;
+    /// The point indices, the points of one cell are consecutive
+    std::vector<std::size_t> sortedPoints;
+    /// The point coordinates in the same order
+    VectorPoints sortedPositions;
+    /// The first sorted point of each cell, with one extra entry at the end
+    std::vector<std::size_t> cellBegins;
+    /// The non-empty cells around each cell in compressed rows, including
+    /// the cell itself
+    std::vector<std::size_t> neighbourBegins;
+    std::vector<std::size_t> neighbourCells;
+  };
+
+  static constexpr std::size_t s_noise =
+      std::numeric_limits<std::size_t>::max();
+
+  Grid buildGrid(const VectorPoints& inputPoints) const {
+    // Any cell size at least epsilon works, a zero epsilon only finds
+    // identical points which are in the same cell for any cell size
+    const scalar_t cellSize = m_eps > 0 ? m_eps : scalar_t{1};
+    const std::size_t nPoints = inputPoints.size();
+
+    // Sort the points by cell, and by index within a cell
+    std::vector<std::pair<Cell, std::size_t>> cells;
+    cells.reserve(nPoints);
+    for (std::size_t id = 0; id < nPoints; ++id) {
+      Cell cell{};
+      for (std::size_t dim = 0; dim < kDims; ++dim) {
+        cell[dim] = static_cast<std::int64_t>(
+            std::floor(inputPoints[id][dim] / cellSize));
+      }
+      cells.emplace_back(cell, id);
+    }
+    std::sort(cells.begin(), cells.end());
+
+    // Number the non-empty cells in the sorted order
+    Grid grid;
+    std::unordered_map<Cell, std::size_t, CellHash> cellIndices;
+    cellIndices.reserve(nPoints);
+    grid.pointCells.resize(nPoints);
+    grid.sortedPoints.reserve(nPoints);
+    grid.sortedPositions.reserve(nPoints);
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      const auto& [cell, id] = cells[i];
+      if (i == 0 || cell != cells[i - 1].first) {
+        cellIndices.emplace(cell, grid.cellBegins.size());
+        grid.cellBegins.push_back(i);
+      }
+      grid.pointCells[id] = grid.cellBegins.size() - 1;
+      grid.sortedPoints.push_back(id);
+      grid.sortedPositions.push_back(inputPoints[id]);
+    }
+    grid.cellBegins.push_back(nPoints);
+
+    // Look up the neighbour cells once per cell instead of once per point
+    constexpr std::size_t nNeighbourCells = [] {
+      std::size_t n = 1;
+      for (std::size_t dim = 0; dim < kDims; ++dim) {
+        n *= 3;
+      }
+      return n;
+    }();
+    const std::size_t nCells = grid.cellBegins.size() - 1;
+    grid.neighbourBegins.reserve(nCells + 1);
+    for (std::size_t iCell = 0; iCell < nCells; ++iCell) {
+      grid.neighbourBegins.push_back(grid.neighbourCells.size());
+      const Cell& center = cells[grid.cellBegins[iCell]].first;
+      for (std::size_t iOffset = 0; iOffset < nNeighbourCells; ++iOffset) {
+        // Decode the cell offsets in {-1, 0, 1} from the base 3 digits
+        Cell cell = center;
+        for (std::size_t dim = 0, rest = iOffset; dim < kDims;
+             ++dim, rest /= 3) {
+          cell[dim] += static_cast<std::int64_t>(rest % 3) - 1;
+        }
+        auto it = cellIndices.find(cell);
+        if (it != cellIndices.end()) {
+          grid.neighbourCells.push_back(it->second);
+        }
+      }
+    }
+    grid.neighbourBegins.push_back(grid.neighbourCells.size());
+    return grid;
+  }
+
+  /// Call @p visit for every point within the epsilon radius of point @p id,
+  /// including the point itself, until it returns false.
+  ///
+  /// With @p onlyPairedOnce only the neighbours in later cells and the
+  /// neighbours with a larger index in the same cell are visited, so every
+  /// pair of points is only visited from one side.
+  template <typename visitor_t>
+  void forEachNeighbour(const Grid& grid, const VectorPoints& inputPoints,
+                        std::size_t id, visitor_t&& visit,
+                        bool onlyPairedOnce = false) const {
+    const Point& point = inputPoints[id];
+    const std::size_t center = grid.pointCells[id];
+    for (std::size_t n = grid.neighbourBegins[center];
+         n < grid.neighbourBegins[center + 1]; ++n) {
+      const std::size_t iCell = grid.neighbourCells[n];
+      if (onlyPairedOnce && iCell < center) {
+        continue;
+      }
+      for (std::size_t i = grid.cellBegins[iCell];
+           i < grid.cellBegins[iCell + 1]; ++i) {
+        if (onlyPairedOnce && iCell == center && grid.sortedPoints[i] <= id) {
+          continue;
+        }
+        const Point& other = grid.sortedPositions[i];
+        scalar_t distance = 0;
+        for (std::size_t dim = 0; dim < kDims; ++dim) {
+          distance += (other[dim] - point[dim]) * (other[dim] - point[dim]);
+        }
+        if (distance <= m_eps * m_eps && !visit(grid.sortedPoints[i])) {
+          return;
+        }
+      }
+    }
+  }
+
+  static std::size_t findRoot(std::vector<std::size_t>& parent,
+                              std::size_t id) {
+    while (parent[id] != id) {
+      // path halving
+      parent[id] = parent[parent[id]];
+      id = parent[id];
+    }
+    return id;
+  }
+
+  // The epsilon radius used to find the neighbours.
+  scalar_t m_eps;
+  // The minimum number of points to form a cluster.
+  std::size_t m_minPoints = 1;
+  // If true, all the noise points are considered as individual one point
+  // clusters.
+  bool m_onePointCluster = false;
+  // The executor for the neighbour searches.
+  ParallelExecutor m_executor;
+};
+
+/// @brief Cluster points with @c Acts::GridDBScan where it gives the same
+/// clusters as @c Acts::DBScan, and with @c Acts::DBScan otherwise.
+///
+/// With up to two points per cluster (minPoints <= 2), every clustered point
+/// is a core point, and both clusterings are identical up to the cluster
+/// numbering. With more points per cluster, @c Acts::DBScan also expands
+/// clusters from points which are not core points, which the grid based
+/// clustering does not do.
+///
+/// @tparam kDims The number of dimensions.
+/// @tparam scalar_t The scalar type used to construct position vectors.
+///
+/// @param inputPoints The input points to cluster.
+/// @param clusteredPoints Vector containing the cluster ID of each point.
+/// @param epsilon The epsilon radius used to find the neighbours.
+/// @param minPoints The minimum number of points to form a cluster.
+/// @param onePointCluster If true, all the noise points are considered as
+/// individual one point clusters.
+/// @return The number of clusters (excluding noise if
+/// onePointCluster==False).
+template <std::size_t kDims, typename scalar_t = double>
+int clusterWithDBScan(
+    const std::vector<std::array<scalar_t, kDims>>& inputPoints,
+    std::vector<int>& clusteredPoints, scalar_t epsilon, std::size_t minPoints,
+    bool onePointCluster = false) {
+  if (minPoints <= 2) {
+    GridDBScan<kDims, scalar_t> dbscan(epsilon, minPoints, onePointCluster);
+    return dbscan.cluster(inputPoints, clusteredPoints);
+  }
+  DBScan<kDims, scalar_t, 4> dbscan(epsilon, minPoints, onePointCluster);
+  return dbscan.cluster(inputPoints, clusteredPoints);
+}
+
+}  // namespace Acts
@@ -8,14 +8,19 @@
 
 #pragma once
 
+#include "Acts/Utilities/ParallelExecutor.hpp"
 #include "Acts/Utilities/RangeXD.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <functional>
-#include <memory>
+#include <iterator>
+#include <limits>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -30,8 +35,9 @@ namespace Acts {
 /// orthogonal hyperplane in one of the k dimensions. This allows us to
 /// efficiently look up points within certain k-dimensional ranges.
 ///
-/// This particular class is mostly a wrapper class around an underlying node
-/// class which does all the actual work.
+/// The nodes are stored in a single contiguous vector and refer to ranges of
+/// the element vector, so the elements of each leaf are stored contiguously.
+/// The nodes of each level of the tree can be split concurrently.
 ///
 /// @note This type is completely immutable after construction.
 ///
@@ -75,22 +81,10 @@ class KDTree {
   ///
   /// @param d The vector of position-value pairs to construct the k-d tree
   /// from.
-  KDTree(vector_t &&d) : m_elems(d) {
-    // To start out, we need to check whether we need to construct a leaf node
-    // or an internal node. We create a leaf only if we have at most as many
-    // elements as the number of elements that can fit into a leaf node.
-    // Hopefully most invocations of this constructor will have more than a few
-    // elements!
-    //
-    // One interesting thing to note is that all of the nodes in the k-d tree
-    // have a range in the element vector of the outermost node. They simply
-    // make in-place changes to this array, and they hold no memory of their
-    // own.
-    m_root = std::make_unique<KDTreeNode>(m_elems.begin(), m_elems.end(),
-                                          m_elems.size() > LeafSize
-                                              ? KDTreeNode::NodeType::Internal
-                                              : KDTreeNode::NodeType::Leaf,
-                                          0UL);
+  /// @param executor Optional executor to split the nodes concurrently.
+  KDTree(vector_t &&d, const ParallelExecutor &executor = {})
+      : m_elems(std::move(d)) {
+    build(executor);
   }
 
   /// @brief Perform an orthogonal range search within the k-d tree.
@@ -252,7 +246,7 @@ class KDTree {
   /// @param f The mapping function to apply to key-value pairs.
   template <typename Callable>
   void rangeSearchMapDiscard(const range_t &r, Callable &&f) const {
-    m_root->rangeSearchMapDiscard(r, std::forward<Callable>(f));
+    rangeSearchMapDiscard(0, r, std::forward<Callable>(f));
   }
 
   /// @brief Return the number of elements in the k-d tree.
@@ -260,7 +254,7 @@ class KDTree {
   /// We simply defer this method to the root node of the k-d tree.
   ///
   /// @return The number of elements in the k-d tree.
-  std::size_t size(void) const { return m_root->size(); }
+  std::size_t size(void) const { return m_nodes.front().size(); }
 
   const_iterator_t begin(void) const { return m_elems.begin(); }
 
@@ -309,194 +303,198 @@ class KDTree {
     return r;
   }
 
-  /// @brief An abstract class containing common features of k-d tree node
-  /// types.
+  /// @brief A node of the k-d tree.
   ///
   /// A k-d tree consists of two different node types: leaf nodes and inner
-  /// nodes. These nodes have some common functionality, which is captured by
-  /// this common parent node type.
-  class KDTreeNode {
-   public:
-    /// @brief Enumeration type for the possible node types (internal and leaf).
-    enum class NodeType { Internal, Leaf };
-
-    /// @brief Construct the common data for all node types.
-    ///
-    /// The node types share a few concepts, like an n-dimensional range, and a
-    /// begin and end of the range of elements managed. This constructor
-    /// calculates these things so that the individual child constructors don't
-    /// have to.
-    KDTreeNode(iterator_t _b, iterator_t _e, NodeType _t, std::size_t _d)
-        : m_type(_t),
-          m_begin_it(_b),
-          m_end_it(_e),
-          m_range(boundingBox(m_begin_it, m_end_it)) {
-      if (m_type == NodeType::Internal) {
-        // This constant determines the maximum number of elements where we
-        // still
-        // calculate the exact median of the values for the purposes of
-        // splitting. In general, the closer the pivot value is to the true
-        // median, the more balanced the tree will be. However, calculating the
-        // median exactly is an O(n log n) operation, while approximating it is
-        // an O(1) time.
-        constexpr std::size_t max_exact_median = 128;
-
-        iterator_t pivot;
-
-        // Next, we need to determine the pivot point of this node, that is to
-        // say the point in the selected pivot dimension along which point we
-        // will split the range. To do this, we check how large the set of
-        // elements is. If it is sufficiently small, we use the median.
-        // Otherwise we use the mean.
-        if (size() > max_exact_median) {
-          // In this case, we have a lot of elements, and sorting the range to
-          // find the true median might be too expensive. Therefore, we will
-          // just use the middle value between the minimum and maximum. This is
-          // not nearly as accurate as using the median, but it's a nice cheat.
-          Scalar mid = static_cast<Scalar>(0.5) *
-                       (m_range[_d].max() + m_range[_d].min());
-
-          pivot = std::partition(m_begin_it, m_end_it, [=](const pair_t &i) {
-            return i.first[_d] < mid;
-          });
-        } else {
-          // If the number of elements is fairly small, we will just calculate
-          // the median exactly. We do this by finding the values in the
-          // dimension, sorting it, and then taking the middle one.
-          std::sort(m_begin_it, m_end_it,
-                    [_d](const typename iterator_t::value_type &a,
-                         const typename iterator_t::value_type &b) {
-                      return a.first[_d] < b.first[_d];
-                    });
-
-          pivot = m_begin_it + (std::distance(m_begin_it, m_end_it) / 2);
-        }
+  /// nodes. All nodes are stored in one contiguous vector, and each node
+  /// refers to a contiguous range of the element vector, so the elements of a
+  /// leaf bucket are always next to each other in memory.
+  struct KDTreeNode {
+    /// @brief The start and end of the range of coordinate-value pairs under
+    /// this node, as indices into the element vector.
+    std::size_t begin = 0, end = 0;
 
-        // This should never really happen, but in very select cases where there
-        // are a lot of equal values in the range, the pivot can end up all the
-        // way at the end of the array and we end up in an infinite loop. We
-        // check for pivot points which would not split the range, and fix them
-        // if they occur.
-        if (pivot == m_begin_it || pivot == std::prev(m_end_it)) {
-          pivot = std::next(m_begin_it, LeafSize);
-        }
+    /// @brief The axis-aligned bounding box of the coordinates under this
+    /// node.
+    range_t range;
 
-        // Calculate the number of elements on the left-hand side, as well as
-        // the right-hand side. We do this by calculating the difference from
-        // the begin and end of the array to the pivot point.
-        std::size_t lhs_size = std::distance(m_begin_it, pivot);
-        std::size_t rhs_size = std::distance(pivot, m_end_it);
-
-        // Next, we check whether the left-hand node should be another internal
-        // node or a leaf node, and we construct the node recursively.
-        m_lhs = std::make_unique<KDTreeNode>(
-            m_begin_it, pivot,
-            lhs_size > LeafSize ? NodeType::Internal : NodeType::Leaf,
-            (_d + 1) % Dims);
-
-        // Same on the right hand side.
-        m_rhs = std::make_unique<KDTreeNode>(
-            pivot, m_end_it,
-            rhs_size > LeafSize ? NodeType::Internal : NodeType::Leaf,
-            (_d + 1) % Dims);
-      }
-    }
+    /// @brief Index of the left-hand child, which is directly followed by the
+    /// right-hand child. Zero for leaf nodes, as the root is never a child.
+    std::size_t lhs = 0;
 
-    /// @brief Perform a range search in the k-d tree, mapping the key-value
-    /// pairs to a side-effecting function.
-    ///
-    /// This is the most powerful range search method we have, assuming that we
-    /// can use arbitrary side effects, which we can. All other range search
-    /// methods are implemented in terms of this particular function.
+    /// @brief Determine the number of elements managed by this node.
     ///
-    /// @param r The range to search for.
-    /// @param f The mapping function to apply to matching elements.
-    template <typename Callable>
-    void rangeSearchMapDiscard(const range_t &r, Callable &&f) const {
-      // Determine whether the range completely covers the bounding box of
-      // this leaf node. If it is, we can copy all values without having to
-      // check for them being inside the range again.
-      bool contained = r >= m_range;
-
-      if (m_type == NodeType::Internal) {
-        // Firstly, we can check if the range completely contains the bounding
-        // box of this node. If that is the case, we know for certain that any
-        // value contained below this node should end up in the output, and we
-        // can stop recursively looking for them.
-        if (contained) {
-          // We can also pre-allocate space for the number of elements, since we
-          // are inserting all of them anyway.
-          for (iterator_t i = m_begin_it; i != m_end_it; ++i) {
-            f(i->first, i->second);
-          }
-
-          return;
-        }
-
-        assert(m_lhs && m_rhs && "Did not find lhs and rhs");
+    /// @return The number of elements below this node.
+    std::size_t size() const { return end - begin; }
+  };
 
-        // If we have a left-hand node (which we should!), then we check if
-        // there is any overlap between the target range and the bounding box of
-        // the left-hand node. If there is, we recursively search in that node.
-        if (m_lhs->range() && r) {
-          m_lhs->rangeSearchMapDiscard(r, std::forward<Callable>(f));
+  /// @brief Build the nodes of the tree on top of the element vector.
+  ///
+  /// The nodes are split level by level, starting from the root. All the
+  /// nodes on one level manage disjoint ranges of the element vector and are
+  /// split independently, which allows splitting them concurrently with the
+  /// given executor. The resulting tree does not depend on the executor.
+  ///
+  /// One interesting thing to note is that all of the nodes in the k-d tree
+  /// have a range in the element vector. They simply make in-place changes
+  /// to this array, and they hold no memory of their own.
+  void build(const ParallelExecutor &executor) {
+    m_nodes.push_back({0, m_elems.size(), range_t{}, 0});
+
+    std::size_t levelBegin = 0;
+    std::size_t levelEnd = m_nodes.size();
+    std::vector<std::size_t> pivots;
+    for (std::size_t depth = 0; levelBegin != levelEnd; ++depth) {
+      // Calculate the bounding boxes of the nodes on this level and split
+      // all of those with more elements than fit into a leaf node.
+      pivots.assign(levelEnd - levelBegin, 0);
+      executeTasks(executor, levelEnd - levelBegin, [&](std::size_t i) {
+        KDTreeNode &node = m_nodes[levelBegin + i];
+        iterator_t b = std::next(m_elems.begin(), node.begin);
+        iterator_t e = std::next(m_elems.begin(), node.end);
+        node.range = boundingBox(b, e);
+        if (node.size() > LeafSize) {
+          pivots[i] = static_cast<std::size_t>(std::distance(
+              m_elems.begin(), split(b, e, node.range, depth % Dims)));
         }
+      });
 
-        // Then, we perform exactly the same procedure for the right hand side.
-        if (m_rhs->range() && r) {
-          m_rhs->rangeSearchMapDiscard(r, std::forward<Callable>(f));
-        }
-      } else {
-        // Iterate over all the elements in this leaf node. This should be a
-        // relatively small number (the LeafSize template parameter).
-        for (iterator_t i = m_begin_it; i != m_end_it; ++i) {
-          // We need to check whether the element is actually inside the range.
-          // In case this node's bounding box is fully contained within the
-          // range, we don't actually need to check this.
-          if (contained || r.contains(i->first)) {
-            f(i->first, i->second);
-          }
+      // The children of all the split nodes form the next level.
+      for (std::size_t i = 0; i < pivots.size(); ++i) {
+        if (pivots[i] == 0) {
+          continue;
         }
+        const std::size_t begin = m_nodes[levelBegin + i].begin;
+        const std::size_t end = m_nodes[levelBegin + i].end;
+        m_nodes[levelBegin + i].lhs = m_nodes.size();
+        m_nodes.push_back({begin, pivots[i], range_t{}, 0});
+        m_nodes.push_back({pivots[i], end, range_t{}, 0});
       }
+      levelBegin = levelEnd;
+      levelEnd = m_nodes.size();
     }
+  }
 
-    /// @brief Determine the number of elements managed by this node.
-    ///
-    /// Conveniently, this number is always equal to the distance between the
-    /// begin iterator and the end iterator, so we can simply delegate to the
-    /// relevant standard library method.
-    ///
-    /// @return The number of elements below this node.
-    std::size_t size() const { return std::distance(m_begin_it, m_end_it); }
+  /// @brief Split a range of elements in two along one dimension.
+  ///
+  /// @param b The start of the elements to split.
+  /// @param e The end of the elements to split.
+  /// @param range The bounding box of the elements.
+  /// @param dim The dimension to split along.
+  ///
+  /// @return The pivot point, the start of the right-hand side elements.
+  static iterator_t split(iterator_t b, iterator_t e, const range_t &range,
+                          std::size_t dim) {
+    // This constant determines the maximum number of elements where we still
+    // calculate the exact median of the values for the purposes of
+    // splitting. In general, the closer the pivot value is to the true
+    // median, the more balanced the tree will be. However, calculating the
+    // median exactly is an O(n log n) operation, while approximating it is
+    // an O(1) time.
+    constexpr std::size_t max_exact_median = 128;
+
+    iterator_t pivot;
+
+    // Next, we need to determine the pivot point of this node, that is to
+    // say the point in the selected pivot dimension along which point we
+    // will split the range. To do this, we check how large the set of
+    // elements is. If it is sufficiently small, we use the median.
+    // Otherwise we use the mean.
+    if (static_cast<std::size_t>(std::distance(b, e)) > max_exact_median) {
+      // In this case, we have a lot of elements, and sorting the range to
+      // find the true median might be too expensive. Therefore, we will
+      // just use the middle value between the minimum and maximum. This is
+      // not nearly as accurate as using the median, but it's a nice cheat.
+      Scalar mid =
+          static_cast<Scalar>(0.5) * (range[dim].max() + range[dim].min());
+
+      pivot = std::partition(
+          b, e, [=](const pair_t &i) { return i.first[dim] < mid; });
+    } else {
+      // If the number of elements is fairly small, we will just calculate
+      // the median exactly. We do this by finding the values in the
+      // dimension, sorting it, and then taking the middle one.
+      std::sort(b, e, [dim](const pair_t &x, const pair_t &y) {
+        return x.first[dim] < y.first[dim];
+      });
+
+      pivot = b + (std::distance(b, e) / 2);
+    }
 
-    /// @brief The axis-aligned bounding box containing all elements in this
-    /// node.
-    ///
-    /// @return The minimal axis-aligned bounding box that contains all the
-    /// elements under this node.
-    const range_t &range() const { return m_range; }
+    // This should never really happen, but in very select cases where there
+    // are a lot of equal values in the range, the pivot can end up all the
+    // way at the end of the array and we end up in an infinite loop. We
+    // check for pivot points which would not split the range, and fix them
+    // if they occur.
+    if (pivot == b || pivot == std::prev(e)) {
+      pivot = std::next(b, LeafSize);
+    }
 
-   protected:
-    NodeType m_type;
+    return pivot;
+  }
 
-    /// @brief The start and end of the range of coordinate-value pairs under
-    /// this node.
-    const iterator_t m_begin_it, m_end_it;
+  /// @brief Perform a range search below a node in the k-d tree, mapping the
+  /// key-value pairs to a side-effecting function.
+  ///
+  /// This is the most powerful range search method we have, assuming that we
+  /// can use arbitrary side effects, which we can. All other range search
+  /// methods are implemented in terms of this particular function.
+  ///
+  /// @param n The index of the node to search below.
+  /// @param r The range to search for.
+  /// @param f The mapping function to apply to matching elements.
+  template <typename Callable>
+  void rangeSearchMapDiscard(std::size_t n, const range_t &r,
+                             Callable &&f) const {
+    const KDTreeNode &node = m_nodes[n];
+
+    // Determine whether the range completely covers the bounding box of
+    // this node. If it is, we can copy all values without having to check
+    // for them being inside the range again.
+    bool contained = r >= node.range;
+
+    if (node.lhs != 0) {
+      // Firstly, we can check if the range completely contains the bounding
+      // box of this node. If that is the case, we know for certain that any
+      // value contained below this node should end up in the output, and we
+      // can stop recursively looking for them.
+      if (contained) {
+        for (std::size_t i = node.begin; i != node.end; ++i) {
+          f(m_elems[i].first, m_elems[i].second);
+        }
 
-    /// @brief The axis-aligned bounding box of the coordinates under this
-    /// node.
-    const range_t m_range;
+        return;
+      }
 
-    /// @brief Pointers to the left and right children.
-    std::unique_ptr<KDTreeNode> m_lhs;
-    std::unique_ptr<KDTreeNode> m_rhs;
-  };
+      // If there is any overlap between the target range and the bounding
+      // box of the left-hand node, we recursively search in that node.
+      if (m_nodes[node.lhs].range && r) {
+        rangeSearchMapDiscard(node.lhs, r, std::forward<Callable>(f));
+      }
+
+      // Then, we perform exactly the same procedure for the right hand side.
+      if (m_nodes[node.lhs + 1].range && r) {
+        rangeSearchMapDiscard(node.lhs + 1, r, std::forward<Callable>(f));
+      }
+    } else {
+      // Iterate over all the elements in this leaf node. This should be a
+      // relatively small number (the LeafSize template parameter).
+      for (std::size_t i = node.begin; i != node.end; ++i) {
+        // We need to check whether the element is actually inside the range.
+        // In case this node's bounding box is fully contained within the
+        // range, we don't actually need to check this.
+        if (contained || r.contains(m_elems[i].first)) {
+          f(m_elems[i].first, m_elems[i].second);
+        }
+      }
+    }
+  }
 
   /// @brief Vector containing all of the elements in this k-d tree, including
   /// the elements managed by the nodes inside of it.
   vector_t m_elems;
 
-  /// @brief Pointer to the root node of this k-d tree.
-  std::unique_ptr<KDTreeNode> m_root;
+  /// @brief All the nodes of this k-d tree, the root node comes first.
+  std::vector<KDTreeNode> m_nodes;
 };
 }  // namespace Acts
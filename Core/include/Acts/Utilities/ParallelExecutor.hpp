@@ -0,0 +1,53 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace Acts {
+
+/// A task that is executed for a single index
+using ParallelTask = std::function<void(std::size_t)>;
+
+/// @brief Executor for a set of independent tasks
+///
+/// The core library does not depend on a threading library, concurrency
+/// is injected by the caller, e.g. by wrapping a thread pool. An executor
+/// has to call the task exactly once for every index in [0, nTasks), in any
+/// order and possibly concurrently, and return only once all tasks are done.
+///
+/// Tasks may call the same executor again, e.g. the geometry builders pass
+/// it on to their nested builders. The executor must therefore not block a
+/// worker while it waits for nested tasks: with a fixed-size pool every
+/// worker could end up waiting for tasks that no free worker is left to run,
+/// which deadlocks. Work-stealing schedulers like TBB, which run other tasks
+/// while waiting, are safe.
+///
+/// An empty executor means sequential execution.
+using ParallelExecutor =
+    std::function<void(std::size_t nTasks, const ParallelTask& task)>;
+
+/// Execute a set of independent tasks
+///
+/// @param executor the executor, the tasks are run in order if empty
+/// @param nTasks the number of tasks
+/// @param task the task to be called with every index
+inline void executeTasks(const ParallelExecutor& executor, std::size_t nTasks,
+                         const ParallelTask& task) {
+  if (executor && nTasks > 1u) {
+    executor(nTasks, task);
+    return;
+  }
+  for (std::size_t i = 0; i < nTasks; ++i) {
+    task(i);
+  }
+}
+
+}  // namespace Acts
@@ -15,11 +15,14 @@
 #include "Acts/Detector/interface/IGeometryIdGenerator.hpp"
 #include "Acts/Detector/interface/IRootVolumeFinderBuilder.hpp"
 #include "Acts/Navigation/DetectorVolumeFinders.hpp"
+#include "Acts/Utilities/Enumerate.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <ostream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 namespace Experimental {
@@ -47,7 +50,7 @@ Acts::Experimental::CuboidalContainerBuilder::CuboidalContainerBuilder(
 
 Acts::Experimental::CuboidalContainerBuilder::CuboidalContainerBuilder(
     const Acts::Experimental::Blueprint::Node& bpNode,
-    Acts::Logging::Level logLevel)
+    Acts::Logging::Level logLevel, const ParallelExecutor& executor)
     : IDetectorComponentBuilder(),
       m_logger(getDefaultLogger(bpNode.name + "_cont", logLevel)) {
   if (bpNode.boundsType != VolumeBounds::BoundsType::eCuboid) {
@@ -79,7 +82,8 @@ Acts::Experimental::CuboidalContainerBuilder::CuboidalContainerBuilder(
     } else {
       // This evokes the recursive stepping down the tree
       m_cfg.builders.push_back(
-          std::make_shared<CuboidalContainerBuilder>(*child, logLevel));
+          std::make_shared<CuboidalContainerBuilder>(*child, logLevel,
+                                                   executor));
     }
   }
   // Check if builders are present
@@ -102,6 +106,7 @@ Acts::Experimental::CuboidalContainerBuilder::CuboidalContainerBuilder(
   }
 
   m_cfg.auxiliary = "*** acts auto-generated from proxy ***";
+  m_cfg.executor = executor;
   m_cfg.geoIdGenerator = bpNode.geoIdGenerator;
   m_cfg.rootVolumeFinderBuilder = bpNode.rootVolumeFinderBuilder;
 }
@@ -123,18 +128,28 @@ Acts::Experimental::CuboidalContainerBuilder::construct(
   std::vector<std::shared_ptr<DetectorVolume>> volumes;
   std::vector<DetectorComponent::PortalContainer> containers;
   std::vector<std::shared_ptr<DetectorVolume>> rootVolumes;
-  // Run through the builders
-  std::for_each(
-      m_cfg.builders.begin(), m_cfg.builders.end(), [&](const auto& builder) {
-        auto [cVolumes, cContainer, cRoots] = builder->construct(gctx);
-        atNavigationLevel = (atNavigationLevel && cVolumes.size() == 1u);
-        ACTS_VERBOSE("Number of volumes: " << cVolumes.size());
-        // Collect individual components, volumes, containers, roots
-        volumes.insert(volumes.end(), cVolumes.begin(), cVolumes.end());
-        containers.push_back(cContainer);
-        rootVolumes.insert(rootVolumes.end(), cRoots.volumes.begin(),
-                           cRoots.volumes.end());
-      });
+  // Run through the builders, they are independent and can be executed
+  // concurrently, the components are collected in the configured order
+  components.resize(m_cfg.builders.size());
+  std::vector<double> buildTimes(m_cfg.builders.size(), 0.);
+  executeTasks(m_cfg.executor, m_cfg.builders.size(), [&](std::size_t ib) {
+    auto start = std::chrono::steady_clock::now();
+    components[ib] = m_cfg.builders[ib]->construct(gctx);
+    buildTimes[ib] = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+  });
+  for (auto [ib, component] : enumerate(components)) {
+    auto& [cVolumes, cContainer, cRoots] = component;
+    ACTS_DEBUG("Component " << ib << " built in " << buildTimes[ib] << " ms.");
+    atNavigationLevel = (atNavigationLevel && cVolumes.size() == 1u);
+    ACTS_VERBOSE("Number of volumes: " << cVolumes.size());
+    // Collect individual components, volumes, containers, roots
+    volumes.insert(volumes.end(), cVolumes.begin(), cVolumes.end());
+    containers.push_back(cContainer);
+    rootVolumes.insert(rootVolumes.end(), cRoots.volumes.begin(),
+                       cRoots.volumes.end());
+  }
   // Navigation level detected, connect volumes (cleaner and faster than
   // connect containers)
   if (atNavigationLevel) {
@@ -13,6 +13,7 @@
 #include "Acts/Detector/interface/IGeometryIdGenerator.hpp"
 #include "Acts/Navigation/DetectorVolumeFinders.hpp"
 
+#include <chrono>
 #include <stdexcept>
 
 Acts::Experimental::DetectorBuilder::DetectorBuilder(
@@ -34,7 +35,11 @@ Acts::Experimental::DetectorBuilder::construct(
   }
   ACTS_DEBUG("Building a detector with name " << m_cfg.name);
 
+  auto start = std::chrono::steady_clock::now();
   auto [volumes, portals, roots] = m_cfg.builder->construct(gctx);
+  std::chrono::duration<double, std::milli> buildTime =
+      std::chrono::steady_clock::now() - start;
+  ACTS_DEBUG("Detector components built in " << buildTime.count() << " ms.");
 
   if (m_cfg.geoIdGenerator != nullptr) {
     ACTS_DEBUG("Assigning geometry ids to the detector");
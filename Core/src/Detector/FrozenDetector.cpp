@@ -0,0 +1,953 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Detector/FrozenDetector.hpp"
+
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/Tolerance.hpp"
+#include "Acts/Detector/Detector.hpp"
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Detector/Portal.hpp"
+#include "Acts/Navigation/DetectorVolumeFinders.hpp"
+#include "Acts/Navigation/DetectorVolumeUpdaters.hpp"
+#include "Acts/Navigation/NavigationState.hpp"
+#include "Acts/Navigation/SurfaceCandidatesUpdaters.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/GridAxisGenerators.hpp"
+#include "Acts/Utilities/IAxis.hpp"
+#include "Acts/Utilities/TypeList.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+using Index = Acts::Experimental::FrozenDetector::Index;
+
+constexpr char s_binaryMagic[8] = {'A', 'C', 'T', 'S', 'F', 'D', '0', '2'};
+
+/// Binary output of the frozen detector, all values are written one by one
+/// with their native byte order and without padding
+class Writer {
+ public:
+  explicit Writer(std::ostream& os) : m_os(os) {}
+
+  template <typename T>
+  void value(T value) {
+    static_assert(std::is_arithmetic_v<T>);
+    m_os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T, typename write_t>
+  void array(const std::vector<T>& values, const write_t& write) {
+    value<std::uint64_t>(values.size());
+    for (const auto& v : values) {
+      write(*this, v);
+    }
+  }
+
+  template <typename T>
+  void array(const std::vector<T>& values) {
+    array(values, [](Writer& w, T v) { w.value(v); });
+  }
+
+ private:
+  std::ostream& m_os;
+};
+
+/// Binary input of the frozen detector, the counts of all arrays are checked
+/// against the remaining size of the file before anything is allocated
+class Reader {
+ public:
+  explicit Reader(std::istream& is) : m_is(is) {
+    const auto begin = m_is.tellg();
+    m_is.seekg(0, std::ios::end);
+    const auto end = m_is.tellg();
+    m_is.seekg(begin);
+    if (!m_is || begin < 0 || end < begin) {
+      throw std::runtime_error("FrozenDetector: input is not seekable.");
+    }
+    m_remaining = static_cast<std::uint64_t>(end - begin);
+  }
+
+  template <typename T>
+  T value() {
+    static_assert(std::is_arithmetic_v<T>);
+    if (sizeof(T) > m_remaining) {
+      throw std::runtime_error("FrozenDetector: truncated input file.");
+    }
+    T value{};
+    m_is.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!m_is) {
+      throw std::runtime_error("FrozenDetector: could not read input file.");
+    }
+    m_remaining -= sizeof(T);
+    return value;
+  }
+
+  /// Read an enumeration stored as its underlying value, which has to be
+  /// smaller than @p end
+  template <typename T>
+  T enumeration(std::uint8_t end) {
+    const auto v = value<std::uint8_t>();
+    if (v >= end) {
+      throw std::runtime_error("FrozenDetector: corrupted enumeration value.");
+    }
+    return static_cast<T>(v);
+  }
+
+  /// Read an array of elements which take @p elementSize bytes each
+  template <typename T, typename read_t>
+  std::vector<T> array(std::uint64_t elementSize, const read_t& read) {
+    const auto n = value<std::uint64_t>();
+    if (n > m_remaining / elementSize) {
+      throw std::runtime_error(
+          "FrozenDetector: array size exceeds the input file.");
+    }
+    std::vector<T> values;
+    values.reserve(n);
+    for (std::uint64_t i = 0; i < n; ++i) {
+      values.push_back(read(*this));
+    }
+    return values;
+  }
+
+  template <typename T>
+  std::vector<T> array() {
+    return array<T>(sizeof(T), [](Reader& r) { return r.value<T>(); });
+  }
+
+  bool atEnd() const { return m_remaining == 0; }
+
+ private:
+  std::istream& m_is;
+  std::uint64_t m_remaining = 0;
+};
+
+using FrozenDetector = Acts::Experimental::FrozenDetector;
+
+// The encoded sizes of the flat structs
+constexpr std::uint64_t s_axisSize = 3 + 2 * sizeof(Index);
+constexpr std::uint64_t s_gridSize = 2 * s_axisSize + 3 * sizeof(Index);
+constexpr std::uint64_t s_linkSize = 1 + sizeof(Index);
+constexpr std::uint64_t s_volumeSize = 1 + 5 * sizeof(Index);
+
+void writeLink(Writer& w, const FrozenDetector::VolumeLink& link) {
+  w.value(static_cast<std::uint8_t>(link.type));
+  w.value(link.target);
+}
+
+FrozenDetector::VolumeLink readLink(Reader& r) {
+  FrozenDetector::VolumeLink link;
+  link.type = r.enumeration<FrozenDetector::LinkType>(4u);
+  link.target = r.value<Index>();
+  return link;
+}
+
+void writeGrid(Writer& w, const FrozenDetector::Grid& grid) {
+  for (const auto& axis : grid.axes) {
+    w.value(static_cast<std::uint8_t>(axis.cast));
+    w.value(static_cast<std::uint8_t>(axis.boundaryType));
+    w.value(static_cast<std::uint8_t>(axis.equidistant));
+    w.value(axis.nBins);
+    w.value(axis.edgesBegin);
+  }
+  w.value(grid.nAxes);
+  w.value(grid.transform);
+  w.value(grid.binsBegin);
+}
+
+FrozenDetector::Grid readGrid(Reader& r) {
+  FrozenDetector::Grid grid;
+  for (auto& axis : grid.axes) {
+    // unused axes keep binValues as cast
+    axis.cast = r.enumeration<Acts::BinningValue>(Acts::binValues + 1);
+    axis.boundaryType = r.enumeration<Acts::detail::AxisBoundaryType>(3u);
+    axis.equidistant = r.enumeration<bool>(2u);
+    axis.nBins = r.value<Index>();
+    axis.edgesBegin = r.value<Index>();
+  }
+  grid.nAxes = r.value<Index>();
+  grid.transform = r.value<Index>();
+  grid.binsBegin = r.value<Index>();
+  return grid;
+}
+
+void writeVolume(Writer& w, const FrozenDetector::VolumeEntry& entry) {
+  w.value(static_cast<std::uint8_t>(entry.candidates));
+  w.value(entry.portalsBegin);
+  w.value(entry.portalsEnd);
+  w.value(entry.surfacesBegin);
+  w.value(entry.surfacesEnd);
+  w.value(entry.grid);
+}
+
+FrozenDetector::VolumeEntry readVolume(Reader& r) {
+  FrozenDetector::VolumeEntry entry;
+  entry.candidates = r.enumeration<FrozenDetector::CandidatesType>(4u);
+  entry.portalsBegin = r.value<Index>();
+  entry.portalsEnd = r.value<Index>();
+  entry.surfacesBegin = r.value<Index>();
+  entry.surfacesEnd = r.value<Index>();
+  entry.grid = r.value<Index>();
+  return entry;
+}
+
+/// Append the entries of a single index grid bin
+template <typename map_t>
+void appendEntries(std::vector<Index>& entries, std::size_t value,
+                   const map_t& map) {
+  entries.push_back(map(value));
+}
+
+/// Append the entries of a multi index grid bin
+template <typename map_t>
+void appendEntries(std::vector<Index>& entries,
+                   const std::vector<std::size_t>& values, const map_t& map) {
+  for (auto value : values) {
+    entries.push_back(map(value));
+  }
+}
+
+/// Call @p func with the indexed surface updater if the delegate instance
+/// is a grid of surfaces with all portals
+template <typename func_t, typename... axes_t>
+bool visitSurfaceGrid(const Acts::Experimental::INavigationDelegate* instance,
+                      const func_t& func,
+                      Acts::TypeList<axes_t...> /*unused*/) {
+  auto visit = [&](auto axes) {
+    using GridType = typename decltype(axes)::template grid_type<
+        std::vector<std::size_t>>;
+    using DelegateType = Acts::Experimental::IndexedSurfacesAllPortalsImpl<
+        GridType, Acts::Experimental::IndexedSurfacesImpl>;
+    const auto* casted = dynamic_cast<const DelegateType*>(instance);
+    if (casted == nullptr) {
+      return false;
+    }
+    func(std::get<Acts::Experimental::IndexedSurfacesImpl<GridType>>(
+        casted->updators));
+    return true;
+  };
+  return (visit(axes_t{}) || ...);
+}
+
+/// Call @p func with the indexed volume updater if the delegate instance
+/// is a grid of detector volumes
+template <typename func_t, typename... axes_t>
+bool visitVolumeGrid(const Acts::Experimental::INavigationDelegate* instance,
+                     const func_t& func, Acts::TypeList<axes_t...> /*unused*/) {
+  auto visit = [&](auto axes) {
+    using GridType =
+        typename decltype(axes)::template grid_type<std::size_t>;
+    using DelegateType =
+        Acts::Experimental::IndexedDetectorVolumesImpl<GridType>;
+    const auto* casted = dynamic_cast<const DelegateType*>(instance);
+    if (casted == nullptr) {
+      return false;
+    }
+    func(*casted);
+    return true;
+  };
+  return (visit(axes_t{}) || ...);
+}
+
+}  // namespace
+
+Acts::Experimental::FrozenDetector::FrozenDetector(const Detector& detector) {
+  collectObjects(detector);
+  compile();
+}
+
+std::vector<const Acts::Experimental::Portal*>
+Acts::Experimental::FrozenDetector::candidatePortals(
+    const DetectorVolume& volume) {
+  std::vector<const Portal*> portals;
+  for (const auto* subVolume : volume.volumes()) {
+    const auto& subPortals = subVolume->portals();
+    portals.insert(portals.end(), subPortals.begin(), subPortals.end());
+  }
+  const auto& ownPortals = volume.portals();
+  portals.insert(portals.end(), ownPortals.begin(), ownPortals.end());
+  return portals;
+}
+
+void Acts::Experimental::FrozenDetector::collectObjects(
+    const Detector& detector) {
+  m_detector = &detector;
+
+  // The volume order is the one of the detector, which is also used by
+  // the indexed root volume finders
+  for (const auto* volume : detector.volumes()) {
+    m_volumeIndices.emplace(volume, m_volumeObjects.size());
+    m_volumeObjects.push_back(volume);
+  }
+  // The portals are collected as they are compiled into the volume
+  // candidates, portals and surfaces can be shared between volumes
+  for (const auto* volume : m_volumeObjects) {
+    for (const auto* portal : candidatePortals(*volume)) {
+      if (m_portalIndices.emplace(portal, m_portalObjects.size()).second) {
+        m_portalObjects.push_back(portal);
+      }
+    }
+    for (const auto* surface : volume->surfaces()) {
+      if (m_surfaceIndices.emplace(surface, m_surfaceObjects.size()).second) {
+        m_surfaceObjects.push_back(surface);
+      }
+    }
+  }
+  m_lookup = detail::DetectorObjectLookup(m_volumeObjects, m_portalObjects);
+}
+
+void Acts::Experimental::FrozenDetector::compile() {
+  const auto identity = [](std::size_t index) {
+    return static_cast<Index>(index);
+  };
+
+  m_volumes.reserve(m_volumeObjects.size());
+  for (const auto* volume : m_volumeObjects) {
+    VolumeEntry entry;
+    entry.portalsBegin = m_volumePortals.size();
+    for (const auto* portal : candidatePortals(*volume)) {
+      m_volumePortals.push_back(m_portalIndices.at(portal));
+    }
+    entry.portalsEnd = m_volumePortals.size();
+
+    entry.surfacesBegin = m_volumeSurfaces.size();
+    for (const auto* surface : volume->surfaces()) {
+      m_volumeSurfaces.push_back(m_surfaceIndices.at(surface));
+    }
+    entry.surfacesEnd = m_volumeSurfaces.size();
+
+    const auto* instance = volume->surfaceCandidatesUpdater().instance();
+    if (dynamic_cast<const AllPortalsImpl*>(instance) != nullptr) {
+      entry.candidates = CandidatesType::Portals;
+    } else if (dynamic_cast<const AllPortalsAndSurfacesImpl*>(instance) !=
+               nullptr) {
+      entry.candidates = CandidatesType::PortalsAndSurfaces;
+    } else if (visitSurfaceGrid(
+                   instance,
+                   [&](const auto& indexed) {
+                     entry.grid = addGrid(indexed.grid, indexed.casts,
+                                          indexed.transform, identity);
+                   },
+                   GridAxisGenerators::PossibleAxes{})) {
+      entry.candidates = CandidatesType::PortalsAndGrid;
+    } else {
+      entry.candidates = CandidatesType::Delegate;
+    }
+    m_volumes.push_back(entry);
+  }
+
+  m_portals.reserve(m_portalObjects.size());
+  for (const auto* portal : m_portalObjects) {
+    PortalEntry entry;
+    const auto& updaters = portal->detectorVolumeUpdaters();
+    for (std::size_t i = 0; i < updaters.size(); ++i) {
+      entry.links[i] = compileLink(updaters[i]);
+    }
+    m_portals.push_back(entry);
+  }
+
+  m_rootLink = compileLink(m_detector->detectorVolumeFinder());
+}
+
+Acts::Experimental::FrozenDetector::VolumeLink
+Acts::Experimental::FrozenDetector::compileLink(
+    const DetectorVolumeUpdater& delegate) {
+  VolumeLink link;
+  if (!delegate.connected()) {
+    return link;
+  }
+
+  const auto* instance = delegate.instance();
+  if (dynamic_cast<const EndOfWorldImpl*>(instance) != nullptr) {
+    return link;
+  }
+
+  link.type = LinkType::Delegate;
+  if (const auto* single =
+          dynamic_cast<const SingleDetectorVolumeImpl*>(instance);
+      single != nullptr) {
+    Index target = volumeIndex(single->dVolume);
+    if (target != s_noIndex) {
+      link = {LinkType::Volume, target};
+    }
+  } else if (const auto* bound =
+                 dynamic_cast<const BoundVolumesGrid1Impl*>(instance);
+             bound != nullptr) {
+    const auto& indexed = bound->indexedUpdater;
+    const auto& volumes = indexed.extractor.dVolumes;
+    bool known = std::all_of(volumes.begin(), volumes.end(),
+                             [&](const auto* volume) {
+                               return volumeIndex(volume) != s_noIndex;
+                             });
+    if (known) {
+      link = {LinkType::Grid,
+              addGrid(indexed.grid, indexed.casts, indexed.transform,
+                      [&](std::size_t index) {
+                        return volumeIndex(volumes[index]);
+                      })};
+    }
+  } else {
+    // The indexed root volume finders use the detector volume order
+    visitVolumeGrid(
+        instance,
+        [&](const auto& indexed) {
+          link = {LinkType::Grid,
+                  addGrid(indexed.grid, indexed.casts, indexed.transform,
+                          [](std::size_t index) {
+                            return static_cast<Index>(index);
+                          })};
+        },
+        GridAxisGenerators::PossibleAxes{});
+  }
+  return link;
+}
+
+template <typename grid_t, typename map_t>
+Acts::Experimental::FrozenDetector::Index
+Acts::Experimental::FrozenDetector::addGrid(
+    const grid_t& grid, const std::array<BinningValue, grid_t::DIM>& casts,
+    const Transform3& transform, const map_t& map) {
+  static_assert(grid_t::DIM <= 2u, "Only grids up to two dimensions.");
+
+  Grid fGrid;
+  fGrid.nAxes = grid_t::DIM;
+  const auto axes = grid.axes();
+  for (std::size_t i = 0; i < grid_t::DIM; ++i) {
+    const IAxis& axis = *axes[i];
+    Axis& fAxis = fGrid.axes[i];
+    fAxis.cast = casts[i];
+    fAxis.boundaryType = axis.getBoundaryType();
+    fAxis.equidistant = axis.isEquidistant();
+    fAxis.nBins = axis.getNBins();
+    fAxis.edgesBegin = m_gridEdges.size();
+    if (fAxis.equidistant) {
+      m_gridEdges.push_back(axis.getMin());
+      m_gridEdges.push_back(axis.getMax());
+    } else {
+      auto edges = axis.getBinEdges();
+      m_gridEdges.insert(m_gridEdges.end(), edges.begin(), edges.end());
+    }
+  }
+  if (!transform.isApprox(Transform3::Identity())) {
+    fGrid.transform = m_transforms.size();
+    m_transforms.push_back(transform);
+  }
+
+  // Copy all bins including under- and overflow in the order of globalBin
+  const auto nBins = grid.numLocalBins();
+  std::size_t nTotal = 1u;
+  for (std::size_t i = 0; i < grid_t::DIM; ++i) {
+    nTotal *= nBins[i] + 2u;
+  }
+  fGrid.binsBegin = m_gridBinOffsets.size();
+  typename grid_t::index_t localBins{};
+  for (std::size_t bin = 0; bin < nTotal; ++bin) {
+    std::size_t rest = bin;
+    for (std::size_t i = grid_t::DIM; i-- > 0;) {
+      localBins[i] = rest % (nBins[i] + 2u);
+      rest /= nBins[i] + 2u;
+    }
+    m_gridBinOffsets.push_back(m_gridEntries.size());
+    appendEntries(m_gridEntries, grid.atLocalBins(localBins), map);
+  }
+  m_gridBinOffsets.push_back(m_gridEntries.size());
+
+  m_grids.push_back(fGrid);
+  return m_grids.size() - 1u;
+}
+
+Acts::Experimental::FrozenDetector::Index
+Acts::Experimental::FrozenDetector::volumeIndex(
+    const DetectorVolume* volume) const {
+  // The delegates leave no volume when leaving the world
+  if (volume == nullptr) {
+    return s_noIndex;
+  }
+  const std::size_t index = m_lookup.volumeIndex(volume);
+  if (index != detail::DetectorObjectLookup::s_noIndex) {
+    return index;
+  }
+  auto it = m_volumeIndices.find(volume);
+  return it != m_volumeIndices.end() ? it->second : s_noIndex;
+}
+
+Acts::Experimental::FrozenDetector::Index
+Acts::Experimental::FrozenDetector::portalIndex(const Portal* portal) const {
+  const std::size_t index = m_lookup.portalIndex(portal);
+  if (index != detail::DetectorObjectLookup::s_noIndex) {
+    return index;
+  }
+  auto it = m_portalIndices.find(portal);
+  return it != m_portalIndices.end() ? it->second : s_noIndex;
+}
+
+std::size_t Acts::Experimental::FrozenDetector::globalBin(
+    const Grid& grid, const Vector3& position) const {
+  const Vector3 lposition = grid.transform == s_noIndex
+                                ? position
+                                : Vector3(m_transforms[grid.transform] *
+                                          position);
+  std::size_t bin = 0;
+  for (Index i = 0; i < grid.nAxes; ++i) {
+    const Axis& axis = grid.axes[i];
+    const ActsScalar* edges = m_gridEdges.data() + axis.edgesBegin;
+    const ActsScalar x = VectorHelpers::cast(lposition, axis.cast);
+    const int nBins = axis.nBins;
+    // Same arithmetic as the equidistant and variable axis lookups
+    int local = 0;
+    if (axis.equidistant) {
+      const ActsScalar width = (edges[1] - edges[0]) / nBins;
+      local = static_cast<int>(std::floor((x - edges[0]) / width) + 1);
+    } else {
+      local = std::distance(edges,
+                            std::upper_bound(edges, edges + nBins + 1, x));
+    }
+    switch (axis.boundaryType) {
+      case Acts::detail::AxisBoundaryType::Open:
+        local = std::clamp(local, 0, nBins + 1);
+        break;
+      case Acts::detail::AxisBoundaryType::Bound:
+        local = std::clamp(local, 1, nBins);
+        break;
+      case Acts::detail::AxisBoundaryType::Closed:
+        local = 1 + (nBins + ((local - 1) % nBins)) % nBins;
+        break;
+    }
+    bin = bin * (axis.nBins + 2u) + local;
+  }
+  return bin;
+}
+
+Acts::Experimental::FrozenDetector::Index
+Acts::Experimental::FrozenDetector::followLink(const GeometryContext& gctx,
+                                               const VolumeLink& link,
+                                               const Vector3& position,
+                                               const Vector3& direction,
+                                               Index portal) const {
+  switch (link.type) {
+    case LinkType::EndOfWorld:
+      return s_noIndex;
+    case LinkType::Volume:
+      return link.target;
+    case LinkType::Grid: {
+      const Grid& grid = m_grids[link.target];
+      const std::size_t bin = grid.binsBegin + globalBin(grid, position);
+      return m_gridBinOffsets[bin] != m_gridBinOffsets[bin + 1]
+                 ? m_gridEntries[m_gridBinOffsets[bin]]
+                 : s_noIndex;
+    }
+    case LinkType::Delegate:
+      break;
+  }
+
+  NavigationState nState;
+  nState.currentDetector = m_detector;
+  nState.position = position;
+  nState.direction = direction;
+  if (portal == s_noIndex) {
+    m_detector->updateDetectorVolume(gctx, nState);
+  } else {
+    m_portalObjects[portal]->updateDetectorVolume(gctx, nState);
+  }
+  return volumeIndex(nState.currentVolume);
+}
+
+Acts::Experimental::FrozenDetector::Index
+Acts::Experimental::FrozenDetector::findVolume(const GeometryContext& gctx,
+                                               const Vector3& position) const {
+  return followLink(gctx, m_rootLink, position, Vector3(0., 0., 0.),
+                    s_noIndex);
+}
+
+Acts::Experimental::FrozenDetector::Index
+Acts::Experimental::FrozenDetector::portalTarget(
+    const GeometryContext& gctx, Index portal, const Vector3& position,
+    const Vector3& direction) const {
+  const Vector3 normal =
+      m_portalObjects[portal]->surface().normal(gctx, position);
+  const Direction dir = Direction::fromScalar(normal.dot(direction));
+  return followLink(gctx, m_portals[portal].links[dir.index()], position,
+                    direction, portal);
+}
+
+const Acts::Surface& Acts::Experimental::FrozenDetector::candidateSurface(
+    const Candidate& candidate) const {
+  return candidate.isPortal ? m_portalObjects[candidate.index]->surface()
+                            : *m_surfaceObjects[candidate.index];
+}
+
+template <typename push_t>
+void Acts::Experimental::FrozenDetector::intersectCandidates(
+    const GeometryContext& gctx, const VolumeEntry& entry,
+    const Vector3& position, const Vector3& direction,
+    const BoundaryCheck& surfaceCheck, ActsScalar overstepTolerance,
+    const push_t& push) const {
+  // Only the first solution is considered, as in the candidate updates
+  auto intersect = [&](const Surface& surface, Index index, bool isPortal,
+                       const BoundaryCheck& bcheck) {
+    auto intersection = surface.intersect(gctx, position, direction, bcheck,
+                                          s_onSurfaceTolerance)[0];
+    if (intersection && intersection.pathLength() > overstepTolerance) {
+      push(intersection, index, isPortal);
+    }
+  };
+
+  const BoundaryCheck portalCheck(true);
+  for (Index i = entry.portalsBegin; i < entry.portalsEnd; ++i) {
+    const Index portal = m_volumePortals[i];
+    intersect(m_portalObjects[portal]->surface(), portal, true, portalCheck);
+  }
+
+  if (entry.candidates == CandidatesType::PortalsAndSurfaces) {
+    for (Index i = entry.surfacesBegin; i < entry.surfacesEnd; ++i) {
+      const Index surface = m_volumeSurfaces[i];
+      intersect(*m_surfaceObjects[surface], surface, false, surfaceCheck);
+    }
+  } else if (entry.candidates == CandidatesType::PortalsAndGrid) {
+    const Grid& grid = m_grids[entry.grid];
+    const std::size_t bin = grid.binsBegin + globalBin(grid, position);
+    for (Index i = m_gridBinOffsets[bin]; i < m_gridBinOffsets[bin + 1]; ++i) {
+      const Index surface =
+          m_volumeSurfaces[entry.surfacesBegin + m_gridEntries[i]];
+      intersect(*m_surfaceObjects[surface], surface, false, surfaceCheck);
+    }
+  }
+}
+
+void Acts::Experimental::FrozenDetector::fillCandidates(
+    const GeometryContext& gctx, Index volume, const Vector3& position,
+    const Vector3& direction, const BoundaryCheck& surfaceCheck,
+    ActsScalar overstepTolerance, Candidates& candidates) const {
+  candidates.clear();
+  const VolumeEntry& entry = m_volumes[volume];
+
+  if (entry.candidates == CandidatesType::Delegate) {
+    // Unknown delegate: run it and map the candidates back to indices
+    NavigationState nState;
+    nState.currentDetector = m_detector;
+    nState.position = position;
+    nState.direction = direction;
+    nState.surfaceBoundaryCheck = surfaceCheck;
+    nState.overstepTolerance = overstepTolerance;
+    m_volumeObjects[volume]->updateNavigationState(gctx, nState);
+    for (const auto& c : nState.surfaceCandidates) {
+      Candidate candidate;
+      candidate.objectIntersection = c.objectIntersection;
+      if (c.surface != nullptr) {
+        auto it = m_surfaceIndices.find(c.surface);
+        if (it == m_surfaceIndices.end()) {
+          continue;
+        }
+        candidate.index = it->second;
+      } else {
+        candidate.index = portalIndex(c.portal);
+        candidate.isPortal = true;
+        if (candidate.index == s_noIndex) {
+          continue;
+        }
+      }
+      candidates.push_back(candidate);
+    }
+  } else {
+    intersectCandidates(gctx, entry, position, direction, surfaceCheck,
+                        overstepTolerance,
+                        [&](const auto& intersection, Index index,
+                            bool isPortal) {
+                          candidates.push_back(
+                              Candidate{intersection, index, isPortal});
+                        });
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto& a, const auto& b) {
+              return a.objectIntersection.pathLength() <
+                     b.objectIntersection.pathLength();
+            });
+}
+
+void Acts::Experimental::FrozenDetector::updateNavigationState(
+    const GeometryContext& gctx, NavigationState& nState) const {
+  const Index volume = volumeIndex(nState.currentVolume);
+  if (volume == s_noIndex ||
+      m_volumes[volume].candidates == CandidatesType::Delegate) {
+    nState.currentVolume->updateNavigationState(gctx, nState);
+    return;
+  }
+  intersectCandidates(
+      gctx, m_volumes[volume], nState.position, nState.direction,
+      nState.surfaceBoundaryCheck, nState.overstepTolerance,
+      [&](const auto& intersection, Index index, bool isPortal) {
+        if (isPortal) {
+          nState.surfaceCandidates.push_back(NavigationState::SurfaceCandidate{
+              intersection, nullptr, m_portalObjects[index],
+              BoundaryCheck(true)});
+        } else {
+          nState.surfaceCandidates.push_back(NavigationState::SurfaceCandidate{
+              intersection, m_surfaceObjects[index], nullptr,
+              nState.surfaceBoundaryCheck});
+        }
+      });
+}
+
+void Acts::Experimental::FrozenDetector::updateDetectorVolume(
+    const GeometryContext& gctx, const Portal& portal,
+    NavigationState& nState) const {
+  const Index index = portalIndex(&portal);
+  if (index == s_noIndex) {
+    portal.updateDetectorVolume(gctx, nState);
+    return;
+  }
+  const Vector3 normal = portal.surface().normal(gctx, nState.position);
+  const Direction dir = Direction::fromScalar(normal.dot(nState.direction));
+  const VolumeLink& link = m_portals[index].links[dir.index()];
+  if (link.type == LinkType::Delegate) {
+    portal.updateDetectorVolume(gctx, nState);
+    return;
+  }
+  const Index target =
+      followLink(gctx, link, nState.position, nState.direction, index);
+  nState.currentVolume =
+      target != s_noIndex ? m_volumeObjects[target] : nullptr;
+}
+
+const Acts::Experimental::DetectorVolume*
+Acts::Experimental::FrozenDetector::findDetectorVolume(
+    const GeometryContext& gctx, const Vector3& position) const {
+  if (m_rootLink.type == LinkType::Delegate) {
+    return m_detector->findDetectorVolume(gctx, position);
+  }
+  const Index volume = findVolume(gctx, position);
+  return volume != s_noIndex ? m_volumeObjects[volume] : nullptr;
+}
+
+void Acts::Experimental::FrozenDetector::save(
+    const std::string& fileName) const {
+  std::ofstream os(fileName, std::ios::binary);
+  if (!os) {
+    throw std::runtime_error("FrozenDetector: could not open " + fileName);
+  }
+  os.write(s_binaryMagic, sizeof(s_binaryMagic));
+  Writer writer(os);
+
+  // Geometry identifiers of the object tables, to check the detector on load
+  std::vector<std::uint64_t> volumeIds;
+  for (const auto* volume : m_volumeObjects) {
+    volumeIds.push_back(volume->geometryId().value());
+  }
+  std::vector<std::uint64_t> portalIds;
+  for (const auto* portal : m_portalObjects) {
+    portalIds.push_back(portal->surface().geometryId().value());
+  }
+  std::vector<std::uint64_t> surfaceIds;
+  for (const auto* surface : m_surfaceObjects) {
+    surfaceIds.push_back(surface->geometryId().value());
+  }
+  writer.array(volumeIds);
+  writer.array(portalIds);
+  writer.array(surfaceIds);
+
+  writer.array(m_volumes, writeVolume);
+  writer.array(m_portals, [](Writer& w, const PortalEntry& entry) {
+    for (const auto& link : entry.links) {
+      writeLink(w, link);
+    }
+  });
+  writer.array(m_volumePortals);
+  writer.array(m_volumeSurfaces);
+  writer.array(m_grids, writeGrid);
+  writer.array(m_gridEdges);
+  writer.array(m_gridBinOffsets);
+  writer.array(m_gridEntries);
+  writer.array(m_transforms, [](Writer& w, const Transform3& transform) {
+    for (Eigen::Index i = 0; i < transform.matrix().size(); ++i) {
+      w.value(transform.matrix().data()[i]);
+    }
+  });
+  writeLink(writer, m_rootLink);
+
+  if (!os) {
+    throw std::runtime_error("FrozenDetector: could not write " + fileName);
+  }
+}
+
+Acts::Experimental::FrozenDetector Acts::Experimental::FrozenDetector::load(
+    const std::string& fileName, const Detector& detector) {
+  std::ifstream is(fileName, std::ios::binary);
+  if (!is) {
+    throw std::runtime_error("FrozenDetector: could not open " + fileName);
+  }
+  char magic[sizeof(s_binaryMagic)] = {};
+  is.read(magic, sizeof(magic));
+  if (!is || !std::equal(magic, magic + sizeof(magic), s_binaryMagic)) {
+    throw std::runtime_error("FrozenDetector: " + fileName +
+                             " is not a frozen detector file.");
+  }
+  Reader reader(is);
+
+  FrozenDetector frozen;
+  frozen.collectObjects(detector);
+
+  auto volumeIds = reader.array<std::uint64_t>();
+  auto portalIds = reader.array<std::uint64_t>();
+  auto surfaceIds = reader.array<std::uint64_t>();
+  auto matches = [](const auto& objects, const auto& ids, auto id) {
+    return objects.size() == ids.size() &&
+           std::equal(objects.begin(), objects.end(), ids.begin(),
+                      [&](const auto* object, std::uint64_t value) {
+                        return id(object) == value;
+                      });
+  };
+  auto portalId = [](const auto* p) {
+    return p->surface().geometryId().value();
+  };
+  if (!matches(frozen.m_volumeObjects, volumeIds,
+               [](const auto* v) { return v->geometryId().value(); }) ||
+      !matches(frozen.m_portalObjects, portalIds, portalId) ||
+      !matches(frozen.m_surfaceObjects, surfaceIds,
+               [](const auto* s) { return s->geometryId().value(); })) {
+    throw std::invalid_argument("FrozenDetector: " + fileName +
+                                " does not match the detector " +
+                                detector.name());
+  }
+
+  frozen.m_volumes = reader.array<VolumeEntry>(s_volumeSize, readVolume);
+  frozen.m_portals =
+      reader.array<PortalEntry>(2 * s_linkSize, [](Reader& r) {
+        PortalEntry entry;
+        for (auto& link : entry.links) {
+          link = readLink(r);
+        }
+        return entry;
+      });
+  frozen.m_volumePortals = reader.array<Index>();
+  frozen.m_volumeSurfaces = reader.array<Index>();
+  frozen.m_grids = reader.array<Grid>(s_gridSize, readGrid);
+  frozen.m_gridEdges = reader.array<ActsScalar>();
+  frozen.m_gridBinOffsets = reader.array<Index>();
+  frozen.m_gridEntries = reader.array<Index>();
+  frozen.m_transforms = reader.array<Transform3>(
+      16u * sizeof(ActsScalar), [](Reader& r) {
+        Transform3 transform;
+        for (Eigen::Index i = 0; i < transform.matrix().size(); ++i) {
+          transform.matrix().data()[i] = r.value<ActsScalar>();
+        }
+        return transform;
+      });
+  frozen.m_rootLink = readLink(reader);
+
+  if (!reader.atEnd() || !frozen.consistent()) {
+    throw std::runtime_error("FrozenDetector: corrupted input file " +
+                             fileName);
+  }
+  return frozen;
+}
+
+bool Acts::Experimental::FrozenDetector::consistent() const {
+  const std::size_t nVolumes = m_volumeObjects.size();
+  const std::size_t nPortals = m_portalObjects.size();
+  const std::size_t nSurfaces = m_surfaceObjects.size();
+  if (m_volumes.size() != nVolumes || m_portals.size() != nPortals) {
+    return false;
+  }
+
+  auto below = [](const std::vector<Index>& indices, std::size_t end) {
+    return std::all_of(indices.begin(), indices.end(),
+                       [&](Index index) { return index < end; });
+  };
+  if (!below(m_volumePortals, nPortals) ||
+      !below(m_volumeSurfaces, nSurfaces)) {
+    return false;
+  }
+
+  // The grid entries, which are either volume indices or surface indices
+  // relative to the surface range of a volume, have to be below @p nEntries
+  auto validGrid = [&](Index index, std::size_t nEntries) {
+    if (index >= m_grids.size()) {
+      return false;
+    }
+    const Grid& grid = m_grids[index];
+    const bool validTransform =
+        grid.transform == s_noIndex || grid.transform < m_transforms.size();
+    if (grid.nAxes < 1u || grid.nAxes > grid.axes.size() || !validTransform) {
+      return false;
+    }
+    std::size_t nTotal = 1u;
+    for (Index i = 0; i < grid.nAxes; ++i) {
+      const Axis& axis = grid.axes[i];
+      const std::size_t nBins = axis.nBins;
+      const std::size_t nEdges = axis.equidistant ? 2u : nBins + 1u;
+      if (nBins == 0u || axis.edgesBegin + nEdges > m_gridEdges.size()) {
+        return false;
+      }
+      // The edges have to be increasing for the bin lookup
+      const auto edges = m_gridEdges.begin() + axis.edgesBegin;
+      if (std::adjacent_find(edges, edges + nEdges, std::greater_equal<>()) !=
+          edges + nEdges) {
+        return false;
+      }
+      nTotal *= nBins + 2u;
+      if (nTotal > m_gridBinOffsets.size()) {
+        return false;
+      }
+    }
+    if (grid.binsBegin + nTotal >= m_gridBinOffsets.size()) {
+      return false;
+    }
+    const auto offsets = m_gridBinOffsets.begin() + grid.binsBegin;
+    const Index first = offsets[0u];
+    const Index last = offsets[nTotal];
+    if (!std::is_sorted(offsets, offsets + nTotal + 1u) ||
+        last > m_gridEntries.size()) {
+      return false;
+    }
+    return std::all_of(m_gridEntries.begin() + first,
+                       m_gridEntries.begin() + last,
+                       [&](Index entry) { return entry < nEntries; });
+  };
+
+  auto validLink = [&](const VolumeLink& link) {
+    switch (link.type) {
+      case LinkType::Volume:
+        return link.target < nVolumes;
+      case LinkType::Grid:
+        return validGrid(link.target, nVolumes);
+      default:
+        return true;
+    }
+  };
+  if (!validLink(m_rootLink)) {
+    return false;
+  }
+  for (const auto& portal : m_portals) {
+    if (!validLink(portal.links[0u]) || !validLink(portal.links[1u])) {
+      return false;
+    }
+  }
+
+  for (const auto& volume : m_volumes) {
+    if (volume.portalsBegin > volume.portalsEnd ||
+        volume.portalsEnd > m_volumePortals.size() ||
+        volume.surfacesBegin > volume.surfacesEnd ||
+        volume.surfacesEnd > m_volumeSurfaces.size()) {
+      return false;
+    }
+    if (volume.candidates == CandidatesType::PortalsAndGrid &&
+        !validGrid(volume.grid, volume.surfacesEnd - volume.surfacesBegin)) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -83,6 +83,7 @@ void adaptBinningRange(std::vector<Acts::Experimental::ProtoBinning>& pBinning,
 /// @param lSurfaces the surfaces of the layer
 /// @param assignToAll the indices assigned to all
 /// @param binning the binning struct
+/// @param executor the executor for the grid filling
 ///
 /// @return a configured surface candidate updators
 template <Acts::detail::AxisBoundaryType aType>
@@ -90,7 +91,8 @@ Acts::Experimental::SurfaceCandidatesUpdater createUpdater(
     const Acts::GeometryContext& gctx,
     std::vector<std::shared_ptr<Acts::Surface>> lSurfaces,
     std::vector<std::size_t> assignToAll,
-    const Acts::Experimental::ProtoBinning& binning) {
+    const Acts::Experimental::ProtoBinning& binning,
+    const Acts::ParallelExecutor& executor) {
   // The surface candidate updator & a generator for polyhedrons
   Acts::Experimental::SurfaceCandidatesUpdater sfCandidates;
   Acts::Experimental::detail::PolyhedronReferenceGenerator rGenerator;
@@ -101,6 +103,7 @@ Acts::Experimental::SurfaceCandidatesUpdater createUpdater(
           std::move(assignToAll),
           {binning.binValue},
           {binning.expansion}};
+  isg.executor = executor;
   if (binning.axisType == Acts::detail::AxisType::Equidistant) {
     // Equidistant
     Acts::GridAxisGenerators::Eq<aType> aGenerator{
@@ -124,6 +127,7 @@ Acts::Experimental::SurfaceCandidatesUpdater createUpdater(
 /// @param assignToAll the indices assigned to all
 /// @param aBinning the binning struct of axis a
 /// @param bBinning the binning struct of axis b
+/// @param executor the executor for the grid filling
 ///
 /// @return a configured surface candidate updators
 template <Acts::detail::AxisBoundaryType aType,
@@ -133,7 +137,8 @@ Acts::Experimental::SurfaceCandidatesUpdater createUpdater(
     const std::vector<std::shared_ptr<Acts::Surface>>& lSurfaces,
     const std::vector<std::size_t>& assignToAll,
     const Acts::Experimental::ProtoBinning& aBinning,
-    const Acts::Experimental::ProtoBinning& bBinning) {
+    const Acts::Experimental::ProtoBinning& bBinning,
+    const Acts::ParallelExecutor& executor) {
   // The surface candidate updator & a generator for polyhedrons
   Acts::Experimental::SurfaceCandidatesUpdater sfCandidates;
   Acts::Experimental::detail::PolyhedronReferenceGenerator rGenerator;
@@ -144,6 +149,7 @@ Acts::Experimental::SurfaceCandidatesUpdater createUpdater(
           assignToAll,
           {aBinning.binValue, bBinning.binValue},
           {aBinning.expansion, bBinning.expansion}};
+  isg.executor = executor;
   // Run through the cases
   if (aBinning.axisType == Acts::detail::AxisType::Equidistant &&
       bBinning.axisType == Acts::detail::AxisType::Equidistant) {
@@ -326,12 +332,12 @@ Acts::Experimental::LayerStructureBuilder::construct(
         ACTS_VERBOSE("-- closed binning option.");
         internalCandidatesUpdater =
             createUpdater<Acts::detail::AxisBoundaryType::Closed>(
-                gctx, internalSurfaces, assignToAll, binning);
+                gctx, internalSurfaces, assignToAll, binning, m_cfg.executor);
       } else {
         ACTS_VERBOSE("-- bound binning option.");
         internalCandidatesUpdater =
             createUpdater<Acts::detail::AxisBoundaryType::Bound>(
-                gctx, internalSurfaces, assignToAll, binning);
+                gctx, internalSurfaces, assignToAll, binning, m_cfg.executor);
       }
     } else if (binnings.size() == 2u) {
       // Check if autorange for binning applies
@@ -356,20 +362,23 @@ Acts::Experimental::LayerStructureBuilder::construct(
         internalCandidatesUpdater =
             createUpdater<Acts::detail::AxisBoundaryType::Closed,
                           Acts::detail::AxisBoundaryType::Bound>(
-                gctx, internalSurfaces, assignToAll, binning0, binning1);
+                gctx, internalSurfaces, assignToAll, binning0, binning1,
+                m_cfg.executor);
       } else if (binning1.boundaryType ==
                  Acts::detail::AxisBoundaryType::Closed) {
         ACTS_VERBOSE("-- bound/closed binning option.");
         internalCandidatesUpdater =
             createUpdater<Acts::detail::AxisBoundaryType::Bound,
                           Acts::detail::AxisBoundaryType::Closed>(
-                gctx, internalSurfaces, assignToAll, binning0, binning1);
+                gctx, internalSurfaces, assignToAll, binning0, binning1,
+                m_cfg.executor);
       } else {
         ACTS_VERBOSE("-- bound/bound binning option.");
         internalCandidatesUpdater =
             createUpdater<Acts::detail::AxisBoundaryType::Bound,
                           Acts::detail::AxisBoundaryType::Bound>(
-                gctx, internalSurfaces, assignToAll, binning0, binning1);
+                gctx, internalSurfaces, assignToAll, binning0, binning1,
+                m_cfg.executor);
       }
     }
   } else {
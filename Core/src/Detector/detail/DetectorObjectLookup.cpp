@@ -0,0 +1,61 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Detector/detail/DetectorObjectLookup.hpp"
+
+#include <algorithm>
+#include <utility>
+
+Acts::Experimental::detail::DetectorObjectLookup::DetectorObjectLookup(
+    std::vector<const DetectorVolume*> volumes,
+    std::vector<const Portal*> portals)
+    : m_volumes(std::move(volumes)), m_portals(std::move(portals)) {
+  // Objects sharing a number are dropped, they are marked as taken
+  constexpr std::size_t taken = s_noIndex - 1u;
+  auto claim = [&](std::size_t& entry, std::size_t index) {
+    entry = entry == s_noIndex ? index : taken;
+  };
+
+  for (std::size_t i = 0; i < m_volumes.size(); ++i) {
+    const std::size_t id = m_volumes[i]->geometryId().volume();
+    if (id == 0u) {
+      continue;
+    }
+    if (id >= m_volumeTable.size()) {
+      m_volumeTable.resize(id + 1u, s_noIndex);
+    }
+    claim(m_volumeTable[id], i);
+  }
+
+  // The number of boundaries per volume number, then the flat table
+  std::vector<std::size_t> nBoundaries;
+  for (const auto* portal : m_portals) {
+    const auto& geoId = portal->surface().geometryId();
+    if (geoId.volume() >= nBoundaries.size()) {
+      nBoundaries.resize(geoId.volume() + 1u, 0u);
+    }
+    auto& n = nBoundaries[geoId.volume()];
+    n = std::max<std::size_t>(n, geoId.boundary() + 1u);
+  }
+  m_portalOffsets.assign(nBoundaries.size() + 1u, 0u);
+  for (std::size_t v = 0; v < nBoundaries.size(); ++v) {
+    m_portalOffsets[v + 1u] = m_portalOffsets[v] + nBoundaries[v];
+  }
+  m_portalTable.assign(m_portalOffsets.back(), s_noIndex);
+  for (std::size_t i = 0; i < m_portals.size(); ++i) {
+    const auto& geoId = m_portals[i]->surface().geometryId();
+    if (geoId.volume() == 0u || geoId.boundary() == 0u) {
+      continue;
+    }
+    const std::size_t slot = m_portalOffsets[geoId.volume()] + geoId.boundary();
+    claim(m_portalTable[slot], i);
+  }
+
+  std::replace(m_volumeTable.begin(), m_volumeTable.end(), taken, s_noIndex);
+  std::replace(m_portalTable.begin(), m_portalTable.end(), taken, s_noIndex);
+}
@@ -22,6 +22,15 @@
 
 namespace Acts {
 
+auto VectorMultiTrajectory::addSourceLinkSlot() -> IndexType {
+  if (m_sourceLinkTable != nullptr) {
+    m_sourceLinkHandles.emplace_back(SourceLinkTable::kInvalidHandle);
+    return m_sourceLinkHandles.size() - 1;
+  }
+  m_sourceLinks.emplace_back(std::nullopt);
+  return m_sourceLinks.size() - 1;
+}
+
 auto VectorMultiTrajectory::addTrackState_impl(TrackStatePropMask mask,
                                                IndexType iprevious)
     -> IndexType {
@@ -65,15 +74,13 @@ auto VectorMultiTrajectory::addTrackState_impl(TrackStatePropMask mask,
     p.ijacobian = m_jac.size() - 1;
   }
 
-  m_sourceLinks.emplace_back(std::nullopt);
-  p.iuncalibrated = m_sourceLinks.size() - 1;
+  p.iuncalibrated = addSourceLinkSlot();
 
   m_measOffset.push_back(kInvalid);
   m_measCovOffset.push_back(kInvalid);
 
   if (ACTS_CHECK_BIT(mask, PropMask::Calibrated)) {
-    m_sourceLinks.emplace_back(std::nullopt);
-    p.icalibratedsourcelink = m_sourceLinks.size() - 1;
+    p.icalibratedsourcelink = addSourceLinkSlot();
 
     m_projectors.emplace_back();
     p.iprojector = m_projectors.size() - 1;
@@ -179,6 +186,7 @@ void VectorMultiTrajectory::clear_impl() {
   m_measCovOffset.clear();
   m_jac.clear();
   m_sourceLinks.clear();
+  m_sourceLinkHandles.clear();
   m_projectors.clear();
   m_referenceSurfaces.clear();
   for (auto& [key, vec] : m_dynamic) {
@@ -235,7 +243,11 @@ void VectorMultiTrajectory::reserve(std::size_t n) {
   m_measCov.reserve(n * 2 * 2);
   m_measCovOffset.reserve(n);
   m_jac.reserve(n);
-  m_sourceLinks.reserve(n);
+  if (m_sourceLinkTable != nullptr) {
+    m_sourceLinkHandles.reserve(n);
+  } else {
+    m_sourceLinks.reserve(n);
+  }
   m_projectors.reserve(n);
   m_referenceSurfaces.reserve(n);
 
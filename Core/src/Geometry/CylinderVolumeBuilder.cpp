@@ -28,6 +28,7 @@
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <vector>
 
@@ -80,12 +81,20 @@ Acts::CylinderVolumeBuilder::trackingVolume(
 
   // the layers are built by the layer builder
   if (m_cfg.layerBuilder) {
-    // the negative Layers
-    negativeLayers = m_cfg.layerBuilder->negativeLayers(gctx);
-    // the central Layers
-    centralLayers = m_cfg.layerBuilder->centralLayers(gctx);
-    // the positive Layer
-    positiveLayers = m_cfg.layerBuilder->positiveLayers(gctx);
+    auto start = std::chrono::steady_clock::now();
+    // the negative, central and positive layers are independent
+    executeTasks(m_cfg.layerExecutor, 3u, [&](std::size_t il) {
+      if (il == 0u) {
+        negativeLayers = m_cfg.layerBuilder->negativeLayers(gctx);
+      } else if (il == 1u) {
+        centralLayers = m_cfg.layerBuilder->centralLayers(gctx);
+      } else {
+        positiveLayers = m_cfg.layerBuilder->positiveLayers(gctx);
+      }
+    });
+    std::chrono::duration<double, std::milli> buildTime =
+        std::chrono::steady_clock::now() - start;
+    ACTS_DEBUG("-> Layers built in " << buildTime.count() << " ms.");
   }
   ACTS_DEBUG("-> Building layers complete");
 
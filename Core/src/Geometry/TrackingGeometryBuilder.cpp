@@ -9,11 +9,23 @@
 #include "Acts/Geometry/TrackingGeometryBuilder.hpp"
 
 #include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Utilities/Enumerate.hpp"
 
+#include <chrono>
 #include <functional>
 #include <stdexcept>
 #include <utility>
 
+namespace {
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
 Acts::TrackingGeometryBuilder::TrackingGeometryBuilder(
     const Acts::TrackingGeometryBuilder::Config& cgbConfig,
     std::unique_ptr<const Logger> logger)
@@ -44,10 +56,13 @@ Acts::TrackingGeometryBuilder::trackingGeometry(
     const GeometryContext& gctx) const {
   MutableTrackingVolumePtr highestVolume = nullptr;
   // loop over the builders and wrap one around the other
-  for (auto& volumeBuilder : m_cfg.trackingVolumeBuilders) {
+  for (auto [ib, volumeBuilder] : enumerate(m_cfg.trackingVolumeBuilders)) {
+    auto start = std::chrono::steady_clock::now();
     // assign a new highest volume (and potentially wrap around the given
     // highest volume so far)
     auto volume = volumeBuilder(gctx, highestVolume, nullptr);
+    ACTS_DEBUG("Volume builder " << ib << " finished in "
+                                 << elapsedMilliseconds(start) << " ms.");
     if (!volume) {
       ACTS_INFO(
           "Received nullptr volume from builder, keeping previous highest "
@@ -59,10 +74,13 @@ Acts::TrackingGeometryBuilder::trackingGeometry(
 
   // create the TrackingGeometry & decorate it with the material
   if (highestVolume) {
-    return std::make_unique<TrackingGeometry>(
+    auto start = std::chrono::steady_clock::now();
+    auto trackingGeometry = std::make_unique<TrackingGeometry>(
         highestVolume,
         m_cfg.materialDecorator ? m_cfg.materialDecorator.get() : nullptr,
         *m_cfg.geometryIdentifierHook, logger());
+    ACTS_DEBUG("Geometry closed in " << elapsedMilliseconds(start) << " ms.");
+    return trackingGeometry;
   } else {
     throw std::runtime_error(
         "Unable to construct tracking geometry: no tracking volume");
@@ -0,0 +1,103 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Navigation/StaticNavigationPolicy.hpp"
+
+#include "Acts/Detector/Detector.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <unordered_set>
+
+namespace {
+
+/// Resolve a delegate instance against the alternatives of a variant of
+/// implementation pointers
+///
+/// @return true if the instance is one of the alternatives
+template <typename variant_t, std::size_t kIndex = 0u>
+bool resolve(const Acts::Experimental::INavigationDelegate* instance,
+             variant_t& resolved) {
+  if constexpr (kIndex < std::variant_size_v<variant_t>) {
+    using impl_pointer_t = std::variant_alternative_t<kIndex, variant_t>;
+    const auto* casted = dynamic_cast<impl_pointer_t>(instance);
+    if (casted != nullptr) {
+      resolved = casted;
+      return true;
+    }
+    return resolve<variant_t, kIndex + 1u>(instance, resolved);
+  } else {
+    return false;
+  }
+}
+
+}  // namespace
+
+const Acts::Experimental::EndOfWorldImpl
+    Acts::Experimental::StaticNavigationPolicy::s_endOfWorld = {};
+
+Acts::Experimental::StaticNavigationPolicy::StaticNavigationPolicy(
+    const Detector& detector) {
+  std::vector<const DetectorVolume*> volumes;
+  std::vector<const Portal*> portals;
+  std::unordered_set<const Portal*> seen;
+  for (const auto* volume : detector.volumes()) {
+    const auto* instance = volume->surfaceCandidatesUpdater().instance();
+    SurfaceCandidatesImpl resolved;
+    if (instance != nullptr && resolve(instance, resolved)) {
+      m_surfaceCandidatesImpls.emplace_back(resolved);
+    } else {
+      m_surfaceCandidatesImpls.emplace_back(std::nullopt);
+    }
+    volumes.push_back(volume);
+
+    // Shared portals are resolved once
+    for (const auto* portal : volume->portals()) {
+      if (seen.insert(portal).second) {
+        m_detectorVolumeImpls.push_back(resolvePortal(*portal));
+        portals.push_back(portal);
+      }
+    }
+  }
+  m_lookup = detail::DetectorObjectLookup(std::move(volumes),
+                                          std::move(portals));
+}
+
+std::size_t Acts::Experimental::StaticNavigationPolicy::resolvedVolumes()
+    const {
+  return std::count_if(m_surfaceCandidatesImpls.begin(),
+                       m_surfaceCandidatesImpls.end(),
+                       [](const auto& impl) { return impl.has_value(); });
+}
+
+std::size_t Acts::Experimental::StaticNavigationPolicy::resolvedPortals()
+    const {
+  return std::count_if(m_detectorVolumeImpls.begin(),
+                       m_detectorVolumeImpls.end(),
+                       [](const auto& impls) { return impls.has_value(); });
+}
+
+std::optional<std::array<
+    Acts::Experimental::StaticNavigationPolicy::DetectorVolumeImpl, 2u>>
+Acts::Experimental::StaticNavigationPolicy::resolvePortal(
+    const Portal& portal) {
+  std::array<DetectorVolumeImpl, 2u> resolved;
+  const auto& updaters = portal.detectorVolumeUpdaters();
+  for (std::size_t i = 0u; i < updaters.size(); ++i) {
+    if (!updaters[i].connected()) {
+      resolved[i] = &s_endOfWorld;
+      continue;
+    }
+    const auto* instance = updaters[i].instance();
+    if (instance == nullptr || !resolve(instance, resolved[i])) {
+      // Keep the portal delegates for both sides
+      return std::nullopt;
+    }
+  }
+  return resolved;
+}
@@ -97,7 +97,7 @@ Acts::Result<Acts::Vector2> Acts::DiscSurface::globalToLocal(
     const GeometryContext& gctx, const Vector3& position,
     double tolerance) const {
   // transport it to the globalframe
-  Vector3 loc3Dframe = (transform(gctx).inverse()) * position;
+  Vector3 loc3Dframe = inverseTransform(gctx) * position;
   if (std::abs(loc3Dframe.z()) > std::abs(tolerance)) {
     return Result<Vector2>::failure(SurfaceError::GlobalPositionNotOnSurface);
   }
@@ -136,7 +136,7 @@ Acts::Vector3 Acts::DiscSurface::localCartesianToGlobal(
 Acts::Vector2 Acts::DiscSurface::globalToLocalCartesian(
     const GeometryContext& gctx, const Vector3& position,
     double /*direction*/) const {
-  Vector3 loc3Dframe = (transform(gctx).inverse()) * position;
+  Vector3 loc3Dframe = inverseTransform(gctx) * position;
   return Vector2(loc3Dframe.x(), loc3Dframe.y());
 }
 
@@ -258,7 +258,7 @@ Acts::FreeToBoundMatrix Acts::DiscSurface::freeToBoundJacobian(
   RotationMatrix3 rframeT =
       referenceFrame(gctx, position, direction).transpose();
   // calculate the transformation to local coordinates
-  const Vector3 pos_loc = transform(gctx).inverse() * position;
+  const Vector3 pos_loc = inverseTransform(gctx) * position;
   const double lr = perp(pos_loc);
   const double lphi = phi(pos_loc);
   const double lcphi = std::cos(lphi);
@@ -319,10 +319,8 @@ Acts::ActsMatrix<2, 3> Acts::DiscSurface::localCartesianToBoundLocalDerivative(
     const GeometryContext& gctx, const Vector3& position) const {
   using VectorHelpers::perp;
   using VectorHelpers::phi;
-  // The local frame transform
-  const auto& sTransform = transform(gctx);
   // calculate the transformation to local coordinates
-  const Vector3 localPos = sTransform.inverse() * position;
+  const Vector3 localPos = inverseTransform(gctx) * position;
   const double lr = perp(localPos);
   const double lphi = phi(localPos);
   const double lcphi = std::cos(lphi);
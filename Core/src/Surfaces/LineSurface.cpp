@@ -317,7 +317,7 @@ Acts::AlignmentToPathMatrix Acts::LineSurface::alignmentToPathDerivative(
 Acts::ActsMatrix<2, 3> Acts::LineSurface::localCartesianToBoundLocalDerivative(
     const GeometryContext& gctx, const Vector3& position) const {
   // calculate the transformation to local coordinates
-  Vector3 localPosition = transform(gctx).inverse() * position;
+  Vector3 localPosition = inverseTransform(gctx) * position;
   double localPhi = VectorHelpers::phi(localPosition);
 
   ActsMatrix<2, 3> loc3DToLocBound = ActsMatrix<2, 3>::Zero();
@@ -0,0 +1,168 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
+
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Surfaces/detail/PlanarHelper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+Acts::PlaneSurfaceBatch::PlaneSurfaceBatch(
+    const GeometryContext& gctx, std::vector<const PlaneSurface*> surfaces)
+    : m_surfaces(std::move(surfaces)) {
+  const std::size_t n = m_surfaces.size();
+  for (auto* v : {&m_cx, &m_cy, &m_cz, &m_ux, &m_uy, &m_uz, &m_vx, &m_vy,
+                  &m_vz, &m_nx, &m_ny, &m_nz, &m_bx, &m_by, &m_bhy, &m_bhx,
+                  &m_bslope, &m_bhxMin, &m_bhxMax}) {
+    v->reserve(n);
+  }
+  m_generic.reserve(n);
+
+  constexpr ActsScalar inf = std::numeric_limits<ActsScalar>::infinity();
+  for (const auto* surface : m_surfaces) {
+    if (surface == nullptr) {
+      throw std::invalid_argument("PlaneSurfaceBatch: nullptr surface given.");
+    }
+    const auto& tMatrix = surface->transform(gctx).matrix();
+    m_ux.push_back(tMatrix(0, 0));
+    m_uy.push_back(tMatrix(1, 0));
+    m_uz.push_back(tMatrix(2, 0));
+    m_vx.push_back(tMatrix(0, 1));
+    m_vy.push_back(tMatrix(1, 1));
+    m_vz.push_back(tMatrix(2, 1));
+    m_nx.push_back(tMatrix(0, 2));
+    m_ny.push_back(tMatrix(1, 2));
+    m_nz.push_back(tMatrix(2, 2));
+    m_cx.push_back(tMatrix(0, 3));
+    m_cy.push_back(tMatrix(1, 3));
+    m_cz.push_back(tMatrix(2, 3));
+
+    // Rectangles and trapezoids as trapezoid, everything else is generic
+    ActsScalar bx = 0., by = 0., bhy = inf, bhxNeg = inf, bhxPos = inf;
+    bool generic = false;
+    const SurfaceBounds* bounds = &surface->bounds();
+    const auto* rBounds = dynamic_cast<const RectangleBounds*>(bounds);
+    const auto* tBounds = dynamic_cast<const TrapezoidBounds*>(bounds);
+    if (rBounds != nullptr) {
+      bx = 0.5 * (rBounds->min().x() + rBounds->max().x());
+      by = 0.5 * (rBounds->min().y() + rBounds->max().y());
+      bhy = 0.5 * (rBounds->max().y() - rBounds->min().y());
+      bhxNeg = bhxPos = 0.5 * (rBounds->max().x() - rBounds->min().x());
+    } else if (tBounds != nullptr) {
+      bhy = tBounds->get(TrapezoidBounds::eHalfLengthY);
+      bhxNeg = tBounds->get(TrapezoidBounds::eHalfLengthXnegY);
+      bhxPos = tBounds->get(TrapezoidBounds::eHalfLengthXposY);
+    } else {
+      generic = true;
+    }
+    m_bx.push_back(bx);
+    m_by.push_back(by);
+    m_bhy.push_back(bhy);
+    m_bhx.push_back(generic ? inf : 0.5 * (bhxNeg + bhxPos));
+    m_bslope.push_back(generic ? 0. : 0.5 * (bhxPos - bhxNeg) / bhy);
+    m_bhxMin.push_back(std::min(bhxNeg, bhxPos));
+    m_bhxMax.push_back(std::max(bhxNeg, bhxPos));
+    m_generic.push_back(generic ? 1u : 0u);
+  }
+}
+
+void Acts::PlaneSurfaceBatch::intersect(const Vector3& position,
+                                        const Vector3& direction,
+                                        const BoundaryCheck& bcheck,
+                                        ActsScalar tolerance,
+                                        Intersections& intersections) const {
+  const std::size_t n = m_surfaces.size();
+  intersections.position = position;
+  intersections.direction = direction;
+  intersections.pathLength.resize(n);
+  intersections.loc0.resize(n);
+  intersections.loc1.resize(n);
+  intersections.status.resize(n);
+  intersections.boundsDecision.resize(n);
+
+  const ActsScalar px = position.x(), py = position.y(), pz = position.z();
+  const ActsScalar dx = direction.x(), dy = direction.y(), dz = direction.z();
+
+  const bool checkBounds = bcheck.isEnabled();
+  const bool absolute = bcheck.type() == BoundaryCheck::Type::eAbsolute;
+  const ActsScalar tol0 = absolute ? bcheck.tolerance()[eBoundLoc0] : 0.;
+  const ActsScalar tol1 = absolute ? bcheck.tolerance()[eBoundLoc1] : 0.;
+
+  ActsScalar* pathLength = intersections.pathLength.data();
+  ActsScalar* loc0 = intersections.loc0.data();
+  ActsScalar* loc1 = intersections.loc1.data();
+  Intersection3D::Status* status = intersections.status.data();
+  std::uint8_t* decision = intersections.boundsDecision.data();
+
+  // The branch free loop over all surfaces
+  for (std::size_t i = 0; i < n; ++i) {
+    const ActsScalar denom = dx * m_nx[i] + dy * m_ny[i] + dz * m_nz[i];
+    const ActsScalar ox = m_cx[i] - px;
+    const ActsScalar oy = m_cy[i] - py;
+    const ActsScalar oz = m_cz[i] - pz;
+    const bool valid = denom != 0.;
+    const ActsScalar path =
+        (m_nx[i] * ox + m_ny[i] * oy + m_nz[i] * oz) / (valid ? denom : 1.);
+    // Local position relative to the surface center, from the intersection
+    // position in the same way as PlaneSurface::intersect
+    const ActsScalar gx = (px + path * dx) - m_cx[i];
+    const ActsScalar gy = (py + path * dy) - m_cy[i];
+    const ActsScalar gz = (pz + path * dz) - m_cz[i];
+    const ActsScalar l0 = m_ux[i] * gx + m_uy[i] * gy + m_uz[i] * gz;
+    const ActsScalar l1 = m_vx[i] * gx + m_vy[i] * gy + m_vz[i] * gz;
+
+    // Bounds decision, mirroring the rectangle and trapezoid checks
+    const ActsScalar r0 = std::abs(l0 - m_bx[i]);
+    const ActsScalar r1 = l1 - m_by[i];
+    const ActsScalar d1 = std::abs(r1) - m_bhy[i];
+    const bool strictlyInside = d1 <= 0. && r0 <= m_bhx[i] + m_bslope[i] * r1;
+    const bool outside = d1 > tol1 || r0 - m_bhxMax[i] > tol0;
+    const bool inside = d1 <= tol1 && r0 - m_bhxMin[i] <= tol0;
+    std::uint8_t code = absolute ? (outside ? 0u : (inside ? 1u : 2u))
+                                 : (strictlyInside ? 1u : 2u);
+    code = m_generic[i] != 0u ? 2u : code;
+    code = checkBounds ? code : 1u;
+
+    pathLength[i] = valid ? path : std::numeric_limits<ActsScalar>::infinity();
+    loc0[i] = l0;
+    loc1[i] = l1;
+    status[i] = valid ? PlanarHelper::intersectionStatus(path, tolerance)
+                      : Intersection3D::Status::unreachable;
+    decision[i] = valid ? code : 1u;
+  }
+
+  // Resolve the remaining boundary checks with the surface
+  for (std::size_t i = 0; i < n; ++i) {
+    if (decision[i] == 2u) {
+      decision[i] =
+          m_surfaces[i]->insideBounds(Vector2(loc0[i], loc1[i]), bcheck) ? 1u
+                                                                        : 0u;
+    }
+    if (decision[i] == 0u) {
+      status[i] = Intersection3D::Status::missed;
+    }
+  }
+}
+
+Acts::SurfaceIntersection Acts::PlaneSurfaceBatch::intersection(
+    const Intersections& intersections, std::size_t index) const {
+  const ActsScalar path = intersections.pathLength[index];
+  const Vector3 position =
+      std::isfinite(path)
+          ? Vector3(intersections.position + path * intersections.direction)
+          : Vector3(Vector3::Zero());
+  return SurfaceIntersection(
+      Intersection3D(position, path, intersections.status[index]),
+      m_surfaces[index]);
+}
@@ -17,14 +17,43 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+/// Detect the inverse transform of a detector element, a replacement of
+/// the detector element base class might not provide it
+template <typename element_t, typename = void>
+struct HasInverseTransform : std::false_type {};
+
+template <typename element_t>
+struct HasInverseTransform<
+    element_t, std::void_t<decltype(std::declval<const element_t&>()
+                                        .inverseTransform(std::declval<
+                                            const Acts::GeometryContext&>()))>>
+    : std::true_type {};
+
+template <typename element_t>
+Acts::Transform3 elementInverseTransform(const element_t& element,
+                                         const Acts::GeometryContext& gctx) {
+  if constexpr (HasInverseTransform<element_t>::value) {
+    return element.inverseTransform(gctx);
+  } else {
+    return element.transform(gctx).inverse();
+  }
+}
+
+}  // namespace
+
 std::array<std::string, Acts::Surface::SurfaceType::Other>
     Acts::Surface::s_surfaceTypeNames = {
         "Cone", "Cylinder", "Disc", "Perigee", "Plane", "Straw", "Curvilinear"};
 
 Acts::Surface::Surface(const Transform3& transform)
-    : GeometryObject(), m_transform(transform) {}
+    : GeometryObject(),
+      m_transform(transform),
+      m_inverseTransform(transform.inverse()) {}
 
 Acts::Surface::Surface(const DetectorElementBase& detelement)
     : GeometryObject(), m_associatedDetElement(&detelement) {}
@@ -33,12 +62,14 @@ Acts::Surface::Surface(const Surface& other)
     : GeometryObject(other),
       std::enable_shared_from_this<Surface>(),
       m_transform(other.m_transform),
+      m_inverseTransform(other.m_inverseTransform),
       m_surfaceMaterial(other.m_surfaceMaterial) {}
 
 Acts::Surface::Surface(const GeometryContext& gctx, const Surface& other,
                        const Transform3& shift)
     : GeometryObject(),
       m_transform(shift * other.transform(gctx)),
+      m_inverseTransform(m_transform.inverse()),
       m_surfaceMaterial(other.m_surfaceMaterial) {}
 
 Acts::Surface::~Surface() = default;
@@ -174,6 +205,7 @@ Acts::Surface& Acts::Surface::operator=(const Surface& other) {
     GeometryObject::operator=(other);
     // detector element, identifier & layer association are unique
     m_transform = other.m_transform;
+    m_inverseTransform = other.m_inverseTransform;
     m_associatedLayer = other.m_associatedLayer;
     m_surfaceMaterial = other.m_surfaceMaterial;
     m_associatedDetElement = other.m_associatedDetElement;
@@ -260,6 +292,14 @@ const Acts::Transform3& Acts::Surface::transform(
   return m_transform;
 }
 
+Acts::Transform3 Acts::Surface::inverseTransform(
+    const GeometryContext& gctx) const {
+  if (m_associatedDetElement != nullptr) {
+    return elementInverseTransform(*m_associatedDetElement, gctx);
+  }
+  return m_inverseTransform;
+}
+
 bool Acts::Surface::insideBounds(const Vector2& lposition,
                                  const BoundaryCheck& bcheck) const {
   return bounds().inside(lposition, bcheck);
@@ -368,6 +408,7 @@ void Acts::Surface::assignDetectorElement(
   // resetting the transform as it will be handled through the detector element
   // now
   m_transform = Transform3::Identity();
+  m_inverseTransform = Transform3::Identity();
 }
 
 void Acts::Surface::assignSurfaceMaterial(
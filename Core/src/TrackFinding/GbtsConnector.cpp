@@ -119,7 +119,9 @@ GbtsConnector::GbtsConnector(std::ifstream &inFile) {
       zeroLayers.insert(layerCounts.first);
     }
 
-    // remove connections which use zeroLayer as destination
+    // remove connections which use zeroLayer as destination. No layer is
+    // hence source and destination in the same stage, the doublet making in
+    // SeedFinderGbts relies on this.
 
     std::vector<const GbtsConnection *> theStage;
 
@@ -8,44 +8,27 @@
 
 #include "Acts/TrackFitting/GsfMixtureReduction.hpp"
 
+#include "Acts/TrackFitting/detail/FixedSizeSymmetricKlDistanceMatrix.hpp"
 #include "Acts/TrackFitting/detail/SymmetricKlDistanceMatrix.hpp"
 
-template <typename proj_t, typename angle_desc_t>
-void reduceWithKLDistanceImpl(std::vector<Acts::GsfComponent> &cmpCache,
-                              std::size_t maxCmpsAfterMerge, const proj_t &proj,
-                              const angle_desc_t &desc) {
-  Acts::detail::SymmetricKLDistanceMatrix distances(cmpCache, proj);
+namespace {
 
-  auto remainingComponents = cmpCache.size();
+/// Mixtures up to these sizes are reduced with a fixed size distance matrix
+/// of the respective capacity, larger ones fall back to the dynamic
+/// implementation. The medium capacity covers the 72 components of a typical
+/// production configuration (12 components times 6 Bethe-Heitler
+/// components) and still fits on the stack, the largest is allocated on the
+/// heap by reduceWithKLDistance.
+constexpr std::size_t s_maxSmallComponents = 32;
+constexpr std::size_t s_maxMediumComponents = 80;
+constexpr std::size_t s_maxFixedSizeComponents = 128;
 
-  while (remainingComponents > maxCmpsAfterMerge) {
-    const auto [minI, minJ] = distances.minDistancePair();
+static_assert(sizeof(Acts::detail::FixedSizeSymmetricKLDistanceMatrix<
+                     s_maxMediumComponents>) <=
+                  Acts::detail::s_maxStackDistanceMatrixSize,
+              "The medium distance matrix must not be heap allocated");
 
-    // Set one component and compute associated distances
-    cmpCache[minI] =
-        mergeComponents(cmpCache[minI], cmpCache[minJ], proj, desc);
-    distances.recomputeAssociatedDistances(minI, cmpCache, proj);
-
-    // Set weight of the other component to -1 so we can remove it later and
-    // mask its distances
-    proj(cmpCache[minJ]).weight = -1.0;
-    distances.maskAssociatedDistances(minJ);
-
-    remainingComponents--;
-  }
-
-  // Remove all components which are labeled with weight -1
-  std::sort(cmpCache.begin(), cmpCache.end(),
-            [&](const auto &a, const auto &b) {
-              return proj(a).weight < proj(b).weight;
-            });
-  cmpCache.erase(
-      std::remove_if(cmpCache.begin(), cmpCache.end(),
-                     [&](const auto &a) { return proj(a).weight == -1.0; }),
-      cmpCache.end());
-
-  assert(cmpCache.size() == maxCmpsAfterMerge && "size mismatch");
-}
+}  // namespace
 
 namespace Acts {
 
@@ -74,7 +57,22 @@ void reduceMixtureWithKLDistance(std::vector<Acts::GsfComponent> &cmpCache,
   // We must differ between surface types, since there can be different
   // local coordinates
   detail::angleDescriptionSwitch(surface, [&](const auto &desc) {
-    reduceWithKLDistanceImpl(cmpCache, maxCmpsAfterMerge, proj, desc);
+    if (cmpCache.size() <= s_maxSmallComponents) {
+      detail::reduceWithKLDistance<
+          detail::FixedSizeSymmetricKLDistanceMatrix<s_maxSmallComponents>>(
+          cmpCache, maxCmpsAfterMerge, proj, desc);
+    } else if (cmpCache.size() <= s_maxMediumComponents) {
+      detail::reduceWithKLDistance<
+          detail::FixedSizeSymmetricKLDistanceMatrix<s_maxMediumComponents>>(
+          cmpCache, maxCmpsAfterMerge, proj, desc);
+    } else if (cmpCache.size() <= s_maxFixedSizeComponents) {
+      detail::reduceWithKLDistance<
+          detail::FixedSizeSymmetricKLDistanceMatrix<s_maxFixedSizeComponents>>(
+          cmpCache, maxCmpsAfterMerge, proj, desc);
+    } else {
+      detail::reduceWithKLDistance<detail::SymmetricKLDistanceMatrix>(
+          cmpCache, maxCmpsAfterMerge, proj, desc);
+    }
   });
 }
 
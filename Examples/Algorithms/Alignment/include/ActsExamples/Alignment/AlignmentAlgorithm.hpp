@@ -100,6 +100,8 @@ class AlignmentAlgorithm final : public IAlgorithm {
     std::shared_ptr<AlignmentFunction> align;
     /// The aligned transform updater
     ActsAlignment::AlignedTransformUpdater alignedTransformUpdater;
+    /// The optional committer of the aligned transforms of an iteration
+    ActsAlignment::AlignedTransformsCommitter alignedTransformsCommitter;
     /// The surfaces (with detector elements) to be aligned
     std::vector<Acts::DetectorElementBase*> alignedDetElements;
     /// The alignment mask at each iteration
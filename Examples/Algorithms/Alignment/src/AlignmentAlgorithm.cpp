@@ -15,6 +15,7 @@
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
 ActsExamples::AlignmentAlgorithm::AlignmentAlgorithm(Config cfg,
                                                      Acts::Logging::Level lvl)
@@ -121,6 +122,10 @@ ActsExamples::ProcessCode ActsExamples::AlignmentAlgorithm::execute(
   ActsAlignment::AlignmentOptions<TrackFitterOptions> alignOptions(
       kfOptions, m_cfg.alignedTransformUpdater, m_cfg.alignedDetElements,
       m_cfg.chi2ONdfCutOff, m_cfg.deltaChi2ONdfCutOff, m_cfg.maxNumIterations);
+  alignOptions.alignedTransformsCommitter = m_cfg.alignedTransformsCommitter;
+  // The fitter extensions above are stateless, the tracks can be fitted
+  // concurrently
+  alignOptions.executor = tbbWrap::parallelExecutor();
 
   ACTS_DEBUG("Invoke track-based alignment with " << numTracksUsed
                                                   << " input tracks");
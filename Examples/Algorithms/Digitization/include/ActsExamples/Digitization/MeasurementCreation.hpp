@@ -44,6 +44,18 @@ struct DigitizedParameters {
 Measurement createMeasurement(const DigitizedParameters& dParams,
                               const IndexSourceLink& isl) noexcept(false);
 
+/// Helper method for adding a measurement from digitized parameters to the
+/// measurement container, without creating a variant measurement
+///
+/// @param container The measurement container to add the measurement to
+/// @param dParams The digitized parameters of variable size
+/// @param isl The indexed source link for the measurement
+///
+/// @return the index of the measurement in the container
+std::size_t createMeasurement(MeasurementContainer& container,
+                              const DigitizedParameters& dParams,
+                              const IndexSourceLink& isl) noexcept(false);
+
 /// Construct the constituents of a measurement.
 ///
 /// @tparam kMeasDIM the full dimension of the measurement
@@ -53,6 +53,12 @@ class ModuleClusters {
   std::vector<std::pair<DigitizedParameters, std::set<simhit_t>>>
   digitizedParameters();
 
+  /// Same as above, using the given scratch memory for the clusterization
+  ///
+  /// @param buffer the clusterization scratch memory, reused between modules
+  std::vector<std::pair<DigitizedParameters, std::set<simhit_t>>>
+  digitizedParameters(Acts::Ccl::RowScanBuffer& buffer);
+
  private:
   Acts::BinUtility m_segmentation;
   std::vector<Acts::BoundIndices> m_geoIndices;
@@ -62,7 +68,7 @@ class ModuleClusters {
   bool m_commonCorner;
 
   std::vector<ModuleValue> createCellCollection();
-  void merge();
+  void merge(Acts::Ccl::RowScanBuffer& buffer);
   ModuleValue squash(std::vector<ModuleValue>& values);
   std::vector<std::size_t> nonGeoEntries(
       std::vector<Acts::BoundIndices>& indices);
@@ -23,19 +23,24 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Utilities/GroupBy.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
+#include <random>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
+#include <tbb/enumerable_thread_specific.h>
+
 ActsExamples::DigitizationAlgorithm::DigitizationAlgorithm(
     DigitizationConfig config, Acts::Logging::Level level)
     : ActsExamples::IAlgorithm("DigitizationAlgorithm", level),
@@ -147,20 +152,18 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
   measurementParticlesMap.reserve(simHits.size());
   measurementSimHitsMap.reserve(simHits.size());
 
-  // Setup random number generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-
-  // Some statistics
-  std::size_t skippedHits = 0;
+  // Collect the modules to digitize, this is cheap and done serially so the
+  // geometry lookup failures can abort the event.
+  struct Module {
+    Acts::GeometryIdentifier geoId;
+    Range<SimHitContainer::const_iterator> simHits;
+    const Acts::Surface* surface = nullptr;
+    const Digitizer* digitizer = nullptr;
+  };
+  std::vector<Module> modules;
 
-  ACTS_DEBUG("Starting loop over modules ...");
   for (const auto& simHitsGroup : groupByModule(simHits)) {
-    // Manual pair unpacking instead of using
-    //   auto [moduleGeoId, moduleSimHits] : ...
-    // otherwise clang on macos complains that it is unable to capture the local
-    // binding in the lambda used for visiting the smearer below.
     Acts::GeometryIdentifier moduleGeoId = simHitsGroup.first;
-    const auto& moduleSimHits = simHitsGroup.second;
 
     const Acts::Surface* surfacePtr =
         m_cfg.trackingGeometry->findSurface(moduleGeoId);
@@ -181,105 +184,145 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
       ACTS_VERBOSE("Digitizer found for module " << moduleGeoId);
     }
 
-    // Run the digitizer. Iterate over the hits for this surface inside the
-    // visitor so we do not need to lookup the variant object per-hit.
-    std::visit(
-        [&](const auto& digitizer) {
-          ModuleClusters moduleClusters(
-              digitizer.geometric.segmentation, digitizer.geometric.indices,
-              m_cfg.doMerge, m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
-
-          for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
-            const auto& simHit = *h;
-            const auto simHitIdx = simHits.index_of(h);
-
-            DigitizedParameters dParameters;
-
-            if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
-              ACTS_VERBOSE("Skip hit because energy deposit to small")
-              continue;
-            }
-
-            // Geometric part - 0, 1, 2 local parameters are possible
-            if (!digitizer.geometric.indices.empty()) {
-              ACTS_VERBOSE("Configured to geometric digitize "
-                           << digitizer.geometric.indices.size()
-                           << " parameters.");
-              const auto& cfg = digitizer.geometric;
-              Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
-              auto channelsRes = m_channelizer.channelize(
-                  simHit, *surfacePtr, ctx.geoContext, driftDir,
-                  cfg.segmentation, cfg.thickness);
-              if (!channelsRes.ok() || channelsRes->empty()) {
-                ACTS_DEBUG(
-                    "Geometric channelization did not work, skipping this hit.")
-                continue;
-              }
-              ACTS_VERBOSE("Activated " << channelsRes->size()
-                                        << " channels for this hit.");
-              dParameters =
-                  localParameters(digitizer.geometric, *channelsRes, rng);
-            }
-
-            // Smearing part - (optionally) rest
-            if (!digitizer.smearing.indices.empty()) {
-              ACTS_VERBOSE("Configured to smear "
-                           << digitizer.smearing.indices.size()
-                           << " parameters.");
-              auto res =
-                  digitizer.smearing(rng, simHit, *surfacePtr, ctx.geoContext);
-              if (!res.ok()) {
-                ++skippedHits;
-                ACTS_DEBUG("Problem in hit smearing, skip hit ("
-                           << res.error().message() << ")");
-                continue;
-              }
-              const auto& [par, cov] = res.value();
-              for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
-                dParameters.indices.push_back(digitizer.smearing.indices[ip]);
-                dParameters.values.push_back(par[ip]);
-                dParameters.variances.push_back(cov(ip, ip));
-              }
-            }
-
-            // Check on success - threshold could have eliminated all channels
-            if (dParameters.values.empty()) {
-              ACTS_VERBOSE(
-                  "Parameter digitization did not yield a measurement.")
-              continue;
-            }
-
-            moduleClusters.add(std::move(dParameters), simHitIdx);
-          }
-
-          for (auto& [dParameters, simhits] :
-               moduleClusters.digitizedParameters()) {
-            // The measurement container is unordered and the index under which
-            // the measurement will be stored is known before adding it.
-            Index measurementIdx = measurements.size();
-            IndexSourceLink sourceLink{moduleGeoId, measurementIdx};
-
-            // Add to output containers:
-            // index map and source link container are geometry-ordered.
-            // since the input is also geometry-ordered, new items can
-            // be added at the end.
-            sourceLinks.insert(sourceLinks.end(), sourceLink);
-
-            measurements.emplace_back(
-                createMeasurement(dParameters, sourceLink));
-            clusters.emplace_back(std::move(dParameters.cluster));
-            // this digitization does hit merging so there can be more than one
-            // mapping entry for each digitized hit.
-            for (auto simHitIdx : simhits) {
-              measurementParticlesMap.emplace_hint(
-                  measurementParticlesMap.end(), measurementIdx,
-                  simHits.nth(simHitIdx)->particleId());
-              measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
-                                                 measurementIdx, simHitIdx);
-            }
-          }
-        },
-        *digitizerItr);
+    modules.push_back(
+        {moduleGeoId, simHitsGroup.second, surfacePtr, &(*digitizerItr)});
+  }
+
+  // The per-module results, merged into the outputs in module order below
+  struct ModuleOutput {
+    std::vector<
+        std::pair<DigitizedParameters, std::set<ModuleClusters::simhit_t>>>
+        parameters;
+    std::size_t skippedHits = 0;
+  };
+  std::vector<ModuleOutput> moduleOutputs(modules.size());
+
+  // Digitize the modules in parallel. Each module uses a generator seeded
+  // from the event seed and its geometry identifier only, which makes the
+  // result independent of the scheduling and the number of threads.
+  tbb::enumerable_thread_specific<Acts::Ccl::RowScanBuffer> buffers;
+  ACTS_DEBUG("Starting loop over " << modules.size() << " modules ...");
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, modules.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        auto& buffer = buffers.local();
+        for (auto im = range.begin(); im != range.end(); ++im) {
+          const Module& module = modules[im];
+          ModuleOutput& output = moduleOutputs[im];
+          auto rng =
+              m_cfg.randomNumbers->spawnGenerator(ctx, module.geoId.value());
+
+          // Run the digitizer. Iterate over the hits for this surface inside
+          // the visitor so we do not need to lookup the variant object
+          // per-hit.
+          std::visit(
+              [&](const auto& digitizer) {
+                ModuleClusters moduleClusters(
+                    digitizer.geometric.segmentation,
+                    digitizer.geometric.indices, m_cfg.doMerge,
+                    m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
+
+                for (auto h = module.simHits.begin();
+                     h != module.simHits.end(); ++h) {
+                  const auto& simHit = *h;
+                  const auto simHitIdx = simHits.index_of(h);
+
+                  DigitizedParameters dParameters;
+
+                  if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
+                    ACTS_VERBOSE("Skip hit because energy deposit to small")
+                    continue;
+                  }
+
+                  // Geometric part - 0, 1, 2 local parameters are possible
+                  if (!digitizer.geometric.indices.empty()) {
+                    ACTS_VERBOSE("Configured to geometric digitize "
+                                 << digitizer.geometric.indices.size()
+                                 << " parameters.");
+                    const auto& cfg = digitizer.geometric;
+                    Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
+                    auto channelsRes = m_channelizer.channelize(
+                        simHit, *module.surface, ctx.geoContext, driftDir,
+                        cfg.segmentation, cfg.thickness);
+                    if (!channelsRes.ok() || channelsRes->empty()) {
+                      ACTS_DEBUG(
+                          "Geometric channelization did not work, skipping "
+                          "this hit.")
+                      continue;
+                    }
+                    ACTS_VERBOSE("Activated " << channelsRes->size()
+                                              << " channels for this hit.");
+                    dParameters =
+                        localParameters(digitizer.geometric, *channelsRes, rng);
+                  }
+
+                  // Smearing part - (optionally) rest
+                  if (!digitizer.smearing.indices.empty()) {
+                    ACTS_VERBOSE("Configured to smear "
+                                 << digitizer.smearing.indices.size()
+                                 << " parameters.");
+                    auto res = digitizer.smearing(rng, simHit, *module.surface,
+                                                  ctx.geoContext);
+                    if (!res.ok()) {
+                      ++output.skippedHits;
+                      ACTS_DEBUG("Problem in hit smearing, skip hit ("
+                                 << res.error().message() << ")");
+                      continue;
+                    }
+                    const auto& [par, cov] = res.value();
+                    for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
+                      dParameters.indices.push_back(
+                          digitizer.smearing.indices[ip]);
+                      dParameters.values.push_back(par[ip]);
+                      dParameters.variances.push_back(cov(ip, ip));
+                    }
+                  }
+
+                  // Check on success - threshold could have eliminated all
+                  // channels
+                  if (dParameters.values.empty()) {
+                    ACTS_VERBOSE(
+                        "Parameter digitization did not yield a measurement.")
+                    continue;
+                  }
+
+                  moduleClusters.add(std::move(dParameters), simHitIdx);
+                }
+
+                output.parameters = moduleClusters.digitizedParameters(buffer);
+              },
+              *module.digitizer);
+        }
+      });
+
+  std::size_t skippedHits = 0;
+  for (std::size_t im = 0; im < modules.size(); ++im) {
+    Acts::GeometryIdentifier moduleGeoId = modules[im].geoId;
+    skippedHits += moduleOutputs[im].skippedHits;
+    for (auto& [dParameters, simhits] : moduleOutputs[im].parameters) {
+      // The measurement container is unordered and the index under which
+      // the measurement will be stored is known before adding it.
+      Index measurementIdx = measurements.size();
+      IndexSourceLink sourceLink{moduleGeoId, measurementIdx};
+
+      // Add to output containers:
+      // index map and source link container are geometry-ordered.
+      // since the input is also geometry-ordered, new items can
+      // be added at the end.
+      sourceLinks.insert(sourceLinks.end(), sourceLink);
+
+      createMeasurement(measurements, dParameters, sourceLink);
+      clusters.emplace_back(std::move(dParameters.cluster));
+      // this digitization does hit merging so there can be more than one
+      // mapping entry for each digitized hit.
+      for (auto simHitIdx : simhits) {
+        measurementParticlesMap.emplace_hint(
+            measurementParticlesMap.end(), measurementIdx,
+            simHits.nth(simHitIdx)->particleId());
+        measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
+                                           measurementIdx, simHitIdx);
+      }
+    }
   }
 
   if (skippedHits > 0) {
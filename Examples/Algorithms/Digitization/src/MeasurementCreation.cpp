@@ -46,3 +46,35 @@ ActsExamples::Measurement ActsExamples::createMeasurement(
       throw std::runtime_error(errorMsg.c_str());
   }
 }
+
+std::size_t ActsExamples::createMeasurement(MeasurementContainer& container,
+                                            const DigitizedParameters& dParams,
+                                            const IndexSourceLink& isl) {
+  Acts::SourceLink sl{isl};
+  switch (dParams.indices.size()) {
+    case 1u: {
+      auto [indices, par, cov] = measurementConstituents<1>(dParams);
+      return container.emplaceMeasurement<1>(std::move(sl), isl.geometryId(),
+                                             indices, par, cov);
+    }
+    case 2u: {
+      auto [indices, par, cov] = measurementConstituents<2>(dParams);
+      return container.emplaceMeasurement<2>(std::move(sl), isl.geometryId(),
+                                             indices, par, cov);
+    };
+    case 3u: {
+      auto [indices, par, cov] = measurementConstituents<3>(dParams);
+      return container.emplaceMeasurement<3>(std::move(sl), isl.geometryId(),
+                                             indices, par, cov);
+    };
+    case 4u: {
+      auto [indices, par, cov] = measurementConstituents<4>(dParams);
+      return container.emplaceMeasurement<4>(std::move(sl), isl.geometryId(),
+                                             indices, par, cov);
+    };
+    default:
+      std::string errorMsg = "Invalid/mismatching measurement dimension: " +
+                             std::to_string(dParams.indices.size());
+      throw std::runtime_error(errorMsg.c_str());
+  }
+}
@@ -45,8 +45,14 @@ void ModuleClusters::add(DigitizedParameters params, simhit_t simhit) {
 
 std::vector<std::pair<DigitizedParameters, std::set<ModuleClusters::simhit_t>>>
 ModuleClusters::digitizedParameters() {
+  Acts::Ccl::RowScanBuffer buffer;
+  return digitizedParameters(buffer);
+}
+
+std::vector<std::pair<DigitizedParameters, std::set<ModuleClusters::simhit_t>>>
+ModuleClusters::digitizedParameters(Acts::Ccl::RowScanBuffer& buffer) {
   if (m_merge) {  // (re-)build the clusters
-    merge();
+    merge(buffer);
   }
   std::vector<std::pair<DigitizedParameters, std::set<simhit_t>>> retv;
   for (ModuleValue& mval : m_moduleValues) {
@@ -99,7 +105,7 @@ std::vector<ModuleValue> ModuleClusters::createCellCollection() {
   return cells;
 }
 
-void ModuleClusters::merge() {
+void ModuleClusters::merge(Acts::Ccl::RowScanBuffer& buffer) {
   std::vector<ModuleValue> cells = createCellCollection();
 
   std::vector<ModuleValue> newVals;
@@ -107,9 +113,9 @@ void ModuleClusters::merge() {
   if (!cells.empty()) {
     // Case where we actually have geometric clusters
     std::vector<std::vector<ModuleValue>> merged =
-        Acts::Ccl::createClusters<std::vector<ModuleValue>,
-                                  std::vector<std::vector<ModuleValue>>>(
-            cells, Acts::Ccl::DefaultConnect<ModuleValue>(m_commonCorner));
+        Acts::Ccl::createClustersRowScan<
+            std::vector<ModuleValue>, std::vector<std::vector<ModuleValue>>>(
+            cells, m_commonCorner, buffer);
 
     for (std::vector<ModuleValue>& cellv : merged) {
       // At this stage, the cellv vector contains cells that form a
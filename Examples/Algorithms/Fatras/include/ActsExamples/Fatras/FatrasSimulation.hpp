@@ -89,6 +89,14 @@ class FatrasSimulation final : public IAlgorithm {
     /// algorithm function. It is used to guess the amount of memory to
     /// pre-allocate to avoid allocation during event simulation.
     std::size_t averageHitsPerParticle = 16u;
+
+    /// Simulate the primary particles of an event concurrently.
+    ///
+    /// Each primary particle and its secondaries are simulated with a
+    /// dedicated random number generator seeded from the event seed and the
+    /// particle id. The output is thus independent of the number of threads,
+    /// but differs from the output of the sequential simulation.
+    bool simulateConcurrently = false;
   };
 
   /// Construct the algorithm from a config.
@@ -24,6 +24,7 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 #include "ActsFatras/Kernel/InteractionList.hpp"
@@ -37,8 +38,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <map>
 #include <ostream>
+#include <random>
 #include <stdexcept>
 #include <system_error>
 #include <utility>
@@ -66,6 +69,32 @@ struct HitSurfaceSelector {
   }
 };
 
+/// Create a random number generator for a single primary particle, keyed by
+/// the particle id.
+struct PrimaryGeneratorFactory {
+  const ActsExamples::RandomNumbers &randomNumbers;
+  const ActsExamples::AlgorithmContext &context;
+
+  ActsExamples::RandomEngine operator()(
+      const ActsFatras::Particle &particle) const {
+    return randomNumbers.spawnGenerator(context, particle.particleId().value());
+  }
+};
+
+/// Run the simulation of the primaries using the tbb thread pool if enabled.
+struct PrimaryExecutor {
+  template <typename body_t>
+  void operator()(std::size_t nPrimaries, const body_t &body) const {
+    ActsExamples::tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nPrimaries),
+        [&](const tbb::blocked_range<std::size_t> &range) {
+          for (auto i = range.begin(); i != range.end(); ++i) {
+            body(i);
+          }
+        });
+  }
+};
+
 }  // namespace
 
 // Same interface as `ActsFatras::Simulation` but with concrete types.
@@ -77,6 +106,15 @@ struct ActsExamples::detail::FatrasSimulation {
       ActsExamples::SimParticleContainer::sequence_type &,
       ActsExamples::SimParticleContainer::sequence_type &,
       ActsExamples::SimHitContainer::sequence_type &) const = 0;
+  virtual Acts::Result<std::vector<ActsFatras::FailedParticle>>
+  simulateConcurrently(
+      const Acts::GeometryContext &, const Acts::MagneticFieldContext &,
+      const ActsExamples::RandomNumbers &,
+      const ActsExamples::AlgorithmContext &,
+      const ActsExamples::SimParticleContainer &,
+      ActsExamples::SimParticleContainer::sequence_type &,
+      ActsExamples::SimParticleContainer::sequence_type &,
+      ActsExamples::SimHitContainer::sequence_type &) const = 0;
 };
 
 namespace {
@@ -178,6 +216,23 @@ struct FatrasSimulationT final : ActsExamples::detail::FatrasSimulation {
                                simulatedParticlesInitial,
                                simulatedParticlesFinal, simHits);
   }
+
+  Acts::Result<std::vector<ActsFatras::FailedParticle>> simulateConcurrently(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx,
+      const ActsExamples::RandomNumbers &randomNumbers,
+      const ActsExamples::AlgorithmContext &ctx,
+      const ActsExamples::SimParticleContainer &inputParticles,
+      ActsExamples::SimParticleContainer::sequence_type
+          &simulatedParticlesInitial,
+      ActsExamples::SimParticleContainer::sequence_type
+          &simulatedParticlesFinal,
+      ActsExamples::SimHitContainer::sequence_type &simHits) const final {
+    return simulation.simulateConcurrently(
+        geoCtx, magCtx, PrimaryGeneratorFactory{randomNumbers, ctx},
+        PrimaryExecutor{}, inputParticles, simulatedParticlesInitial,
+        simulatedParticlesFinal, simHits);
+  }
 };
 
 }  // namespace
@@ -233,11 +288,21 @@ ActsExamples::ProcessCode ActsExamples::FatrasSimulation::execute(
   simHitsUnordered.reserve(inputParticles.size() *
                            m_cfg.averageHitsPerParticle);
 
-  // run the simulation w/ a local random generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-  auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
-                             inputParticles, particlesInitialUnordered,
-                             particlesFinalUnordered, simHitsUnordered);
+  Acts::Result<std::vector<ActsFatras::FailedParticle>> ret =
+      std::vector<ActsFatras::FailedParticle>{};
+  if (m_cfg.simulateConcurrently) {
+    // run the simulation w/ one random generator per primary particle
+    ret = m_sim->simulateConcurrently(
+        ctx.geoContext, ctx.magFieldContext, *m_cfg.randomNumbers, ctx,
+        inputParticles, particlesInitialUnordered, particlesFinalUnordered,
+        simHitsUnordered);
+  } else {
+    // run the simulation w/ a local random generator
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+    ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                          inputParticles, particlesInitialUnordered,
+                          particlesFinalUnordered, simHitsUnordered);
+  }
   // fatal error leads to panic
   if (!ret.ok()) {
     ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
@@ -293,8 +293,7 @@ class HoughTransformSeeder final : public IAlgorithm {
   std::vector<double> m_bins_y;  // size == m_houghHistSize_y + 1
 
   ///////////////////////////////////////////////////////////////////////
-  // Core functions, the second/ one calls the first one per layer
-  HoughHist createLayerHoughHist(unsigned layer, int subregion) const;
+  // Core function, fills the houghHist of all layers in one pass
   HoughHist createHoughHist(int subregion) const;
 
   ///////////////////////////////////////////////////////////////////////
@@ -16,7 +16,9 @@
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/EventData/SimSeed.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <cstddef>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -70,6 +72,9 @@ ActsExamples::GbtsSeedingAlgorithm::GbtsSeedingAlgorithm(
       std::make_unique<Acts::SeedFilter<SimSpacePoint>>(
           Acts::SeedFilter<SimSpacePoint>(m_cfg.seedFilterConfig));
 
+  // run the parallel parts of the graph building on the tbb thread pool
+  m_cfg.seedFinderConfig.executor = tbbWrap::parallelExecutor();
+
   // map
   m_cfg.ActsGbtsMap = makeActsGbtsMap();
   // input trig vector
@@ -27,10 +27,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <ostream>
 #include <stdexcept>
 #include <variant>
+#include <vector>
 
 static inline int quant(double min, double max, unsigned nSteps, double val);
 static inline double unquant(double min, double max, unsigned nSteps, int step);
@@ -66,6 +68,11 @@ ActsExamples::HoughTransformSeeder::HoughTransformSeeder(
         "spacepoints)");
   }
 
+  if (m_cfg.nLayers > 64) {
+    throw std::invalid_argument(
+        "HoughTransformSeeder: At most 64 layers are supported");
+  }
+
   if (m_cfg.outputProtoTracks.empty()) {
     throw std::invalid_argument(
         "HoughTransformSeeder: Missing hough tracks output collection");
@@ -218,56 +225,36 @@ ActsExamples::ProcessCode ActsExamples::HoughTransformSeeder::execute(
   return ActsExamples::ProcessCode::SUCCESS;
 }
 
-ActsExamples::HoughHist
-ActsExamples::HoughTransformSeeder::createLayerHoughHist(unsigned layer,
-                                                         int subregion) const {
+ActsExamples::HoughHist ActsExamples::HoughTransformSeeder::createHoughHist(
+    int subregion) const {
   ActsExamples::HoughHist houghHist(m_cfg.houghHistSize_y,
                                     m_cfg.houghHistSize_x);
+  // the layers with hits in each bin, so each layer is only counted once
+  std::vector<std::uint64_t> layerMasks(
+      m_cfg.houghHistSize_y * m_cfg.houghHistSize_x, 0u);
 
   for (unsigned index = 0; index < houghMeasurementStructs.size(); index++) {
     HoughMeasurementStruct* meas = houghMeasurementStructs[index].get();
-    if (meas->layer != layer) {
+    if (meas->layer >= m_cfg.nLayers) {
       continue;
     }
     if (!(m_cfg.sliceTester(meas->z, meas->layer, subregion)).value()) {
       continue;
     }
+    const std::uint64_t layerBit = std::uint64_t{1} << meas->layer;
 
     // This scans over y (pT) because that is more efficient in memory
-    for (unsigned y_ = 0; y_ < m_cfg.houghHistSize_y; y_++) {
-      unsigned y_bin_min = y_;
-      unsigned y_bin_max = (y_ + 1);
-
+    for (unsigned y = 0; y < m_cfg.houghHistSize_y; y++) {
       // Find the min/max x bins
-      auto xBins =
-          yToXBins(y_bin_min, y_bin_max, meas->radius, meas->phi, meas->layer);
+      auto xBins = yToXBins(y, y + 1, meas->radius, meas->phi, meas->layer);
       // Update the houghHist
-      for (unsigned y = y_bin_min; y < y_bin_max; y++) {
-        for (unsigned x = xBins.first; x < xBins.second; x++) {
-          houghHist(y, x).first++;
-          houghHist(y, x).second.insert(index);
-        }
-      }
-    }
-  }
-
-  return houghHist;
-}
-
-ActsExamples::HoughHist ActsExamples::HoughTransformSeeder::createHoughHist(
-    int subregion) const {
-  ActsExamples::HoughHist houghHist(m_cfg.houghHistSize_y,
-                                    m_cfg.houghHistSize_x);
-
-  for (unsigned i = 0; i < m_cfg.nLayers; i++) {
-    HoughHist layerHoughHist = createLayerHoughHist(i, subregion);
-    for (unsigned x = 0; x < m_cfg.houghHistSize_x; ++x) {
-      for (unsigned y = 0; y < m_cfg.houghHistSize_y; ++y) {
-        if (layerHoughHist(y, x).first > 0) {
+      std::uint64_t* rowMasks = layerMasks.data() + y * m_cfg.houghHistSize_x;
+      for (unsigned x = xBins.first; x < xBins.second; x++) {
+        if ((rowMasks[x] & layerBit) == 0u) {
+          rowMasks[x] |= layerBit;
           houghHist(y, x).first++;
-          houghHist(y, x).second.insert(layerHoughHist(y, x).second.begin(),
-                                        layerHoughHist(y, x).second.end());
         }
+        houghHist(y, x).second.insert(index);
       }
     }
   }
@@ -525,20 +512,11 @@ void ActsExamples::HoughTransformSeeder::addMeasurements(
         // are transformed to the bound space where we do know their location.
         // if the local parameters are not measured, this results in a
         // zero location, which is a reasonable default fall-back.
-        auto [localPos, localCov] = std::visit(
-            [](const auto& meas) {
-              auto expander = meas.expander();
-              Acts::BoundVector par = expander * meas.parameters();
-              Acts::BoundSquareMatrix cov =
-                  expander * meas.covariance() * expander.transpose();
-              // extract local position
-              Acts::Vector2 lpar(par[Acts::eBoundLoc0], par[Acts::eBoundLoc1]);
-              // extract local position covariance.
-              Acts::SquareMatrix2 lcov =
-                  cov.block<2, 2>(Acts::eBoundLoc0, Acts::eBoundLoc0);
-              return std::make_pair(lpar, lcov);
-            },
-            measurements[sourceLink.index()]);
+        const auto measurement =
+            measurements.getMeasurement(sourceLink.index());
+        Acts::BoundVector par = measurement.fullParameters();
+        // extract local position
+        Acts::Vector2 localPos(par[Acts::eBoundLoc0], par[Acts::eBoundLoc1]);
 
         // transform local position to global coordinates
         Acts::Vector3 globalFakeMom(1, 1, 1);
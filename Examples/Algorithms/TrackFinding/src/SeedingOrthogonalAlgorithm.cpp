@@ -11,8 +11,10 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Seeding/SeedFilter.hpp"
 #include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <ostream>
 #include <stdexcept>
@@ -69,6 +71,9 @@ ActsExamples::SeedingOrthogonalAlgorithm::SeedingOrthogonalAlgorithm(
       std::make_unique<Acts::SeedFilter<SimSpacePoint>>(
           Acts::SeedFilter<SimSpacePoint>(m_cfg.seedFilterConfig));
 
+  // build the tree and search the candidates on the tbb thread pool
+  m_cfg.seedFinderConfig.executor = tbbWrap::parallelExecutor();
+
   m_finder = Acts::SeedFinderOrthogonal<SimSpacePoint>(m_cfg.seedFinderConfig);
 }
 
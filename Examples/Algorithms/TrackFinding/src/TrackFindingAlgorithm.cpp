@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Direction.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/ProxyAccessor.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
@@ -30,6 +31,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -40,6 +42,29 @@
 
 #include <boost/histogram.hpp>
 
+namespace {
+
+/// Pre-selects the source links of a surface with the uncalibrated
+/// measurements, before the CKF creates track states for them
+struct MeasurementPreSelector {
+  const Acts::MeasurementSelector* selector = nullptr;
+  const ActsExamples::MeasurementContainer* measurements = nullptr;
+
+  bool operator()(const Acts::BoundTrackParameters& predicted,
+                  const Acts::SourceLink& sourceLink) const {
+    const auto index =
+        sourceLink.get<ActsExamples::IndexSourceLink>().index();
+    const auto measurement = measurements->getMeasurement(index);
+    return Acts::visit_measurement(measurement.size(), [&](auto dim) {
+      constexpr std::size_t kSize = decltype(dim)::value;
+      return selector->isCompatible(predicted,
+                                    measurement.template fixedSize<kSize>());
+    });
+  }
+};
+
+}  // namespace
+
 ActsExamples::TrackFindingAlgorithm::TrackFindingAlgorithm(
     Config config, Acts::Logging::Level level)
     : ActsExamples::IAlgorithm("TrackFindingAlgorithm", level),
@@ -107,6 +132,11 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
   extensions.measurementSelector
       .connect<&Acts::MeasurementSelector::select<Acts::VectorMultiTrajectory>>(
           &measSel);
+  // the pass through calibrator does not change the measurements, so they
+  // can already be used to skip incompatible source links
+  MeasurementPreSelector preSelector{&measSel, &measurements};
+  extensions.sourceLinkPreSelector.connect<&MeasurementPreSelector::operator()>(
+      &preSelector);
 
   IndexSourceLinkAccessor slAccessor;
   slAccessor.container = &sourceLinks;
@@ -125,12 +155,17 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
   ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
                                           << " seeds.");
 
+  // The track states only store handles to the measurement source links,
+  // which also makes copying the found tracks cheap
+  auto sourceLinkTable = makeSourceLinkTable(measurements);
+
   auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  auto trackStateContainer =
+      std::make_shared<Acts::VectorMultiTrajectory>(sourceLinkTable);
 
   auto trackContainerTemp = std::make_shared<Acts::VectorTrackContainer>();
   auto trackStateContainerTemp =
-      std::make_shared<Acts::VectorMultiTrajectory>();
+      std::make_shared<Acts::VectorMultiTrajectory>(sourceLinkTable);
 
   TrackContainer tracks(trackContainer, trackStateContainer);
   TrackContainer tracksTemp(trackContainerTemp, trackStateContainerTemp);
@@ -10,8 +10,9 @@
 
 #include "Acts/EventData/TrackContainer.hpp"
 #include "Acts/TrackFinding/detail/AmbiguityTrackClustering.hpp"
-#include "Acts/Utilities/DBScan.hpp"
+#include "Acts/Utilities/GridDBScan.hpp"
 
+#include <iostream>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -39,10 +40,6 @@ std::unordered_map<std::size_t, std::vector<std::size_t>> dbscanTrackClustering(
   // different clusters.
   std::unordered_map<std::size_t, std::size_t> hitToTrack;
 
-  // Initialize a DBScan of dimension 4 (phi, eta, z, Pt)
-  using DBSCAN = Acts::DBScan<4, double, 4>;
-  DBSCAN dbscan(epsilon, minPoints, true);
-
   std::vector<std::array<double, 4>> data;
   std::size_t trackID = 0;
   std::vector<int> clusterAssignments;
@@ -53,7 +50,9 @@ std::unordered_map<std::size_t, std::vector<std::size_t>> dbscanTrackClustering(
     data.push_back({Acts::VectorHelpers::eta(traj.momentum()),
                     Acts::VectorHelpers::phi(traj.momentum())});
   }
-  std::size_t clusterNb = dbscan.cluster(data, clusterAssignments);
+  // Cluster with a DBScan of dimension 4 (phi, eta, z, Pt)
+  std::size_t clusterNb = Acts::clusterWithDBScan<4, double>(
+      data, clusterAssignments, epsilon, minPoints, true);
 
   // Cluster track with DBScan
   std::vector<
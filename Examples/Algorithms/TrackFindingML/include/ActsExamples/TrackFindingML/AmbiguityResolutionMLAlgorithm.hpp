@@ -34,6 +34,12 @@ class AmbiguityResolutionMLAlgorithm final : public AmbiguityResolutionML {
     std::string outputTracks;
     /// Minimum number of measurement to form a track.
     int nMeasurementsMin = 7;
+    /// Number of threads used within one network node, 0 for the default
+    int inferenceIntraOpThreads = 0;
+    /// Number of threads used across network nodes, 0 for the default
+    int inferenceInterOpThreads = 0;
+    /// Merge the network inputs of concurrent events into one inference
+    bool coalesceInference = false;
   };
 
   /// Construct the ambiguity resolution algorithm.
@@ -48,6 +54,9 @@ class AmbiguityResolutionMLAlgorithm final : public AmbiguityResolutionML {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final;
 
+  /// Report the network inference metrics.
+  ProcessCode finalize() final;
+
   /// Const access to the config
   const Config& config() const { return m_cfg; }
 
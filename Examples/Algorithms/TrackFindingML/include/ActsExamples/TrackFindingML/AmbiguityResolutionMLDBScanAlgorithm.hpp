@@ -40,6 +40,12 @@ class AmbiguityResolutionMLDBScanAlgorithm final
     float epsilonDBScan = 0.07;
     /// Minimum number of tracks to create a cluster in the DBScan
     int minPointsDBScan = 2;
+    /// Number of threads used within one network node, 0 for the default
+    int inferenceIntraOpThreads = 0;
+    /// Number of threads used across network nodes, 0 for the default
+    int inferenceInterOpThreads = 0;
+    /// Merge the network inputs of concurrent events into one inference
+    bool coalesceInference = false;
   };
 
   /// Construct the ambiguity resolution algorithm.
@@ -54,6 +60,9 @@ class AmbiguityResolutionMLDBScanAlgorithm final
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final;
 
+  /// Report the network inference metrics.
+  ProcessCode finalize() final;
+
   /// Const access to the config
   const Config& config() const { return m_cfg; }
 
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include "Acts/Utilities/DBScan.hpp"
+#include "Acts/Utilities/GridDBScan.hpp"
 
 #include <map>
 #include <unordered_map>
@@ -26,13 +26,10 @@ namespace Acts {
 std::vector<std::vector<std::size_t>> dbscanSeedClustering(
     const std::vector<std::array<double, 4>>& input, float epsilon = 0.03,
     int minPoints = 2) {
-  // Initialize a DBScan of dimension 4 (phi, eta, z, Pt)
-  using DBSCAN = Acts::DBScan<4, double, 4>;
-  DBSCAN dbscan(epsilon, minPoints, true);
-
-  // Cluster track with DBScan
+  // Cluster track with a DBScan of dimension 4 (phi, eta, z, Pt)
   std::vector<int> clusterAssignments;
-  std::size_t clusterNb = dbscan.cluster(input, clusterAssignments);
+  std::size_t clusterNb = Acts::clusterWithDBScan<4, double>(
+      input, clusterAssignments, epsilon, minPoints, true);
 
   // Prepare the output
   std::vector<std::vector<std::size_t>> cluster(clusterNb,
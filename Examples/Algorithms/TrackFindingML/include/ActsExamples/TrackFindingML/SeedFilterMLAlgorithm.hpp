@@ -51,6 +51,12 @@ class SeedFilterMLAlgorithm : public IAlgorithm {
     double clusteringWeighZ = 50.0;
     /// Clustering parameters weight for pT used before the DBSCAN
     double clusteringWeighPt = 1.0;
+    /// Number of threads used within one network node, 0 for the default
+    int inferenceIntraOpThreads = 0;
+    /// Number of threads used across network nodes, 0 for the default
+    int inferenceInterOpThreads = 0;
+    /// Merge the network inputs of concurrent events into one inference
+    bool coalesceInference = false;
   };
 
   /// Construct the seed filter algorithm.
@@ -65,6 +71,9 @@ class SeedFilterMLAlgorithm : public IAlgorithm {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final;
 
+  /// Report the network inference metrics.
+  ProcessCode finalize() final;
+
   /// Const access to the config
   const Config& config() const { return m_cfg; }
 
@@ -19,7 +19,14 @@ ActsExamples::AmbiguityResolutionMLAlgorithm::AmbiguityResolutionMLAlgorithm(
     : ActsExamples::AmbiguityResolutionML("AmbiguityResolutionMLAlgorithm",
                                           lvl),
       m_cfg(std::move(cfg)),
-      m_duplicateClassifier(m_cfg.inputDuplicateNN.c_str()) {
+      m_duplicateClassifier([this] {
+        Acts::OnnxInferenceExecutor::Config inference;
+        inference.modelPath = m_cfg.inputDuplicateNN;
+        inference.intraOpNumThreads = m_cfg.inferenceIntraOpThreads;
+        inference.interOpNumThreads = m_cfg.inferenceInterOpThreads;
+        inference.coalesceBatches = m_cfg.coalesceInference;
+        return inference;
+      }()) {
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("Missing trajectories input collection");
   }
@@ -47,3 +54,10 @@ ActsExamples::ProcessCode ActsExamples::AmbiguityResolutionMLAlgorithm::execute(
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
+
+ActsExamples::ProcessCode
+ActsExamples::AmbiguityResolutionMLAlgorithm::finalize() {
+  ACTS_INFO("Network inference: "
+            << m_duplicateClassifier.executor().metrics());
+  return ActsExamples::ProcessCode::SUCCESS;
+}
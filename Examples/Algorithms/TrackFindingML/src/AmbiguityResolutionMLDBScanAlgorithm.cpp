@@ -22,7 +22,14 @@ ActsExamples::AmbiguityResolutionMLDBScanAlgorithm::
     : ActsExamples::AmbiguityResolutionML(
           "AmbiguityResolutionMLDBScanAlgorithm", lvl),
       m_cfg(std::move(cfg)),
-      m_duplicateClassifier(m_cfg.inputDuplicateNN.c_str()) {
+      m_duplicateClassifier([this] {
+        Acts::OnnxInferenceExecutor::Config inference;
+        inference.modelPath = m_cfg.inputDuplicateNN;
+        inference.intraOpNumThreads = m_cfg.inferenceIntraOpThreads;
+        inference.interOpNumThreads = m_cfg.inferenceInterOpThreads;
+        inference.coalesceBatches = m_cfg.coalesceInference;
+        return inference;
+      }()) {
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("Missing trajectories input collection");
   }
@@ -53,3 +60,10 @@ ActsExamples::AmbiguityResolutionMLDBScanAlgorithm::execute(
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
+
+ActsExamples::ProcessCode
+ActsExamples::AmbiguityResolutionMLDBScanAlgorithm::finalize() {
+  ACTS_INFO("Network inference: "
+            << m_duplicateClassifier.executor().metrics());
+  return ActsExamples::ProcessCode::SUCCESS;
+}
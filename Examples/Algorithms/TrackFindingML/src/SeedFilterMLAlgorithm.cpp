@@ -19,7 +19,14 @@ ActsExamples::SeedFilterMLAlgorithm::SeedFilterMLAlgorithm(
     ActsExamples::SeedFilterMLAlgorithm::Config cfg, Acts::Logging::Level lvl)
     : ActsExamples::IAlgorithm("SeedFilterMLAlgorithm", lvl),
       m_cfg(std::move(cfg)),
-      m_seedClassifier(m_cfg.inputSeedFilterNN.c_str()) {
+      m_seedClassifier([this] {
+        Acts::OnnxInferenceExecutor::Config inference;
+        inference.modelPath = m_cfg.inputSeedFilterNN;
+        inference.intraOpNumThreads = m_cfg.inferenceIntraOpThreads;
+        inference.interOpNumThreads = m_cfg.inferenceInterOpThreads;
+        inference.coalesceBatches = m_cfg.coalesceInference;
+        return inference;
+      }()) {
   if (m_cfg.inputTrackParameters.empty()) {
     throw std::invalid_argument("Missing track parameters input collection");
   }
@@ -100,3 +107,10 @@ ActsExamples::ProcessCode ActsExamples::SeedFilterMLAlgorithm::execute(
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
+
+ActsExamples::ProcessCode
+ActsExamples::SeedFilterMLAlgorithm::finalize() {
+  ACTS_INFO("Network inference: "
+            << m_seedClassifier.executor().metrics());
+  return ActsExamples::ProcessCode::SUCCESS;
+}
@@ -15,8 +15,12 @@
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
+#include <atomic>
+#include <cstddef>
 #include <iostream>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace ActsExamples {
@@ -52,6 +56,104 @@ class AlignmentDecorator : public IContextDecorator {
     bool firstIovNominal = false;
   };
 
+  /// @brief Registry of the alignment payloads of the active IOVs
+  ///
+  /// The registry is an immutable snapshot that is replaced by an atomic
+  /// shared pointer swap whenever an IOV is added or removed. Looking up an
+  /// existing IOV, which is by far the most frequent operation, therefore
+  /// does not require a lock. Modifications need to be synchronized by the
+  /// caller. Payloads are shared with the events that looked them up, they
+  /// must therefore not be modified once registered but be replaced.
+  ///
+  /// @tparam payload_t the alignment payload of a single IOV
+  template <typename payload_t>
+  class IovRegistry {
+   public:
+    /// Find the payload of the given IOV and mark it as accessed
+    ///
+    /// @param iov the interval of validity
+    /// @param eventsSeen the current event count
+    ///
+    /// @return the payload or nullptr if the IOV is not registered
+    std::shared_ptr<payload_t> find(unsigned int iov,
+                                    std::size_t eventsSeen) const {
+      auto table = std::atomic_load(&m_table);
+      if (auto it = table->find(iov); it != table->end()) {
+        it->second.lastAccessed->store(eventsSeen, std::memory_order_relaxed);
+        return it->second.payload;
+      }
+      return nullptr;
+    }
+
+    /// Register the payload for a new IOV
+    ///
+    /// @note not thread-safe with respect to other modifications
+    void insert(unsigned int iov, std::shared_ptr<payload_t> payload,
+                std::size_t eventsSeen) {
+      auto table = std::make_shared<Table>(*std::atomic_load(&m_table));
+      (*table)[iov] = Entry{
+          std::move(payload),
+          std::make_shared<std::atomic<std::size_t>>(eventsSeen)};
+      std::atomic_store(&m_table, std::shared_ptr<const Table>(table));
+    }
+
+    /// Replace the payload of a registered IOV, events that already hold the
+    /// previous payload keep it
+    ///
+    /// @note not thread-safe with respect to other modifications
+    ///
+    /// @return false if the IOV is not registered, e.g. already removed
+    bool update(unsigned int iov, std::shared_ptr<payload_t> payload) {
+      auto current = std::atomic_load(&m_table);
+      auto it = current->find(iov);
+      if (it == current->end()) {
+        return false;
+      }
+      auto table = std::make_shared<Table>(*current);
+      (*table)[iov].payload = std::move(payload);
+      std::atomic_store(&m_table, std::shared_ptr<const Table>(table));
+      return true;
+    }
+
+    /// Remove all IOVs that have not been accessed for more than
+    /// @p flushSize events
+    ///
+    /// @note not thread-safe with respect to other modifications
+    ///
+    /// @return the removed IOVs
+    std::vector<unsigned int> collectGarbage(std::size_t eventsSeen,
+                                             std::size_t flushSize) {
+      auto current = std::atomic_load(&m_table);
+      std::vector<unsigned int> removed;
+      for (const auto& [iov, entry] : *current) {
+        const std::size_t lastAccessed =
+            entry.lastAccessed->load(std::memory_order_relaxed);
+        if (eventsSeen > lastAccessed &&
+            eventsSeen - lastAccessed > flushSize) {
+          removed.push_back(iov);
+        }
+      }
+      if (!removed.empty()) {
+        auto table = std::make_shared<Table>(*current);
+        for (auto iov : removed) {
+          table->erase(iov);
+        }
+        std::atomic_store(&m_table, std::shared_ptr<const Table>(table));
+      }
+      return removed;
+    }
+
+   private:
+    struct Entry {
+      std::shared_ptr<payload_t> payload;
+      // Shared between the snapshots, so that updates survive the swap
+      std::shared_ptr<std::atomic<std::size_t>> lastAccessed;
+    };
+    using Table = std::unordered_map<unsigned int, Entry>;
+
+    std::shared_ptr<const Table> m_table = std::make_shared<const Table>();
+  };
+
  protected:
   static void applyTransform(Acts::Transform3& trf, const Config& cfg,
                              RandomEngine& rng, unsigned int iov) {
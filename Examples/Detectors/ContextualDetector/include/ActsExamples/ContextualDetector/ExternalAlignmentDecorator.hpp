@@ -17,11 +17,11 @@
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace Acts {
@@ -78,14 +78,13 @@ class ExternalAlignmentDecorator : public AlignmentDecorator {
   /// Map of nominal transforms
   std::vector<Acts::Transform3> m_nominalStore;
 
-  std::unordered_map<
-      unsigned int,
-      std::shared_ptr<ExternallyAlignedDetectorElement::AlignmentStore>>
-      m_activeIovs;
+  /// The alignment stores of the active IOVs
+  IovRegistry<ExternallyAlignedDetectorElement::AlignmentStore> m_activeIovs;
 
+  /// Protect multiple alignments to be loaded at once
   std::mutex m_iovMutex;
 
-  std::size_t m_eventsSeen{0};
+  std::atomic<std::size_t> m_eventsSeen{0};
 
   /// Private access to the logging instance
   const Acts::Logger& logger() const { return *m_logger; }
@@ -17,11 +17,11 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace ActsExamples {
@@ -78,11 +78,12 @@ class InternalAlignmentDecorator : public AlignmentDecorator {
 
   ///< Protect multiple alignments to be loaded at once
   std::mutex m_alignmentMutex;
-  struct IovStatus {
-    std::size_t lastAccessed;
-  };
-  std::unordered_map<unsigned int, IovStatus> m_activeIovs;
-  std::size_t m_eventsSeen{0};
+  /// The aligned transforms of the active IOVs
+  IovRegistry<const InternallyAlignedDetectorElement::AlignedTransforms>
+      m_activeIovs;
+  std::atomic<std::size_t> m_eventsSeen{0};
+  /// Size of the dense transform store, i.e. the largest identifier + 1
+  std::size_t m_nTransforms = 0;
 
   /// Private access to the logging instance
   const Acts::Logger& logger() const { return *m_logger; }
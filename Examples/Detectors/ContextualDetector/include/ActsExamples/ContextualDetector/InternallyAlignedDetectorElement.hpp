@@ -16,10 +16,13 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "ActsExamples/GenericDetector/GenericDetectorElement.hpp"
 
+#include <cassert>
+#include <functional>
 #include <iostream>
 #include <memory>
-#include <mutex>
-#include <unordered_map>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -33,17 +36,36 @@ namespace Contextual {
 /// The AlignedDetectorElement demonstrates how a GeometryContext
 /// can be used if it carries an interval of validity concept
 ///
-/// The nominal transform is only used to once create the alignment
-/// store and then in a contextual call the actual detector element
-/// position is taken internal multi component store - the latter
-/// has to be filled though from an external source
+/// The nominal transform is only used to once create the aligned
+/// transforms of an interval of validity, which are then carried by the
+/// geometry context and shared by all detector elements.
 class InternallyAlignedDetectorElement
     : public Generic::GenericDetectorElement {
  public:
+  /// Aligned transforms of all detector elements for a single IOV, indexed
+  /// by the detector element identifier, together with their inverse
+  struct AlignedTransforms {
+    std::vector<Acts::Transform3> transforms;
+    std::vector<Acts::Transform3> inverseTransforms;
+  };
+
+  /// Publishes updated aligned transforms of an interval of validity
+  using Publisher = std::function<void(
+      unsigned int, std::shared_ptr<const AlignedTransforms>)>;
+
   struct ContextType {
     /// The current interval of validity
     unsigned int iov = 0;
     bool nominal = false;
+    /// The aligned transforms of the current interval of validity, shared
+    /// with other events and hence never modified but replaced
+    mutable std::shared_ptr<const AlignedTransforms> alignedTransforms =
+        nullptr;
+    /// Private copy of the aligned transforms collecting the updates of this
+    /// context until they are committed
+    mutable std::shared_ptr<AlignedTransforms> pendingTransforms = nullptr;
+    /// Makes committed aligned transforms available to later events
+    Publisher publish;
   };
 
   // Inherit constructor
@@ -57,24 +79,42 @@ class InternallyAlignedDetectorElement
   const Acts::Transform3& transform(
       const Acts::GeometryContext& gctx) const override;
 
+  /// Return the inverse transform, precomputed per interval of validity
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  Acts::Transform3 inverseTransform(
+      const Acts::GeometryContext& gctx) const override;
+
   /// Return the nominal local to global transform
   ///
   /// @note the geometry context will hereby be ignored
   const Acts::Transform3& nominalTransform(
       const Acts::GeometryContext& gctx) const;
 
-  /// Return local to global transform associated with this identifier
+  /// Replace the aligned transform of this detector element in the
+  /// interval of validity of the given context, e.g. during the alignment
   ///
-  /// @param alignedTransform is a new transform
-  /// @param iov is the batch for which it is meant
-  void addAlignedTransform(const Acts::Transform3& alignedTransform,
-                           unsigned int iov);
-
-  void clearAlignedTransform(unsigned int iov);
-
- private:
-  std::unordered_map<unsigned int, Acts::Transform3> m_alignedTransforms;
-  mutable std::mutex m_alignmentMutex;
+  /// @param gctx The geometry context carrying the aligned transforms
+  /// @param alignedTransform is the new transform
+  ///
+  /// @note The first update after a commit copies the aligned transforms of
+  ///       this context once, the following updates are collected in the
+  ///       same copy. This context sees the updates immediately, the later
+  ///       events of the interval of validity only after the commit.
+  ///       References to transforms obtained from this context before the
+  ///       first update are invalidated.
+  void addAlignedTransform(const Acts::GeometryContext& gctx,
+                           const Acts::Transform3& alignedTransform);
+
+  /// Publish the aligned transforms updated in the given context since the
+  /// last commit, e.g. once per alignment iteration
+  ///
+  /// @param gctx The geometry context carrying the aligned transforms
+  ///
+  /// @note The committed transforms replace the ones of the later events of
+  ///       the interval of validity, events already in flight are not
+  ///       affected.
+  static void commitAlignedTransforms(const Acts::GeometryContext& gctx);
 };
 
 inline const Acts::Transform3& InternallyAlignedDetectorElement::transform(
@@ -85,19 +125,32 @@ inline const Acts::Transform3& InternallyAlignedDetectorElement::transform(
   }
   const auto& alignContext = gctx.get<ContextType&>();
 
-  std::lock_guard lock{m_alignmentMutex};
   if (alignContext.nominal) {
     // nominal alignment
     return nominalTransform(gctx);
   }
-  auto aTransform = m_alignedTransforms.find(alignContext.iov);
-  if (aTransform == m_alignedTransforms.end()) {
-    throw std::runtime_error{
-        "Aligned transform for IOV " + std::to_string(alignContext.iov) +
-        " not found. This can happen if the garbage collection runs too "
-        "early (--align-flushsize too low)"};
+  if (alignContext.alignedTransforms == nullptr) {
+    throw std::runtime_error{"No aligned transforms for IOV " +
+                             std::to_string(alignContext.iov) +
+                             " in the geometry context"};
+  }
+  identifier_type idValue = identifier_type(identifier());
+  assert(idValue < alignContext.alignedTransforms->transforms.size());
+  return alignContext.alignedTransforms->transforms[idValue];
+}
+
+inline Acts::Transform3 InternallyAlignedDetectorElement::inverseTransform(
+    const Acts::GeometryContext& gctx) const {
+  if (!gctx.hasValue() || gctx.get<ContextType&>().nominal) {
+    return GenericDetectorElement::inverseTransform(gctx);
+  }
+  const auto& alignContext = gctx.get<ContextType&>();
+  if (alignContext.alignedTransforms == nullptr) {
+    return transform(gctx).inverse();
   }
-  return aTransform->second;
+  identifier_type idValue = identifier_type(identifier());
+  assert(idValue < alignContext.alignedTransforms->inverseTransforms.size());
+  return alignContext.alignedTransforms->inverseTransforms[idValue];
 }
 
 inline const Acts::Transform3&
@@ -107,17 +160,38 @@ InternallyAlignedDetectorElement::nominalTransform(
 }
 
 inline void InternallyAlignedDetectorElement::addAlignedTransform(
-    const Acts::Transform3& alignedTransform, unsigned int iov) {
-  std::lock_guard lock{m_alignmentMutex};
-  m_alignedTransforms[iov] = alignedTransform;
+    const Acts::GeometryContext& gctx,
+    const Acts::Transform3& alignedTransform) {
+  const auto& alignContext = gctx.get<ContextType&>();
+  if (alignContext.alignedTransforms == nullptr) {
+    throw std::runtime_error{"No aligned transforms for IOV " +
+                             std::to_string(alignContext.iov) +
+                             " in the geometry context"};
+  }
+  identifier_type idValue = identifier_type(identifier());
+  assert(idValue < alignContext.alignedTransforms->transforms.size());
+  if (alignContext.pendingTransforms == nullptr) {
+    alignContext.pendingTransforms =
+        std::make_shared<AlignedTransforms>(*alignContext.alignedTransforms);
+    alignContext.alignedTransforms = alignContext.pendingTransforms;
+  }
+  alignContext.pendingTransforms->transforms[idValue] = alignedTransform;
+  alignContext.pendingTransforms->inverseTransforms[idValue] =
+      alignedTransform.inverse();
 }
 
-inline void InternallyAlignedDetectorElement::clearAlignedTransform(
-    unsigned int iov) {
-  std::lock_guard lock{m_alignmentMutex};
-  if (auto it = m_alignedTransforms.find(iov);
-      it != m_alignedTransforms.end()) {
-    m_alignedTransforms.erase(it);
+inline void InternallyAlignedDetectorElement::commitAlignedTransforms(
+    const Acts::GeometryContext& gctx) {
+  const auto& alignContext = gctx.get<ContextType&>();
+  if (alignContext.pendingTransforms == nullptr) {
+    return;
+  }
+  // The committed copy is shared from now on, the next update copies again
+  std::shared_ptr<const AlignedTransforms> committed =
+      std::move(alignContext.pendingTransforms);
+  alignContext.pendingTransforms = nullptr;
+  if (alignContext.publish) {
+    alignContext.publish(alignContext.iov, std::move(committed));
   }
 }
 
@@ -33,66 +33,68 @@ ActsExamples::Contextual::ExternalAlignmentDecorator::
 ActsExamples::ProcessCode
 ActsExamples::Contextual::ExternalAlignmentDecorator::decorate(
     AlgorithmContext& context) {
-  // Iov map access needs to be synchronized
-  std::lock_guard lock{m_iovMutex};
-
   // In which iov batch are we?
   unsigned int iov = context.eventNumber / m_cfg.iovSize;
   ACTS_VERBOSE("IOV handling in thread " << std::this_thread::get_id() << ".");
   ACTS_VERBOSE("IOV resolved to " << iov << " - from event "
                                   << context.eventNumber << ".");
 
-  m_eventsSeen++;
-
-  if (m_cfg.randomNumberSvc != nullptr) {
-    if (auto it = m_activeIovs.find(iov); it != m_activeIovs.end()) {
-      // Iov is already present, update last accessed
-      it->second->lastAccessed = m_eventsSeen;
-      context.geoContext =
-          ExternallyAlignedDetectorElement::ContextType{it->second};
-    } else {
-      // Iov is not present yet, create it
-      auto alignmentStore =
-          std::make_unique<ExternallyAlignedDetectorElement::AlignmentStore>();
-      alignmentStore->lastAccessed = m_eventsSeen;
-
-      ACTS_VERBOSE("New IOV " << iov << " detected at event "
-                              << context.eventNumber
-                              << ", emulate new alignment.");
-
-      // Create an algorithm local random number generator
-      RandomEngine rng = m_cfg.randomNumberSvc->spawnGenerator(context);
-
-      alignmentStore->transforms = m_nominalStore;  // copy nominal alignment
-      for (auto& tForm : alignmentStore->transforms) {
-        // Multiply alignment in place
-        applyTransform(tForm, m_cfg, rng, iov);
-      }
+  const std::size_t eventsSeen = ++m_eventsSeen;
 
-      auto [insertIterator, inserted] =
-          m_activeIovs.emplace(iov, std::move(alignmentStore));
-      assert(inserted && "Expected IOV to be created in map, but wasn't");
+  if (m_cfg.randomNumberSvc == nullptr) {
+    return ProcessCode::SUCCESS;
+  }
 
-      // make context from iov pointer, address should be stable
-      context.geoContext =
-          ExternallyAlignedDetectorElement::ContextType{insertIterator->second};
-    }
+  // Fast path: the IOV is already present
+  if (auto alignmentStore = m_activeIovs.find(iov, eventsSeen);
+      alignmentStore != nullptr) {
+    context.geoContext =
+        ExternallyAlignedDetectorElement::ContextType{alignmentStore};
+    return ProcessCode::SUCCESS;
   }
 
-  // Garbage collection
-  if (m_cfg.doGarbageCollection) {
-    for (auto it = m_activeIovs.begin(); it != m_activeIovs.end();) {
-      auto& status = it->second;
-      if (m_eventsSeen - status->lastAccessed > m_cfg.flushSize) {
-        ACTS_DEBUG("IOV " << iov << " has not been accessed in the last "
+  // Iov creation needs to be synchronized
+  std::lock_guard lock{m_iovMutex};
+
+  // Another thread might have created it in the meantime
+  auto alignmentStore = m_activeIovs.find(iov, eventsSeen);
+  if (alignmentStore == nullptr) {
+    // Iov is not present yet, create it
+    auto newStore =
+        std::make_shared<ExternallyAlignedDetectorElement::AlignmentStore>();
+
+    ACTS_VERBOSE("New IOV " << iov << " detected at event "
+                            << context.eventNumber
+                            << ", emulate new alignment.");
+
+    // Create an algorithm local random number generator
+    RandomEngine rng = m_cfg.randomNumberSvc->spawnGenerator(context);
+
+    newStore->transforms = m_nominalStore;  // copy nominal alignment
+    newStore->inverseTransforms.reserve(newStore->transforms.size());
+    for (auto& tForm : newStore->transforms) {
+      // Multiply alignment in place
+      applyTransform(tForm, m_cfg, rng, iov);
+      // The inverse is computed once per IOV
+      newStore->inverseTransforms.push_back(tForm.inverse());
+    }
+
+    m_activeIovs.insert(iov, newStore, eventsSeen);
+    alignmentStore = std::move(newStore);
+
+    // Garbage collection, only needed when the store grows
+    if (m_cfg.doGarbageCollection) {
+      for (auto this_iov :
+           m_activeIovs.collectGarbage(eventsSeen, m_cfg.flushSize)) {
+        ACTS_DEBUG("IOV " << this_iov << " has not been accessed in the last "
                           << m_cfg.flushSize << " events, clearing");
-        it = m_activeIovs.erase(it);
-      } else {
-        it++;
       }
     }
   }
 
+  context.geoContext =
+      ExternallyAlignedDetectorElement::ContextType{alignmentStore};
+
   return ProcessCode::SUCCESS;
 }
 
@@ -14,6 +14,7 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
+#include <algorithm>
 #include <ostream>
 #include <thread>
 #include <utility>
@@ -21,14 +22,18 @@
 ActsExamples::Contextual::InternalAlignmentDecorator::
     InternalAlignmentDecorator(const Config& cfg,
                                std::unique_ptr<const Acts::Logger> logger)
-    : m_cfg(cfg), m_logger(std::move(logger)) {}
+    : m_cfg(cfg), m_logger(std::move(logger)) {
+  for (auto& lstore : m_cfg.detectorStore) {
+    for (auto& ldet : lstore) {
+      m_nTransforms = std::max<std::size_t>(
+          m_nTransforms, identifier_type(ldet->identifier()) + 1);
+    }
+  }
+}
 
 ActsExamples::ProcessCode
 ActsExamples::Contextual::InternalAlignmentDecorator::decorate(
     AlgorithmContext& context) {
-  // We need to lock the Decorator
-  std::lock_guard<std::mutex> alignmentLock(m_alignmentMutex);
-
   // In which iov batch are we?
   unsigned int iov = context.eventNumber / m_cfg.iovSize;
 
@@ -36,59 +41,79 @@ ActsExamples::Contextual::InternalAlignmentDecorator::decorate(
   ACTS_VERBOSE("IOV resolved to " << iov << " - from event "
                                   << context.eventNumber << ".");
 
-  m_eventsSeen++;
+  const std::size_t eventsSeen = ++m_eventsSeen;
 
-  context.geoContext = InternallyAlignedDetectorElement::ContextType{iov};
+  InternallyAlignedDetectorElement::ContextType alignContext;
+  alignContext.iov = iov;
 
   if (m_cfg.randomNumberSvc != nullptr) {
-    if (auto it = m_activeIovs.find(iov); it != m_activeIovs.end()) {
-      // Iov is already present, update last accessed
-      it->second.lastAccessed = m_eventsSeen;
-    } else {
-      // Iov is not present yet, create it
-
-      m_activeIovs.emplace(iov, IovStatus{m_eventsSeen});
-
-      ACTS_VERBOSE("New IOV " << iov << " detected at event "
-                              << context.eventNumber
-                              << ", emulate new alignment.");
-
-      // Create an algorithm local random number generator
-      RandomEngine rng = m_cfg.randomNumberSvc->spawnGenerator(context);
-
-      for (auto& lstore : m_cfg.detectorStore) {
-        for (auto& ldet : lstore) {
-          // get the nominal transform
-          Acts::Transform3 tForm =
-              ldet->nominalTransform(context.geoContext);  // copy
-          // create a new transform
-          applyTransform(tForm, m_cfg, rng, iov);
-          // put it back into the store
-          ldet->addAlignedTransform(tForm, iov);
-        }
-      }
-    }
-  }
-
-  // Garbage collection
-  if (m_cfg.doGarbageCollection) {
-    for (auto it = m_activeIovs.begin(); it != m_activeIovs.end();) {
-      unsigned int this_iov = it->first;
-      auto& status = it->second;
-      if (m_eventsSeen - status.lastAccessed > m_cfg.flushSize) {
-        ACTS_DEBUG("IOV " << this_iov << " has not been accessed in the last "
-                          << m_cfg.flushSize << " events, clearing");
-        it = m_activeIovs.erase(it);
+    // Fast path: the IOV is already present
+    alignContext.alignedTransforms = m_activeIovs.find(iov, eventsSeen);
+
+    if (alignContext.alignedTransforms == nullptr) {
+      // We need to lock the Decorator
+      std::lock_guard<std::mutex> alignmentLock(m_alignmentMutex);
+
+      // Another thread might have created it in the meantime
+      alignContext.alignedTransforms = m_activeIovs.find(iov, eventsSeen);
+      if (alignContext.alignedTransforms == nullptr) {
+        ACTS_VERBOSE("New IOV " << iov << " detected at event "
+                                << context.eventNumber
+                                << ", emulate new alignment.");
+
+        // Create an algorithm local random number generator
+        RandomEngine rng = m_cfg.randomNumberSvc->spawnGenerator(context);
+
+        auto alignedTransforms = std::make_shared<
+            InternallyAlignedDetectorElement::AlignedTransforms>();
+        alignedTransforms->transforms.resize(m_nTransforms,
+                                             Acts::Transform3::Identity());
+        alignedTransforms->inverseTransforms.resize(
+            m_nTransforms, Acts::Transform3::Identity());
         for (auto& lstore : m_cfg.detectorStore) {
           for (auto& ldet : lstore) {
-            ldet->clearAlignedTransform(this_iov);
+            // get the nominal transform
+            Acts::Transform3 tForm =
+                ldet->nominalTransform(context.geoContext);  // copy
+            // create a new transform
+            applyTransform(tForm, m_cfg, rng, iov);
+            // put it into the store, the inverse is computed once per IOV
+            auto idValue = identifier_type(ldet->identifier());
+            alignedTransforms->transforms[idValue] = tForm;
+            alignedTransforms->inverseTransforms[idValue] = tForm.inverse();
+          }
+        }
+
+        m_activeIovs.insert(iov, alignedTransforms, eventsSeen);
+        alignContext.alignedTransforms = std::move(alignedTransforms);
+
+        // Garbage collection, only needed when the store grows
+        if (m_cfg.doGarbageCollection) {
+          for (auto this_iov :
+               m_activeIovs.collectGarbage(eventsSeen, m_cfg.flushSize)) {
+            ACTS_DEBUG("IOV " << this_iov
+                              << " has not been accessed in the last "
+                              << m_cfg.flushSize << " events, clearing");
           }
         }
-      } else {
-        it++;
       }
     }
+
+    // Committed updates, e.g. from the alignment, are published for the later
+    // events
+    alignContext.publish =
+        [this](unsigned int updatedIov,
+               std::shared_ptr<const InternallyAlignedDetectorElement::
+                                   AlignedTransforms> alignedTransforms) {
+          std::lock_guard<std::mutex> alignmentLock(m_alignmentMutex);
+          if (!m_activeIovs.update(updatedIov, std::move(alignedTransforms))) {
+            ACTS_DEBUG("IOV " << updatedIov
+                              << " is no longer active, update not published");
+          }
+        };
   }
 
+  context.geoContext = alignContext;
+
   return ProcessCode::SUCCESS;
 }
@@ -28,6 +28,7 @@
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 #include "ActsExamples/GenericDetector/LayerBuilderT.hpp"
 #include "ActsExamples/GenericDetector/ProtoLayerCreatorT.hpp"
 
@@ -106,6 +107,8 @@ std::vector<std::vector<Acts::Vector3>> modulePositionsDisc(
 /// @param surfaceLLevel is the surface building logging level
 /// @param layerLLevel is the layer building logging level
 /// @param volumeLLevel is the volume building logging level
+/// @param layerExecutor is the optional executor to build the negative,
+///        central and positive layers of the sensitive volumes concurrently
 /// return a unique vector to the tracking geometry
 template <typename detector_element_t>
 std::unique_ptr<const Acts::TrackingGeometry> buildDetector(
@@ -117,7 +120,8 @@ std::unique_ptr<const Acts::TrackingGeometry> buildDetector(
     bool protoMaterial = false,
     Acts::Logging::Level surfaceLLevel = Acts::Logging::INFO,
     Acts::Logging::Level layerLLevel = Acts::Logging::INFO,
-    Acts::Logging::Level volumeLLevel = Acts::Logging::INFO) {
+    Acts::Logging::Level volumeLLevel = Acts::Logging::INFO,
+    const Acts::ParallelExecutor& layerExecutor = {}) {
   using namespace Acts::UnitLiterals;
 
   using ProtoLayerCreator = ProtoLayerCreatorT<detector_element_t>;
@@ -391,6 +395,7 @@ std::unique_ptr<const Acts::TrackingGeometry> buildDetector(
   pvbConfig.layerEnvelopeR = {1. * Acts::UnitConstants::mm,
                               5. * Acts::UnitConstants::mm};
   pvbConfig.layerBuilder = pixelLayerBuilder;
+  pvbConfig.layerExecutor = layerExecutor;
   auto pixelVolumeBuilder = std::make_shared<const Acts::CylinderVolumeBuilder>(
       pvbConfig, Acts::getDefaultLogger("PixelVolumeBuilder", volumeLLevel));
   // add to the list of builders
@@ -619,6 +624,7 @@ std::unique_ptr<const Acts::TrackingGeometry> buildDetector(
     ssvbConfig.volumeName = "SStrip";
     ssvbConfig.buildToRadiusZero = false;
     ssvbConfig.layerBuilder = sstripLayerBuilder;
+    ssvbConfig.layerExecutor = layerExecutor;
     auto sstripVolumeBuilder =
         std::make_shared<const Acts::CylinderVolumeBuilder>(
             ssvbConfig,
@@ -804,6 +810,7 @@ std::unique_ptr<const Acts::TrackingGeometry> buildDetector(
     lsvbConfig.volumeName = "LStrip";
     lsvbConfig.buildToRadiusZero = false;
     lsvbConfig.layerBuilder = lstripLayerBuilder;
+    lsvbConfig.layerExecutor = layerExecutor;
     auto lstripVolumeBuilder =
         std::make_shared<const Acts::CylinderVolumeBuilder>(
             lsvbConfig,
@@ -45,6 +45,11 @@ struct GenericDetector {
     Acts::Logging::Level layerLogLevel{Acts::Logging::INFO};
     Acts::Logging::Level volumeLogLevel{Acts::Logging::INFO};
     bool buildProto{false};
+    /// Build the layers of the sensitive volumes concurrently on the TBB
+    /// thread pool. This does not depend on the sequencer, which usually
+    /// enables TBB only after the detector is built. Ignored if the examples
+    /// are built without TBB.
+    bool concurrentLayers{false};
   };
 
   /// The Store of the detector elements (lifetime: job)
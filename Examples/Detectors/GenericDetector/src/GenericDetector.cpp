@@ -13,18 +13,30 @@
 #include "ActsExamples/GenericDetector/BuildGenericDetector.hpp"
 #include "ActsExamples/GenericDetector/GenericDetectorElement.hpp"
 #include "ActsExamples/GenericDetector/ProtoLayerCreatorT.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+
+#include <cstddef>
 
 auto GenericDetector::finalize(
     const Config& cfg,
     std::shared_ptr<const Acts::IMaterialDecorator> mdecorator)
     -> std::pair<TrackingGeometryPtr, ContextDecorators> {
   DetectorElement::ContextType nominalContext;
+  Acts::ParallelExecutor layerExecutor;
+#ifndef ACTS_EXAMPLES_NO_TBB
+  if (cfg.concurrentLayers) {
+    // use TBB directly, the tbbWrap switch is only set by the sequencer
+    layerExecutor = [](std::size_t nTasks, const Acts::ParallelTask& task) {
+      tbb::parallel_for(std::size_t{0}, nTasks, task);
+    };
+  }
+#endif
   /// Return the generic detector
   TrackingGeometryPtr gGeometry =
       ActsExamples::Generic::buildDetector<DetectorElement>(
           nominalContext, detectorStore, cfg.buildLevel, std::move(mdecorator),
           cfg.buildProto, cfg.surfaceLogLevel, cfg.layerLogLevel,
-          cfg.volumeLogLevel);
+          cfg.volumeLogLevel, layerExecutor);
   ContextDecorators gContextDecorators = {};
   // return the pair of geometry and empty decorators
   return std::make_pair<TrackingGeometryPtr, ContextDecorators>(
@@ -6,6 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/SourceLink.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/UnitVectors.hpp"
@@ -100,84 +101,82 @@ void ActsExamples::NeuralCalibrator::calibrate(
 
   const Acts::Surface& referenceSurface = trackState.referenceSurface();
 
-  std::visit(
-      [&](const auto& measurement) {
-        auto E = measurement.expander();
-        auto P = measurement.projector();
-        Acts::ActsVector<Acts::eBoundSize> fpar = E * measurement.parameters();
-        Acts::ActsSquareMatrix<Acts::eBoundSize> fcov =
-            E * measurement.covariance() * E.transpose();
-
-        Acts::Vector3 dir = Acts::makeDirectionFromPhiTheta(
-            fpar[Acts::eBoundPhi], fpar[Acts::eBoundTheta]);
-        Acts::Vector3 globalPosition = referenceSurface.localToGlobal(
-            gctx, fpar.segment<2>(Acts::eBoundLoc0), dir);
-
-        // Rotation matrix. When applied to global coordinates, they
-        // are rotated into the local reference frame of the
-        // surface. Note that this such a rotation can be found by
-        // inverting a matrix whose columns correspond to the
-        // coordinate axes of the local coordinate system.
-        Acts::RotationMatrix3 rot =
-            referenceSurface.referenceFrame(gctx, globalPosition, dir)
-                .inverse();
-        std::pair<double, double> angles =
-            Acts::VectorHelpers::incidentAngles(dir, rot);
-
-        input[iInput++] = angles.first;
-        input[iInput++] = angles.second;
-        input[iInput++] = fpar[Acts::eBoundLoc0];
-        input[iInput++] = fpar[Acts::eBoundLoc1];
-        input[iInput++] = fcov(Acts::eBoundLoc0, Acts::eBoundLoc0);
-        input[iInput++] = fcov(Acts::eBoundLoc1, Acts::eBoundLoc1);
-        if (iInput != m_nInputs) {
-          throw std::runtime_error("Expected input size of " +
-                                   std::to_string(m_nInputs) +
-                                   ", got: " + std::to_string(iInput));
-        }
-
-        // Input is a single row, hence .front()
-        std::vector<float> output =
-            m_model.runONNXInference(inputBatch).front();
-        // Assuming 2-D measurements, the expected params structure is:
-        // [           0,    nComponent[ --> priors
-        // [  nComponent,  3*nComponent[ --> means
-        // [3*nComponent,  5*nComponent[ --> variances
-        std::size_t nParams = 5 * m_nComponents;
-        if (output.size() != nParams) {
-          throw std::runtime_error(
-              "Got output vector of size " + std::to_string(output.size()) +
-              ", expected size " + std::to_string(nParams));
-        }
-
-        // Most probable value computation of mixture density
-        std::size_t iMax = 0;
-        if (m_nComponents > 1) {
-          iMax = std::distance(
-              output.begin(),
-              std::max_element(output.begin(), output.begin() + m_nComponents));
-        }
-        std::size_t iLoc0 = m_nComponents + iMax * 2;
-        std::size_t iVar0 = 3 * m_nComponents + iMax * 2;
-
-        fpar[Acts::eBoundLoc0] = output[iLoc0];
-        fpar[Acts::eBoundLoc1] = output[iLoc0 + 1];
-        fcov(Acts::eBoundLoc0, Acts::eBoundLoc0) = output[iVar0];
-        fcov(Acts::eBoundLoc1, Acts::eBoundLoc1) = output[iVar0 + 1];
-
-        constexpr std::size_t kSize =
-            std::remove_reference_t<decltype(measurement)>::size();
-        std::array<Acts::BoundIndices, kSize> indices = measurement.indices();
-        Acts::ActsVector<kSize> cpar = P * fpar;
-        Acts::ActsSquareMatrix<kSize> ccov = P * fcov * P.transpose();
-
-        Acts::SourceLink sl{idxSourceLink};
-
-        Acts::Measurement<Acts::BoundIndices, kSize> calibrated(
-            std::move(sl), indices, cpar, ccov);
-
-        trackState.allocateCalibrated(calibrated.size());
-        trackState.setCalibrated(calibrated);
-      },
-      measurements[idxSourceLink.index()]);
+  const auto measurement = measurements.getMeasurement(idxSourceLink.index());
+  Acts::visit_measurement(measurement.size(), [&](auto dim) {
+    constexpr std::size_t kSize = decltype(dim)::value;
+    auto E = measurement.template expander<kSize>();
+    auto P = measurement.template projector<kSize>();
+    Acts::ActsVector<Acts::eBoundSize> fpar =
+        E * measurement.template parameters<kSize>();
+    Acts::ActsSquareMatrix<Acts::eBoundSize> fcov =
+        E * measurement.template covariance<kSize>() * E.transpose();
+
+    Acts::Vector3 dir = Acts::makeDirectionFromPhiTheta(
+        fpar[Acts::eBoundPhi], fpar[Acts::eBoundTheta]);
+    Acts::Vector3 globalPosition = referenceSurface.localToGlobal(
+        gctx, fpar.segment<2>(Acts::eBoundLoc0), dir);
+
+    // Rotation matrix. When applied to global coordinates, they
+    // are rotated into the local reference frame of the
+    // surface. Note that this such a rotation can be found by
+    // inverting a matrix whose columns correspond to the
+    // coordinate axes of the local coordinate system.
+    Acts::RotationMatrix3 rot =
+        referenceSurface.referenceFrame(gctx, globalPosition, dir).inverse();
+    std::pair<double, double> angles =
+        Acts::VectorHelpers::incidentAngles(dir, rot);
+
+    input[iInput++] = angles.first;
+    input[iInput++] = angles.second;
+    input[iInput++] = fpar[Acts::eBoundLoc0];
+    input[iInput++] = fpar[Acts::eBoundLoc1];
+    input[iInput++] = fcov(Acts::eBoundLoc0, Acts::eBoundLoc0);
+    input[iInput++] = fcov(Acts::eBoundLoc1, Acts::eBoundLoc1);
+    if (iInput != m_nInputs) {
+      throw std::runtime_error("Expected input size of " +
+                               std::to_string(m_nInputs) +
+                               ", got: " + std::to_string(iInput));
+    }
+
+    // Input is a single row, hence .front()
+    std::vector<float> output = m_model.runONNXInference(inputBatch).front();
+    // Assuming 2-D measurements, the expected params structure is:
+    // [           0,    nComponent[ --> priors
+    // [  nComponent,  3*nComponent[ --> means
+    // [3*nComponent,  5*nComponent[ --> variances
+    std::size_t nParams = 5 * m_nComponents;
+    if (output.size() != nParams) {
+      throw std::runtime_error(
+          "Got output vector of size " + std::to_string(output.size()) +
+          ", expected size " + std::to_string(nParams));
+    }
+
+    // Most probable value computation of mixture density
+    std::size_t iMax = 0;
+    if (m_nComponents > 1) {
+      iMax = std::distance(
+          output.begin(),
+          std::max_element(output.begin(), output.begin() + m_nComponents));
+    }
+    std::size_t iLoc0 = m_nComponents + iMax * 2;
+    std::size_t iVar0 = 3 * m_nComponents + iMax * 2;
+
+    fpar[Acts::eBoundLoc0] = output[iLoc0];
+    fpar[Acts::eBoundLoc1] = output[iLoc0 + 1];
+    fcov(Acts::eBoundLoc0, Acts::eBoundLoc0) = output[iVar0];
+    fcov(Acts::eBoundLoc1, Acts::eBoundLoc1) = output[iVar0 + 1];
+
+    std::array<Acts::BoundIndices, kSize> indices =
+        measurement.template subspaceIndices<kSize>();
+    Acts::ActsVector<kSize> cpar = P * fpar;
+    Acts::ActsSquareMatrix<kSize> ccov = P * fcov * P.transpose();
+
+    Acts::SourceLink sl{idxSourceLink};
+
+    Acts::Measurement<Acts::BoundIndices, kSize> calibrated(
+        std::move(sl), indices, cpar, ccov);
+
+    trackState.allocateCalibrated(calibrated.size());
+    trackState.setCalibrated(calibrated);
+  });
 }
@@ -74,6 +74,11 @@ class IndexSourceLink final {
 ///
 /// Since the source links provide a `.geometryId()` accessor, they can be
 /// stored in an ordered geometry container.
+// Index source links are stored in the local buffer of Acts::SourceLink, so
+// the track states can copy them without a heap allocation
+static_assert(Acts::SourceLink::fitsLocally<IndexSourceLink>(),
+              "Index source links must not be allocated on the heap");
+
 using IndexSourceLinkContainer = GeometryIdMultiset<IndexSourceLink>;
 /// Accessor for the above source link container
 ///
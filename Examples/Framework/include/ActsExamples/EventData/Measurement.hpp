@@ -8,8 +8,21 @@
 
 #pragma once
 
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/SourceLinkTable.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Utilities/detail/Subspace.hpp"
 #include <Acts/EventData/Measurement.hpp>
 
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace ActsExamples {
@@ -22,6 +35,302 @@ using Measurement = ::Acts::BoundVariantMeasurement;
 /// In contrast to the source links, the measurements themself must not be
 /// orderable. The source links stored in the measurements are treated
 /// as opaque here and no ordering is enforced on the stored measurements.
-using MeasurementContainer = std::vector<Measurement>;
+///
+/// The measurements are stored as structure of arrays: the parameters, the
+/// covariances and the subspace indices of all measurements are each packed
+/// into one contiguous column using only as many entries as the measurement
+/// has dimensions. A one dimensional strip measurement thus only takes one
+/// parameter and one covariance entry instead of the full variant size.
+/// The measurements are accessed through light-weight proxies.
+class MeasurementContainer {
+ public:
+  /// Read-only view of one measurement in the container
+  class ConstMeasurementProxy {
+   public:
+    /// @return the index of the measurement in the container
+    std::size_t index() const { return m_index; }
+
+    /// @return the number of measured parameters
+    std::size_t size() const { return m_container->m_sizes[m_index]; }
+
+    /// @return the source link of the measurement
+    const Acts::SourceLink& sourceLink() const {
+      return m_container->m_sourceLinks[m_index];
+    }
+
+    /// @return the geometry identifier of the measurement surface
+    Acts::GeometryIdentifier geometryId() const {
+      return m_container->m_geometryIds[m_index];
+    }
+
+    /// @return the @p i-th measured parameter index
+    Acts::BoundIndices subspaceIndex(std::size_t i) const {
+      assert(i < size() && "Subspace index out of range");
+      return static_cast<Acts::BoundIndices>(
+          m_container->m_subspaceIndices[m_container->m_offsets[m_index] + i]);
+    }
+
+    /// @tparam kSize the number of measured parameters
+    /// @return the measured parameter indices
+    template <std::size_t kSize>
+    std::array<Acts::BoundIndices, kSize> subspaceIndices() const {
+      assert(kSize == size() && "Measurement size mismatch");
+      std::array<Acts::BoundIndices, kSize> indices{};
+      for (std::size_t i = 0; i < kSize; ++i) {
+        indices[i] = subspaceIndex(i);
+      }
+      return indices;
+    }
+
+    /// @tparam kSize the number of measured parameters
+    /// @return the measured parameters
+    template <std::size_t kSize>
+    Eigen::Map<const Acts::ActsVector<kSize>> parameters() const {
+      assert(kSize == size() && "Measurement size mismatch");
+      return Eigen::Map<const Acts::ActsVector<kSize>>(
+          m_container->m_parameters.data() + m_container->m_offsets[m_index]);
+    }
+
+    /// @tparam kSize the number of measured parameters
+    /// @return the covariance of the measured parameters
+    template <std::size_t kSize>
+    Eigen::Map<const Acts::ActsSquareMatrix<kSize>> covariance() const {
+      assert(kSize == size() && "Measurement size mismatch");
+      return Eigen::Map<const Acts::ActsSquareMatrix<kSize>>(
+          m_container->m_covariances.data() +
+          m_container->m_covarianceOffsets[m_index]);
+    }
+
+    /// @return the measured parameters with dynamic size
+    Eigen::Map<const Acts::ActsDynamicVector> effectiveParameters() const {
+      return Eigen::Map<const Acts::ActsDynamicVector>(
+          m_container->m_parameters.data() + m_container->m_offsets[m_index],
+          size());
+    }
+
+    /// @return the covariance of the measured parameters with dynamic size
+    Eigen::Map<const Acts::ActsDynamicMatrix> effectiveCovariance() const {
+      return Eigen::Map<const Acts::ActsDynamicMatrix>(
+          m_container->m_covariances.data() +
+              m_container->m_covarianceOffsets[m_index],
+          size(), size());
+    }
+
+    /// @tparam kSize the number of measured parameters
+    /// @return the projection from the bound parameters to the measurement
+    template <std::size_t kSize>
+    Acts::ActsMatrix<kSize, Acts::eBoundSize> projector() const {
+      return Acts::detail::FixedSizeSubspace<Acts::eBoundSize, kSize>(
+                 subspaceIndices<kSize>())
+          .template projector<Acts::ActsScalar>();
+    }
+
+    /// @tparam kSize the number of measured parameters
+    /// @return the expansion from the measurement to the bound parameters
+    template <std::size_t kSize>
+    Acts::ActsMatrix<Acts::eBoundSize, kSize> expander() const {
+      return projector<kSize>().transpose();
+    }
+
+    /// @param index the bound parameter index
+    /// @return true if the parameter is measured
+    bool contains(Acts::BoundIndices index) const {
+      for (std::size_t i = 0; i < size(); ++i) {
+        if (subspaceIndex(i) == index) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /// @return the measured parameters expanded to the bound parameters,
+    ///         unmeasured parameters are zero
+    Acts::BoundVector fullParameters() const {
+      Acts::BoundVector full = Acts::BoundVector::Zero();
+      const auto par = effectiveParameters();
+      for (std::size_t i = 0; i < size(); ++i) {
+        full[subspaceIndex(i)] = par[i];
+      }
+      return full;
+    }
+
+    /// @return the measured covariance expanded to the bound parameters,
+    ///         unmeasured entries are zero
+    Acts::BoundSquareMatrix fullCovariance() const {
+      Acts::BoundSquareMatrix full = Acts::BoundSquareMatrix::Zero();
+      const auto cov = effectiveCovariance();
+      for (std::size_t i = 0; i < size(); ++i) {
+        for (std::size_t j = 0; j < size(); ++j) {
+          full(subspaceIndex(i), subspaceIndex(j)) = cov(i, j);
+        }
+      }
+      return full;
+    }
+
+    /// @tparam kSize the number of measured parameters
+    /// @return a copy as fixed size measurement
+    template <std::size_t kSize>
+    Acts::Measurement<Acts::BoundIndices, kSize> fixedSize() const {
+      return Acts::Measurement<Acts::BoundIndices, kSize>(
+          sourceLink(), subspaceIndices<kSize>(), parameters<kSize>(),
+          covariance<kSize>());
+    }
+
+    /// @return a copy as variant measurement
+    Measurement variant() const;
+
+   private:
+    ConstMeasurementProxy(const MeasurementContainer& container,
+                          std::size_t index)
+        : m_container(&container), m_index(index) {}
+
+    const MeasurementContainer* m_container;
+    std::size_t m_index;
+
+    friend class MeasurementContainer;
+  };
+
+  /// Iterator over the measurements yielding read-only proxies
+  class ConstIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ConstMeasurementProxy;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = ConstMeasurementProxy;
+
+    ConstIterator(const MeasurementContainer& container, std::size_t index)
+        : m_container(&container), m_index(index) {}
+
+    ConstMeasurementProxy operator*() const {
+      return m_container->getMeasurement(m_index);
+    }
+
+    ConstIterator& operator++() {
+      ++m_index;
+      return *this;
+    }
+
+    ConstIterator operator++(int) {
+      ConstIterator it = *this;
+      ++m_index;
+      return it;
+    }
+
+    bool operator==(const ConstIterator& other) const {
+      return m_index == other.m_index && m_container == other.m_container;
+    }
+
+    bool operator!=(const ConstIterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    const MeasurementContainer* m_container;
+    std::size_t m_index;
+  };
+
+  using const_iterator = ConstIterator;
+
+  /// @return the number of measurements
+  std::size_t size() const { return m_sizes.size(); }
+
+  /// @return true if there are no measurements
+  bool empty() const { return m_sizes.empty(); }
+
+  /// Reserve space for @p n measurements, assuming two dimensions each
+  void reserve(std::size_t n);
+
+  /// Remove all measurements
+  void clear();
+
+  /// Add a measurement
+  ///
+  /// @tparam kSize the number of measured parameters
+  /// @param sourceLink the source link of the measurement
+  /// @param geometryId the geometry identifier of the measurement surface
+  /// @param indices the measured parameter indices, ordered
+  /// @param parameters the measured parameters
+  /// @param covariance the covariance of the measured parameters
+  /// @return the index of the new measurement
+  template <std::size_t kSize, typename parameters_t, typename covariance_t>
+  std::size_t emplaceMeasurement(
+      Acts::SourceLink sourceLink, Acts::GeometryIdentifier geometryId,
+      const std::array<Acts::BoundIndices, kSize>& indices,
+      const Eigen::MatrixBase<parameters_t>& parameters,
+      const Eigen::MatrixBase<covariance_t>& covariance) {
+    static_assert(0 < kSize && kSize <= Acts::eBoundSize,
+                  "Invalid measurement size");
+    const std::size_t index = size();
+    m_sizes.push_back(kSize);
+    m_offsets.push_back(m_parameters.size());
+    m_covarianceOffsets.push_back(m_covariances.size());
+    for (std::size_t i = 0; i < kSize; ++i) {
+      m_subspaceIndices.push_back(static_cast<std::uint8_t>(indices[i]));
+      m_parameters.push_back(parameters[i]);
+    }
+    // column major as the Eigen matrices
+    for (std::size_t col = 0; col < kSize; ++col) {
+      for (std::size_t row = 0; row < kSize; ++row) {
+        m_covariances.push_back(covariance(row, col));
+      }
+    }
+    m_sourceLinks.push_back(std::move(sourceLink));
+    m_geometryIds.push_back(geometryId);
+    return index;
+  }
+
+  /// Add a variant measurement
+  ///
+  /// @param measurement the measurement with an index source link
+  void push_back(const Measurement& measurement);
+
+  /// Add a variant measurement
+  ///
+  /// @param measurement the measurement with an index source link
+  void emplace_back(const Measurement& measurement) { push_back(measurement); }
+
+  /// @return a proxy to the measurement with the given @p index
+  ConstMeasurementProxy getMeasurement(std::size_t index) const {
+    assert(index < size() && "Measurement index out of range");
+    return ConstMeasurementProxy(*this, index);
+  }
+
+  /// @return an iterator to the first measurement
+  ConstIterator begin() const { return ConstIterator(*this, 0); }
+
+  /// @return an iterator past the last measurement
+  ConstIterator end() const { return ConstIterator(*this, size()); }
+
+  /// Copy a measurement into a variant measurement.
+  ///
+  /// @note Prefer @c getMeasurement which does not copy
+  Measurement operator[](std::size_t index) const {
+    return getMeasurement(index).variant();
+  }
+
+ private:
+  /// The number of measured parameters
+  std::vector<std::uint8_t> m_sizes;
+  /// The offsets into the parameter and subspace index columns
+  std::vector<std::size_t> m_offsets;
+  /// The offsets into the covariance column
+  std::vector<std::size_t> m_covarianceOffsets;
+
+  std::vector<std::uint8_t> m_subspaceIndices;
+  std::vector<Acts::ActsScalar> m_parameters;
+  std::vector<Acts::ActsScalar> m_covariances;
+  std::vector<Acts::SourceLink> m_sourceLinks;
+  std::vector<Acts::GeometryIdentifier> m_geometryIds;
+};
+
+/// Create a source link table with the source links of all measurements in
+/// their order. The handle of an index source link is its measurement index,
+/// so the track states refer to the measurement source links without adding
+/// them to the table again.
+///
+/// @param measurements the measurements with index source links
+std::shared_ptr<Acts::SourceLinkTable> makeSourceLinkTable(
+    const MeasurementContainer& measurements);
 
 }  // namespace ActsExamples
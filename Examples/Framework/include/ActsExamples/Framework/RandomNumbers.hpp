@@ -55,6 +55,18 @@ class RandomNumbers {
   /// @param context is the AlgorithmContext of the host algorithm
   RandomEngine spawnGenerator(const AlgorithmContext& context) const;
 
+  /// Spawn a random number generator for an independent part of the event,
+  /// e.g. a single particle or detector module.
+  ///
+  /// The seed only depends on the event seed and the key, the generated
+  /// numbers are hence independent of the order in which the parts are
+  /// processed and of the number of threads.
+  ///
+  /// @param context is the AlgorithmContext of the host algorithm
+  /// @param key identifies the part of the event
+  RandomEngine spawnGenerator(const AlgorithmContext& context,
+                              std::uint64_t key) const;
+
   /// Generate a event and algorithm specific seed value.
   ///
   /// This should only be used in special cases e.g. where a custom
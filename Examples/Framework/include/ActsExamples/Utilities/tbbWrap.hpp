@@ -8,6 +8,10 @@
 
 #pragma once
 
+#include "Acts/Utilities/ParallelExecutor.hpp"
+
+#include <cstddef>
+
 // uncomment to remove all use of tbb library.
 // #define ACTS_EXAMPLES_NO_TBB
 
@@ -62,11 +66,13 @@ struct blocked_range {
 
 namespace tbbWrap {
 /// enableTBB keeps a record of whether we are multi-threaded (nthreads!=1) or
-/// not. This is set once in task_arena and stored globally.
+/// not. This is set once in task_arena and stored globally, i.e. it is shared
+/// by all translation units and thus also enables the tbbWrap::parallel_for
+/// calls inside the algorithms.
 /// This means that enableTBB(nthreads) itself is not thread-safe. That should
 /// be fine because the task_arena is initialised before spawning any threads.
 /// If multi-threading is ever enabled, then it is not disabled.
-static bool enableTBB(int nthreads = -99) {
+inline bool enableTBB(int nthreads = -99) {
   static bool setting = false;
   if (nthreads != -99) {
 #ifdef ACTS_EXAMPLES_NO_TBB
@@ -173,5 +179,20 @@ class queuing_mutex {
   };
 };
 
+/// Executor for the Acts tools taking an Acts::ParallelExecutor.
+/// The tasks are run with tbbWrap::parallel_for, i.e. sequentially unless
+/// TBB is enabled. Nested calls from within a task are fine, the waiting
+/// TBB workers run other tasks in the meantime.
+inline Acts::ParallelExecutor parallelExecutor() {
+  return [](std::size_t nTasks, const Acts::ParallelTask& task) {
+    parallel_for(tbb::blocked_range<std::size_t>(0, nTasks),
+                 [&](const tbb::blocked_range<std::size_t>& range) {
+                   for (auto i = range.begin(); i != range.end(); ++i) {
+                     task(i);
+                   }
+                 });
+  };
+}
+
 }  // namespace tbbWrap
 }  // namespace ActsExamples
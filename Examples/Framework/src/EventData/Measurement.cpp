@@ -0,0 +1,82 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/EventData/Measurement.hpp"
+
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+
+#include <cassert>
+#include <memory>
+#include <utility>
+#include <variant>
+
+namespace {
+
+Acts::SourceLinkTable::Handle lookupIndexSourceLink(
+    const Acts::SourceLink& sourceLink) {
+  return sourceLink.get<ActsExamples::IndexSourceLink>().index();
+}
+
+}  // namespace
+
+ActsExamples::Measurement
+ActsExamples::MeasurementContainer::ConstMeasurementProxy::variant() const {
+  return Acts::visit_measurement(size(), [&](auto dim) -> Measurement {
+    constexpr std::size_t kSize = decltype(dim)::value;
+    return fixedSize<kSize>();
+  });
+}
+
+void ActsExamples::MeasurementContainer::reserve(std::size_t n) {
+  m_sizes.reserve(n);
+  m_offsets.reserve(n);
+  m_covarianceOffsets.reserve(n);
+  m_subspaceIndices.reserve(2 * n);
+  m_parameters.reserve(2 * n);
+  m_covariances.reserve(4 * n);
+  m_sourceLinks.reserve(n);
+  m_geometryIds.reserve(n);
+}
+
+void ActsExamples::MeasurementContainer::clear() {
+  m_sizes.clear();
+  m_offsets.clear();
+  m_covarianceOffsets.clear();
+  m_subspaceIndices.clear();
+  m_parameters.clear();
+  m_covariances.clear();
+  m_sourceLinks.clear();
+  m_geometryIds.clear();
+}
+
+void ActsExamples::MeasurementContainer::push_back(
+    const Measurement& measurement) {
+  std::visit(
+      [this](const auto& meas) {
+        const auto geometryId =
+            meas.sourceLink().template get<IndexSourceLink>().geometryId();
+        emplaceMeasurement(meas.sourceLink(), geometryId, meas.indices(),
+                           meas.parameters(), meas.covariance());
+      },
+      measurement);
+}
+
+std::shared_ptr<Acts::SourceLinkTable> ActsExamples::makeSourceLinkTable(
+    const MeasurementContainer& measurements) {
+  Acts::SourceLinkTable::Lookup lookup;
+  lookup.connect<&lookupIndexSourceLink>();
+  auto table = std::make_shared<Acts::SourceLinkTable>(std::move(lookup));
+  table->reserve(measurements.size());
+  for (const auto& measurement : measurements) {
+    [[maybe_unused]] auto handle = table->insert(measurement.sourceLink());
+    assert(handle == measurement.sourceLink().get<IndexSourceLink>().index() &&
+           "Measurement index and source link index differ");
+  }
+  return table;
+}
@@ -6,13 +6,14 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/SourceLink.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include <ActsExamples/EventData/MeasurementCalibration.hpp>
 
 #include <cassert>
-#include <variant>
+#include <cstddef>
 
 namespace Acts {
 class VectorMultiTrajectory;
@@ -30,12 +31,17 @@ void ActsExamples::PassThroughCalibrator::calibrate(
   assert((idxSourceLink.index() < measurements.size()) &&
          "Source link index is outside the container bounds");
 
-  std::visit(
-      [&trackState](const auto& meas) {
-        trackState.allocateCalibrated(meas.size());
-        trackState.setCalibrated(meas);
-      },
-      (measurements)[idxSourceLink.index()]);
+  // copy directly from the measurement columns without a variant
+  const auto measurement = measurements.getMeasurement(idxSourceLink.index());
+  Acts::visit_measurement(measurement.size(), [&](auto dim) {
+    constexpr std::size_t kSize = decltype(dim)::value;
+    trackState.allocateCalibrated(kSize);
+    trackState.template calibrated<kSize>() =
+        measurement.template parameters<kSize>();
+    trackState.template calibratedCovariance<kSize>() =
+        measurement.template covariance<kSize>();
+    trackState.setProjector(measurement.template projector<kSize>());
+  });
 }
 
 ActsExamples::MeasurementCalibratorAdapter::MeasurementCalibratorAdapter(
@@ -9,6 +9,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/EventData/Measurement.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/SourceLink.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
@@ -151,32 +152,32 @@ void ActsExamples::ScalingCalibrator::calibrate(
   const Cluster& cl = clusters->at(idxSourceLink.index());
   ConstantTuple ct = m_calib_maps.at(mgid).at(cl.sizeLoc0, cl.sizeLoc1);
 
-  std::visit(
-      [&](const auto& meas) {
-        auto E = meas.expander();
-        auto P = meas.projector();
+  const auto meas = measurements.getMeasurement(idxSourceLink.index());
+  Acts::visit_measurement(meas.size(), [&](auto dim) {
+    constexpr std::size_t kSize = decltype(dim)::value;
+    auto E = meas.template expander<kSize>();
+    auto P = meas.template projector<kSize>();
 
-        Acts::ActsVector<Acts::eBoundSize> fpar = E * meas.parameters();
+    Acts::ActsVector<Acts::eBoundSize> fpar =
+        E * meas.template parameters<kSize>();
 
-        Acts::ActsSquareMatrix<Acts::eBoundSize> fcov =
-            E * meas.covariance() * E.transpose();
+    Acts::ActsSquareMatrix<Acts::eBoundSize> fcov =
+        E * meas.template covariance<kSize>() * E.transpose();
 
-        fpar[Acts::eBoundLoc0] += ct.x_offset;
-        fpar[Acts::eBoundLoc1] += ct.y_offset;
-        fcov(Acts::eBoundLoc0, Acts::eBoundLoc0) *= ct.x_scale;
-        fcov(Acts::eBoundLoc1, Acts::eBoundLoc1) *= ct.y_scale;
+    fpar[Acts::eBoundLoc0] += ct.x_offset;
+    fpar[Acts::eBoundLoc1] += ct.y_offset;
+    fcov(Acts::eBoundLoc0, Acts::eBoundLoc0) *= ct.x_scale;
+    fcov(Acts::eBoundLoc1, Acts::eBoundLoc1) *= ct.y_scale;
 
-        constexpr std::size_t kSize =
-            std::remove_reference_t<decltype(meas)>::size();
-        std::array<Acts::BoundIndices, kSize> indices = meas.indices();
-        Acts::ActsVector<kSize> cpar = P * fpar;
-        Acts::ActsSquareMatrix<kSize> ccov = P * fcov * P.transpose();
+    std::array<Acts::BoundIndices, kSize> indices =
+        meas.template subspaceIndices<kSize>();
+    Acts::ActsVector<kSize> cpar = P * fpar;
+    Acts::ActsSquareMatrix<kSize> ccov = P * fcov * P.transpose();
 
-        Acts::Measurement<Acts::BoundIndices, kSize> cmeas(
-            Acts::SourceLink{idxSourceLink}, indices, cpar, ccov);
+    Acts::Measurement<Acts::BoundIndices, kSize> cmeas(
+        Acts::SourceLink{idxSourceLink}, indices, cpar, ccov);
 
-        trackState.allocateCalibrated(cmeas.size());
-        trackState.setCalibrated(cmeas);
-      },
-      (measurements)[idxSourceLink.index()]);
+    trackState.allocateCalibrated(cmeas.size());
+    trackState.setCalibrated(cmeas);
+  });
 }
@@ -18,6 +18,9 @@
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 
+#include <cstdint>
+#include <random>
+
 ActsExamples::RandomNumbers::RandomNumbers(const Config& cfg) : m_cfg(cfg) {}
 
 ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
@@ -25,6 +28,18 @@ ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
   return RandomEngine(generateSeed(context));
 }
 
+ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
+    const AlgorithmContext& context, std::uint64_t key) const {
+  // splitmix64 finalizer to decorrelate the seeds of adjacent keys
+  std::uint64_t z = generateSeed(context) + 0x9e3779b97f4a7c15u * (key + 1u);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+  z = z ^ (z >> 31);
+  std::seed_seq seq{static_cast<std::uint32_t>(z),
+                    static_cast<std::uint32_t>(z >> 32)};
+  return RandomEngine(seq);
+}
+
 uint64_t ActsExamples::RandomNumbers::generateSeed(
     const AlgorithmContext& context) const {
   return m_cfg.seed + context.eventNumber;
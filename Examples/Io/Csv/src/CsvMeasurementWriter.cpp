@@ -13,7 +13,6 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "ActsExamples/EventData/Cluster.hpp"
 #include "ActsExamples/EventData/Index.hpp"
-#include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
@@ -23,7 +22,6 @@
 #include <optional>
 #include <ostream>
 #include <stdexcept>
-#include <variant>
 #include <vector>
 
 #include <dfe/dfe_io_dsv.hpp>
@@ -91,64 +89,58 @@ ActsExamples::ProcessCode ActsExamples::CsvMeasurementWriter::writeT(
                           << " measurements in this event.");
 
   for (Index measIdx = 0u; measIdx < measurements.size(); ++measIdx) {
-    const auto& measurement = measurements[measIdx];
+    const auto measurement = measurements.getMeasurement(measIdx);
 
     auto simHitIndices = makeRange(measurementSimHitsMap.equal_range(measIdx));
     for (auto [_, simHitIdx] : simHitIndices) {
       writerMeasurementSimHitMap.append({measIdx, simHitIdx});
     }
 
-    std::visit(
-        [&](const auto& m) {
-          Acts::GeometryIdentifier geoId =
-              m.sourceLink().template get<IndexSourceLink>().geometryId();
-          // MEASUREMENT information ------------------------------------
-
-          // Encoded geometry identifier. same for all hits on the module
-          meas.geometry_id = geoId.value();
-          meas.local_key = 0;
-          // Create a full set of parameters
-          auto parameters = (m.expander() * m.parameters()).eval();
-          meas.local0 = parameters[Acts::eBoundLoc0];
-          meas.local1 = parameters[Acts::eBoundLoc1];
-          meas.phi = parameters[Acts::eBoundPhi];
-          meas.theta = parameters[Acts::eBoundTheta];
-          meas.time = parameters[Acts::eBoundTime] / Acts::UnitConstants::ns;
-
-          auto covariance =
-              (m.expander() * m.covariance() * m.expander().transpose()).eval();
-          meas.var_local0 = covariance(Acts::eBoundLoc0, Acts::eBoundLoc0);
-          meas.var_local1 = covariance(Acts::eBoundLoc1, Acts::eBoundLoc1);
-          meas.var_phi = covariance(Acts::eBoundPhi, Acts::eBoundPhi);
-          meas.var_theta = covariance(Acts::eBoundTheta, Acts::eBoundTheta);
-          meas.var_time = covariance(Acts::eBoundTime, Acts::eBoundTime);
-          for (unsigned int ipar = 0;
-               ipar < static_cast<unsigned int>(Acts::eBoundSize); ++ipar) {
-            if (m.contains(static_cast<Acts::BoundIndices>(ipar))) {
-              meas.local_key = ((1 << (ipar + 1)) | meas.local_key);
-            }
-          }
-
-          writerMeasurements.append(meas);
-
-          // CLUSTER / channel information ------------------------------
-          if (!clusters.empty() && writerCells) {
-            auto cluster = clusters[measIdx];
-            cell.geometry_id = meas.geometry_id;
-            cell.measurement_id = meas.measurement_id;
-            for (auto& c : cluster.channels) {
-              cell.channel0 = c.bin[0];
-              cell.channel1 = c.bin[1];
-              // TODO store digital timestamp once added to the cell definition
-              cell.timestamp = 0;
-              cell.value = c.activation;
-              writerCells->append(cell);
-            }
-          }
-          // Increase counter
-          meas.measurement_id += 1;
-        },
-        measurement);
+    Acts::GeometryIdentifier geoId = measurement.geometryId();
+    // MEASUREMENT information ------------------------------------
+
+    // Encoded geometry identifier. same for all hits on the module
+    meas.geometry_id = geoId.value();
+    meas.local_key = 0;
+    // Create a full set of parameters
+    auto parameters = measurement.fullParameters();
+    meas.local0 = parameters[Acts::eBoundLoc0];
+    meas.local1 = parameters[Acts::eBoundLoc1];
+    meas.phi = parameters[Acts::eBoundPhi];
+    meas.theta = parameters[Acts::eBoundTheta];
+    meas.time = parameters[Acts::eBoundTime] / Acts::UnitConstants::ns;
+
+    auto covariance = measurement.fullCovariance();
+    meas.var_local0 = covariance(Acts::eBoundLoc0, Acts::eBoundLoc0);
+    meas.var_local1 = covariance(Acts::eBoundLoc1, Acts::eBoundLoc1);
+    meas.var_phi = covariance(Acts::eBoundPhi, Acts::eBoundPhi);
+    meas.var_theta = covariance(Acts::eBoundTheta, Acts::eBoundTheta);
+    meas.var_time = covariance(Acts::eBoundTime, Acts::eBoundTime);
+    for (unsigned int ipar = 0;
+         ipar < static_cast<unsigned int>(Acts::eBoundSize); ++ipar) {
+      if (measurement.contains(static_cast<Acts::BoundIndices>(ipar))) {
+        meas.local_key = ((1 << (ipar + 1)) | meas.local_key);
+      }
+    }
+
+    writerMeasurements.append(meas);
+
+    // CLUSTER / channel information ------------------------------
+    if (!clusters.empty() && writerCells) {
+      auto cluster = clusters[measIdx];
+      cell.geometry_id = meas.geometry_id;
+      cell.measurement_id = meas.measurement_id;
+      for (auto& c : cluster.channels) {
+        cell.channel0 = c.bin[0];
+        cell.channel1 = c.bin[1];
+        // TODO store digital timestamp once added to the cell definition
+        cell.timestamp = 0;
+        cell.value = c.activation;
+        writerCells->append(cell);
+      }
+    }
+    // Increase counter
+    meas.measurement_id += 1;
   }
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -101,7 +101,7 @@ Measurement readMeasurement(const edm4hep::TrackerHitPlane& from,
 /// Known issues:
 /// - cluster channels are written to inappropriate fields
 /// - local 2D coordinates and time are written to position
-void writeMeasurement(const Measurement& from,
+void writeMeasurement(const MeasurementContainer::ConstMeasurementProxy& from,
                       edm4hep::MutableTrackerHitPlane to,
                       const Cluster* fromCluster,
                       edm4hep::TrackerHitCollection& toClusters,
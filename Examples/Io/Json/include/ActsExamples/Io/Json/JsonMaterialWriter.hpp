@@ -43,11 +43,16 @@ using DetectorMaterialMaps = std::pair<SurfaceMaterialMap, VolumeMaterialMap>;
 
 namespace ActsExamples {
 
+/// Output formats of the json writers, can be combined
+///
+/// @note @c All only covers the plain text and the CBOR output, the
+///       MessagePack output has to be requested explicitly
 enum class JsonFormat : uint8_t {
   NoOutput = 0,
   Json = 1,
   Cbor = 2,
-  All = std::numeric_limits<uint8_t>::max()
+  MessagePack = 4,
+  All = Json | Cbor
 };
 
 ACTS_DEFINE_ENUM_BITWISE_OPERATORS(JsonFormat)
@@ -92,6 +97,11 @@ class JsonMaterialWriter : public IMaterialWriter {
  private:
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// Write the json document in all the configured formats
+  ///
+  /// @param jOut is the json document
+  void writeFiles(const nlohmann::json& jOut) const;
+
   /// The logger instance
   std::unique_ptr<const Acts::Logger> m_logger{nullptr};
 
@@ -8,11 +8,11 @@
 
 #include "ActsExamples/Io/Json/JsonMaterialWriter.hpp"
 
+#include "Acts/Plugins/Json/JsonFileHelper.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
-#include <fstream>
-#include <iomanip>
-#include <ios>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -32,19 +32,7 @@ void ActsExamples::JsonMaterialWriter::writeMaterial(
   // Evoke the converter
   auto jOut = m_converter->materialMapsToJson(detMaterial);
   // And write the file(s)
-  if (ACTS_CHECK_BIT(m_cfg.writeFormat, ActsExamples::JsonFormat::Json)) {
-    std::string fileName = m_cfg.fileName + ".json";
-    ACTS_VERBOSE("Writing to file: " << fileName);
-    std::ofstream ofj(fileName);
-    ofj << std::setw(4) << jOut << std::endl;
-  }
-  if (ACTS_CHECK_BIT(m_cfg.writeFormat, ActsExamples::JsonFormat::Cbor)) {
-    std::vector<uint8_t> cborOut = nlohmann::json::to_cbor(jOut);
-    std::string fileName = m_cfg.fileName + ".cbor";
-    ACTS_VERBOSE("Writing to file: " << fileName);
-    std::ofstream ofj(fileName, std::ios::out | std::ios::binary);
-    ofj.write((char*)cborOut.data(), cborOut.size());
-  }
+  writeFiles(jOut);
 }
 
 void ActsExamples::JsonMaterialWriter::write(
@@ -52,14 +40,21 @@ void ActsExamples::JsonMaterialWriter::write(
   // Evoke the converter
   auto jOut = m_converter->trackingGeometryToJson(tGeometry);
   // And write the file(s)
-  if (ACTS_CHECK_BIT(m_cfg.writeFormat, ActsExamples::JsonFormat::Json)) {
-    std::ofstream ofj(m_cfg.fileName + ".json");
-    ofj << std::setw(4) << jOut << std::endl;
-  }
-  if (ACTS_CHECK_BIT(m_cfg.writeFormat, ActsExamples::JsonFormat::Cbor)) {
-    std::vector<uint8_t> cborOut = nlohmann::json::to_cbor(jOut);
-    std::ofstream ofj(m_cfg.fileName + ".cbor",
-                      std::ios::out | std::ios::binary);
-    ofj.write((char*)cborOut.data(), cborOut.size());
+  writeFiles(jOut);
+}
+
+void ActsExamples::JsonMaterialWriter::writeFiles(
+    const nlohmann::json& jOut) const {
+  // The file helper picks the format from the extension
+  const std::vector<std::pair<JsonFormat, std::string>> formats = {
+      {JsonFormat::Json, ".json"},
+      {JsonFormat::Cbor, ".cbor"},
+      {JsonFormat::MessagePack, ".msgpack"}};
+  for (const auto& [format, extension] : formats) {
+    if (ACTS_CHECK_BIT(m_cfg.writeFormat, format)) {
+      std::string fileName = m_cfg.fileName + extension;
+      ACTS_VERBOSE("Writing to file: " << fileName);
+      Acts::JsonFileHelper::write(jOut, fileName);
+    }
   }
 }
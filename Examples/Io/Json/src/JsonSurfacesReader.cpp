@@ -11,6 +11,7 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Plugins/Json/ActsJson.hpp"
 #include "Acts/Plugins/Json/GeometryHierarchyMapJsonConverter.hpp"
+#include "Acts/Plugins/Json/JsonFileHelper.hpp"
 #include "Acts/Plugins/Json/SurfaceJsonConverter.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
@@ -22,10 +23,7 @@ namespace ActsExamples {
 Acts::GeometryHierarchyMap<std::shared_ptr<Acts::Surface>>
 JsonSurfacesReader::read(const JsonSurfacesReader::Options& options) {
   // Read the json file into a json object
-  nlohmann::json j;
-  std::ifstream in(options.inputFile);
-  in >> j;
-  in.close();
+  nlohmann::json j = Acts::JsonFileHelper::read(options.inputFile);
 
   using SurfaceHierachyMap =
       Acts::GeometryHierarchyMap<std::shared_ptr<Acts::Surface>>;
@@ -61,7 +61,8 @@ void addDetector(Context& ctx) {
         .def_readwrite("surfaceLogLevel", &Config::surfaceLogLevel)
         .def_readwrite("layerLogLevel", &Config::layerLogLevel)
         .def_readwrite("volumeLogLevel", &Config::volumeLogLevel)
-        .def_readwrite("buildProto", &Config::buildProto);
+        .def_readwrite("buildProto", &Config::buildProto)
+        .def_readwrite("concurrentLayers", &Config::concurrentLayers);
   }
 
   {
@@ -40,7 +40,8 @@ void addExampleAlgorithms(Context& ctx) {
       imputParametrisationNuclearInteraction, randomNumbers, trackingGeometry,
       magneticField, pMin, emScattering, emEnergyLossIonisation,
       emEnergyLossRadiation, emPhotonConversion, generateHitsOnSensitive,
-      generateHitsOnMaterial, generateHitsOnPassive, averageHitsPerParticle);
+      generateHitsOnMaterial, generateHitsOnPassive, averageHitsPerParticle,
+      simulateConcurrently);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::ParticlesPrinter, mex,
                                 "ParticlesPrinter", inputParticles);
@@ -10,6 +10,7 @@
 #include "Acts/Detector/Detector.hpp"
 #include "Acts/Detector/ProtoDetector.hpp"
 #include "Acts/Plugins/Json/DetectorJsonConverter.hpp"
+#include "Acts/Plugins/Json/JsonFileHelper.hpp"
 #include "Acts/Plugins/Json/JsonMaterialDecorator.hpp"
 #include "Acts/Plugins/Json/MaterialMapJsonConverter.hpp"
 #include "Acts/Plugins/Json/ProtoDetectorJsonConverter.hpp"
@@ -86,6 +87,7 @@ void addJson(Context& ctx) {
         .value("NoOutput", JsonFormat::NoOutput)
         .value("Json", JsonFormat::Json)
         .value("Cbor", JsonFormat::Cbor)
+        .value("MessagePack", JsonFormat::MessagePack)
         .value("All", JsonFormat::All);
   }
 
@@ -141,12 +143,7 @@ void addJson(Context& ctx) {
   {
     py::class_<Acts::ProtoDetector>(mex, "ProtoDetector")
         .def(py::init<>([](std::string pathName) {
-          nlohmann::json jDetector;
-          auto in = std::ifstream(pathName, std::ifstream::in);
-          if (in.good()) {
-            in >> jDetector;
-            in.close();
-          }
+          nlohmann::json jDetector = Acts::JsonFileHelper::read(pathName);
           Acts::ProtoDetector pDetector = jDetector["detector"];
           return pDetector;
         }));
@@ -223,11 +220,9 @@ void addJson(Context& ctx) {
         "readDetectorFromJson",
         [](const Acts::GeometryContext& gctx,
            const std::string& fileName) -> auto{
-          auto in = std::ifstream(fileName,
-                                  std::ifstream::in | std::ifstream::binary);
-          nlohmann::json jDetectorIn;
-          in >> jDetectorIn;
-          in.close();
+          // The file format (text, CBOR, MessagePack, ...) is deduced from
+          // the file name
+          nlohmann::json jDetectorIn = Acts::JsonFileHelper::read(fileName);
 
           return Acts::DetectorJsonConverter::fromJson(gctx, jDetectorIn);
         });
@@ -29,17 +29,21 @@ void addOnnx(Context& ctx) {
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::AmbiguityResolutionMLAlgorithm,
                                 onnx, "AmbiguityResolutionMLAlgorithm",
                                 inputTracks, inputDuplicateNN, outputTracks,
-                                nMeasurementsMin);
+                                nMeasurementsMin, inferenceIntraOpThreads,
+                                inferenceInterOpThreads, coalesceInference);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(
       ActsExamples::AmbiguityResolutionMLDBScanAlgorithm, onnx,
       "AmbiguityResolutionMLDBScanAlgorithm", inputTracks, inputDuplicateNN,
-      outputTracks, nMeasurementsMin, epsilonDBScan, minPointsDBScan);
+      outputTracks, nMeasurementsMin, epsilonDBScan, minPointsDBScan,
+      inferenceIntraOpThreads, inferenceInterOpThreads, coalesceInference);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::SeedFilterMLAlgorithm, onnx,
                                 "SeedFilterMLAlgorithm", inputTrackParameters,
                                 inputSimSeeds, inputSeedFilterNN,
                                 outputTrackParameters, outputSimSeeds,
-                                epsilonDBScan, minPointsDBScan, minSeedScore);
+                                epsilonDBScan, minPointsDBScan, minSeedScore,
+                                inferenceIntraOpThreads,
+                                inferenceInterOpThreads, coalesceInference);
 }
 }  // namespace Acts::Python
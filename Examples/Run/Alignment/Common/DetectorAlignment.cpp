@@ -57,7 +57,8 @@ int runDetectorAlignment(
     int argc, char* argv[],
     const std::shared_ptr<ActsExamples::IBaseDetector>& detector,
     ActsAlignment::AlignedTransformUpdater alignedTransformUpdater,
-    const AlignedDetElementGetter& alignedDetElementsGetter) {
+    const AlignedDetElementGetter& alignedDetElementsGetter,
+    ActsAlignment::AlignedTransformsCommitter alignedTransformsCommitter) {
   // using boost::program_options::value;
 
   // setup and parse options
@@ -158,6 +159,8 @@ int runDetectorAlignment(
         particleSmearingCfg.outputTrackParameters;
     alignment.outputAlignmentParameters = "alignment-parameters";
     alignment.alignedTransformUpdater = std::move(alignedTransformUpdater);
+    alignment.alignedTransformsCommitter =
+        std::move(alignedTransformsCommitter);
     std::string path = vm["alignment-geo-config-file"].as<std::string>();
     if (not path.empty()) {
       alignment.alignedDetElements = alignedDetElementsGetter(
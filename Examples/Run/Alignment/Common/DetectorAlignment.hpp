@@ -34,8 +34,13 @@ void addAlignmentOptions(ActsExamples::Options::Description& desc);
 /// @param argc number of command line arguments
 /// @param argv command line arguments
 /// @param detector is the detector to be aligned
+/// @param alignedTransformUpdater updates the aligned transform of an element
+/// @param alignedDetElementsGetter selects the elements to be aligned
+/// @param alignedTransformsCommitter commits the updates of an iteration
 int runDetectorAlignment(
     int argc, char* argv[],
     const std::shared_ptr<ActsExamples::IBaseDetector>& detector,
     ActsAlignment::AlignedTransformUpdater alignedTransformUpdater,
-    const AlignedDetElementGetter& alignedDetElementsGetter);
+    const AlignedDetElementGetter& alignedDetElementsGetter,
+    ActsAlignment::AlignedTransformsCommitter alignedTransformsCommitter =
+        nullptr);
@@ -21,17 +21,21 @@ int main(int argc, char* argv[]) {
             ActsExamples::Contextual::InternallyAlignedDetectorElement*>(
             detElement);
         assert(alignedDetElement != nullptr && "Got wrong detector element");
-        auto alignContext =
-            gctx.get<ActsExamples::Contextual::
-                         InternallyAlignedDetectorElement::ContextType>();
         if (alignedDetElement != nullptr) {
-          alignedDetElement->addAlignedTransform(aTransform, alignContext.iov);
+          alignedDetElement->addAlignedTransform(gctx, aTransform);
           return true;
         }
         return false;
       };
 
-  // 2. Selector for the detector elements to be aligned
+  // 2. Publish the updated transforms once per alignment iteration
+  ActsAlignment::AlignedTransformsCommitter alignedTransformsCommitter =
+      [](const Acts::GeometryContext& gctx) {
+        ActsExamples::Contextual::InternallyAlignedDetectorElement::
+            commitAlignedTransforms(gctx);
+      };
+
+  // 3. Selector for the detector elements to be aligned
   // @todo: allow different levels of alignment
   auto alignedDetElementsGetter =
       [](const std::shared_ptr<ActsExamples::IBaseDetector>& detector,
@@ -58,5 +62,6 @@ int main(int argc, char* argv[]) {
 
   return runDetectorAlignment(
       argc, argv, std::make_shared<ActsExamples::AlignedDetectorWithOptions>(),
-      alignedTransformUpdater, alignedDetElementsGetter);
+      alignedTransformUpdater, alignedDetElementsGetter,
+      alignedTransformsCommitter);
 }
@@ -27,9 +27,25 @@ namespace Options {
 void addNuclearInteractionOptions(Description& desc);
 
 /// Reads the parametrisation and provides the parametrisation
+///
+/// Files with the extension `.bin` are read in the compact binary format
+/// written by `writeBinaryParametrisations`, all others are read from ROOT.
 ActsFatras::detail::MultiParticleNuclearInteractionParametrisation
 readParametrisations(const std::string& fileName);
 
+/// Writes the parametrisation in a compact binary format
+///
+/// The binary format does not require ROOT and is much faster to read. The
+/// `ActsConvertNuclearInteractionParametrisation` tool converts a ROOT
+/// parametrisation with this function.
+///
+/// @param [in] fileName The output file name
+/// @param [in] mpp The parametrisation to write
+void writeBinaryParametrisations(
+    const std::string& fileName,
+    const ActsFatras::detail::MultiParticleNuclearInteractionParametrisation&
+        mpp);
+
 /// Read Fatras options to create the algorithm config.
 ///
 /// @param variables the variables to read from
@@ -9,7 +9,11 @@
 #include "ActsExamples/Options/NuclearInteractionOptions.hpp"
 
 #include "ActsExamples/Utilities/Options.hpp"
+#include "ActsFatras/Physics/NuclearInteraction/NuclearInteractionParametersIo.hpp"
 
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
 #include <string>
 
 #include <TFile.h>
@@ -58,10 +62,10 @@ void readKinematicParameters(
     const char* distributionName = folder->GetName();
     unsigned int mult = std::stoi(distributionName);
     gDirectory->cd(distributionName);
-    std::vector<std::pair<std::vector<float>, std::vector<uint32_t>>>
+    ActsFatras::detail::NuclearInteractionParameters::Distributions
         momentumDistributions;
     momentumDistributions.resize(mult + 1);
-    std::vector<std::pair<std::vector<float>, std::vector<uint32_t>>>
+    ActsFatras::detail::NuclearInteractionParameters::Distributions
         invariantMassDistributions;
     invariantMassDistributions.resize(mult);
     for (unsigned int i = 0; i < mult; i++) {
@@ -117,6 +121,13 @@ void readKinematicParameters(
     gDirectory->cd("..");
   }
 }
+
+bool isBinaryFile(const std::string& fileName) {
+  const std::string extension = ".bin";
+  return fileName.size() >= extension.size() &&
+         fileName.compare(fileName.size() - extension.size(),
+                          extension.size(), extension) == 0;
+}
 }  // namespace
 
 void ActsExamples::Options::addNuclearInteractionOptions(
@@ -137,6 +148,15 @@ std::string ActsExamples::Options::readNuclearInteractionConfig(
 
 ActsFatras::detail::MultiParticleNuclearInteractionParametrisation
 ActsExamples::Options::readParametrisations(const std::string& fileName) {
+  if (isBinaryFile(fileName)) {
+    std::ifstream is(fileName, std::ios::binary);
+    if (!is) {
+      throw std::runtime_error("Could not open nuclear interaction file " +
+                               fileName);
+    }
+    return ActsFatras::detail::readBinaryParametrisation(is);
+  }
+
   // The collection
   ActsFatras::detail::MultiParticleNuclearInteractionParametrisation mpp;
 
@@ -237,3 +257,15 @@ ActsExamples::Options::readParametrisations(const std::string& fileName) {
   // Return success flag
   return mpp;
 }
+
+void ActsExamples::Options::writeBinaryParametrisations(
+    const std::string& fileName,
+    const ActsFatras::detail::MultiParticleNuclearInteractionParametrisation&
+        mpp) {
+  std::ofstream os(fileName, std::ios::binary);
+  if (!os) {
+    throw std::runtime_error("Could not open nuclear interaction file " +
+                             fileName);
+  }
+  ActsFatras::detail::writeBinaryParametrisation(os, mpp);
+}
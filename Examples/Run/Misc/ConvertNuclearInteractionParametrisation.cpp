@@ -0,0 +1,52 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @brief convert a nuclear interaction parametrisation to the binary format
+
+#include "ActsExamples/Options/NuclearInteractionOptions.hpp"
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+
+int main(int argc, char const* argv[]) {
+  // handle input arguments
+  if (argc != 3) {
+    std::cerr << "usage: " << argv[0] << " input output\n";
+    std::cerr << "\n";
+    std::cerr << "convert a nuclear interaction parametrisation to the\n";
+    std::cerr << "compact binary format read by the Fatras simulation.\n";
+    std::cerr << "\n";
+    std::cerr << "parameters:\n";
+    std::cerr << "  input: ROOT file with the parametrisation\n";
+    std::cerr << "  output: binary output file, with the extension .bin\n";
+    return EXIT_FAILURE;
+  }
+  const std::string input = argv[1];
+  const std::string output = argv[2];
+
+  try {
+    const auto mpp = ActsExamples::Options::readParametrisations(input);
+    ActsExamples::Options::writeBinaryParametrisations(output, mpp);
+
+    // read the output back to make sure it can be used
+    const auto check = ActsExamples::Options::readParametrisations(output);
+    if (check.size() != mpp.size()) {
+      std::cerr << "inconsistent output in " << output << "\n";
+      return EXIT_FAILURE;
+    }
+    std::cout << "converted the parametrisation of " << mpp.size()
+              << " particles from " << input << " to " << output << "\n";
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
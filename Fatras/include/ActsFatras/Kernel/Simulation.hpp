@@ -19,6 +19,7 @@
 #include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/TypeTraits.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 #include "ActsFatras/Kernel/SimulationResult.hpp"
@@ -27,8 +28,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <iterator>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace ActsFatras {
@@ -76,6 +79,33 @@ struct SingleParticleSimulation {
       const Acts::GeometryContext &geoCtx,
       const Acts::MagneticFieldContext &magCtx, generator_t &generator,
       const Particle &particle) const {
+    SimulationResult result;
+    auto ret = simulate(geoCtx, magCtx, generator, particle, result);
+    if (!ret.ok()) {
+      return ret.error();
+    }
+    return std::move(result);
+  }
+
+  /// Simulate a single particle without secondaries into an existing result.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param generator is the random number generator
+  /// @param particle is the initial particle state
+  /// @param result is overwritten with the simulated particle state, hits,
+  ///        and generated particles
+  ///
+  /// The containers of the given result are cleared and then filled during
+  /// the simulation. Their allocated memory is retained, i.e. reusing the
+  /// same result object for many particles avoids repeated allocations.
+  template <typename generator_t>
+  Acts::Result<void> simulate(const Acts::GeometryContext &geoCtx,
+                              const Acts::MagneticFieldContext &magCtx,
+                              generator_t &generator, const Particle &particle,
+                              SimulationResult &result) const {
     // propagator-related additional types
     using Actor = detail::SimulationActor<generator_t, decay_t, interactions_t,
                                           hit_surface_selector_t>;
@@ -97,23 +127,25 @@ struct SingleParticleSimulation {
     actor.selectHitSurface = selectHitSurface;
     actor.initialParticle = particle;
 
-    if (particle.hasReferenceSurface()) {
-      auto result = propagator.propagate(
-          particle.boundParameters(geoCtx).value(), options);
-      if (!result.ok()) {
-        return result.error();
-      }
-      auto &value = result.value().template get<Result>();
-      return std::move(value);
-    }
+    auto propagate = [&](const auto &parameters) {
+      auto state = propagator.makeState(parameters, options);
+      // hand the output buffers to the actor result inside the propagator
+      // state and take them back afterwards. this only moves the buffers.
+      auto &stateResult = state.template get<Result>();
+      stateResult.generatedParticles = std::move(result.generatedParticles);
+      stateResult.generatedParticles.clear();
+      stateResult.hits = std::move(result.hits);
+      stateResult.hits.clear();
+
+      auto ret = propagator.propagate(state);
+      result = std::move(stateResult);
+      return ret;
+    };
 
-    auto result =
-        propagator.propagate(particle.curvilinearParameters(), options);
-    if (!result.ok()) {
-      return result.error();
+    if (particle.hasReferenceSurface()) {
+      return propagate(particle.boundParameters(geoCtx).value());
     }
-    auto &value = result.value().template get<Result>();
-    return std::move(value);
+    return propagate(particle.curvilinearParameters());
   }
 };
 
@@ -199,9 +231,13 @@ struct Simulation {
         (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) &&
         "Inconsistent initial sizes of the simulated particle containers");
 
-    using SingleParticleSimulationResult = Acts::Result<SimulationResult>;
-
     std::vector<FailedParticle> failedParticles;
+    // reused for all particles to avoid per-particle allocations
+    SimulationResult buffer;
+    // every input particle ends up in the outputs at most once, only the
+    // secondaries can grow the containers further
+    reserveAdditional(simulatedParticlesInitial, inputParticles.size());
+    reserveAdditional(simulatedParticlesFinal, inputParticles.size());
 
     for (const Particle &inputParticle : inputParticles) {
       // only consider simulatable particles
@@ -214,48 +250,9 @@ struct Simulation {
         return detail::SimulationError::eInvalidInputParticleId;
       }
 
-      // Do a *depth-first* simulation of the particle and its secondaries,
-      // i.e. we simulate all secondaries, tertiaries, ... before simulating
-      // the next primary particle. Use the end of the output container as
-      // a queue to store particles that should be simulated.
-      //
-      // WARNING the initial particle state output container will be modified
-      //         during iteration. New secondaries are added to and failed
-      //         particles might be removed. To avoid issues, access must always
-      //         occur via indices.
-      auto iinitial = simulatedParticlesInitial.size();
-      simulatedParticlesInitial.push_back(inputParticle);
-      for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
-        const auto &initialParticle = simulatedParticlesInitial[iinitial];
-
-        // only simulatable particles are pushed to the container and here we
-        // only need to switch between charged/neutral.
-        SingleParticleSimulationResult result =
-            SingleParticleSimulationResult::success({});
-        if (initialParticle.charge() != Particle::Scalar(0)) {
-          result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
-        } else {
-          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
-        }
-
-        if (!result.ok()) {
-          // remove particle from output container since it was not simulated.
-          simulatedParticlesInitial.erase(
-              std::next(simulatedParticlesInitial.begin(), iinitial));
-          // record the particle as failed
-          failedParticles.push_back({initialParticle, result.error()});
-          continue;
-        }
-
-        copyOutputs(result.value(), simulatedParticlesInitial,
-                    simulatedParticlesFinal, hits);
-        // since physics processes are independent, there can be particle id
-        // collisions within the generated secondaries. they can be resolved by
-        // renumbering within each sub-particle generation. this must happen
-        // before the particle is simulated since the particle id is used to
-        // associate generated hits back to the particle.
-        renumberTailParticleIds(simulatedParticlesInitial, iinitial);
-      }
+      simulateParticleTree(geoCtx, magCtx, generator, inputParticle,
+                           simulatedParticlesInitial, simulatedParticlesFinal,
+                           hits, failedParticles, buffer);
     }
 
     // the overall function call succeeded, i.e. no fatal errors occured.
@@ -265,7 +262,196 @@ struct Simulation {
     return failedParticles;
   }
 
+  /// Simulate multiple particles and generated secondaries concurrently.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param makeGenerator creates the random number generator for a primary
+  /// @param execute runs the simulation of all primaries
+  /// @param inputParticles contains all particles that should be simulated
+  /// @param simulatedParticlesInitial contains initial particle states
+  /// @param simulatedParticlesFinal contains final particle states
+  /// @param hits contains all generated hits
+  /// @retval Acts::Result::Error if there is a fundamental issue
+  /// @retval Acts::Result::Success with all particles that failed to simulate
+  ///
+  /// Same as the regular `simulate` but each selected input particle and its
+  /// secondaries are simulated independently with a dedicated random number
+  /// generator created via `makeGenerator(const Particle &)`. The simulation
+  /// of the individual primaries is dispatched via
+  /// `execute(std::size_t nPrimaries, body)` which must call `body(i)` exactly
+  /// once for each index `i < nPrimaries`, possibly concurrently. The outputs
+  /// are concatenated in input order afterwards.
+  ///
+  /// If the generators are derived only from the particle, e.g. by seeding
+  /// from the particle barcode, the outputs are reproducible independent of
+  /// the execution order and the number of threads used by the executor.
+  ///
+  /// @note Secondary particle ids only depend on the primary particle id, so
+  ///       no additional renumbering is required when concatenating as long
+  ///       as the input particle ids are unique.
+  ///
+  /// @tparam generator_factory_t is the type of the generator factory
+  /// @tparam executor_t is the type of the executor
+  /// @tparam input_particles_t is a Container for particles
+  /// @tparam output_particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  template <typename generator_factory_t, typename executor_t,
+            typename input_particles_t, typename output_particles_t,
+            typename hits_t>
+  Acts::Result<std::vector<FailedParticle>> simulateConcurrently(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx,
+      const generator_factory_t &makeGenerator, const executor_t &execute,
+      const input_particles_t &inputParticles,
+      output_particles_t &simulatedParticlesInitial,
+      output_particles_t &simulatedParticlesFinal, hits_t &hits) const {
+    assert(
+        (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) &&
+        "Inconsistent initial sizes of the simulated particle containers");
+
+    std::vector<const Particle *> primaries;
+    for (const Particle &inputParticle : inputParticles) {
+      // only consider simulatable particles
+      if (!selectParticle(inputParticle)) {
+        continue;
+      }
+      // required to allow correct particle id numbering for secondaries later
+      if ((inputParticle.particleId().generation() != 0u) ||
+          (inputParticle.particleId().subParticle() != 0u)) {
+        return detail::SimulationError::eInvalidInputParticleId;
+      }
+      primaries.push_back(&inputParticle);
+    }
+
+    // each primary writes to its own output buffers to avoid synchronization
+    struct PrimaryOutput {
+      std::vector<Particle> particlesInitial;
+      std::vector<Particle> particlesFinal;
+      std::vector<Hit> hits;
+      std::vector<FailedParticle> failedParticles;
+    };
+    std::vector<PrimaryOutput> outputs(primaries.size());
+
+    execute(primaries.size(), [&](std::size_t i) {
+      auto generator = makeGenerator(*primaries[i]);
+      auto &output = outputs[i];
+      SimulationResult buffer;
+      simulateParticleTree(geoCtx, magCtx, generator, *primaries[i],
+                           output.particlesInitial, output.particlesFinal,
+                           output.hits, output.failedParticles, buffer);
+    });
+
+    // the output sizes are known now, fill the containers without regrowing
+    std::size_t nParticles = 0;
+    std::size_t nHits = 0;
+    for (const auto &output : outputs) {
+      nParticles += output.particlesInitial.size();
+      nHits += output.hits.size();
+    }
+    reserveAdditional(simulatedParticlesInitial, nParticles);
+    reserveAdditional(simulatedParticlesFinal, nParticles);
+    reserveAdditional(hits, nHits);
+
+    std::vector<FailedParticle> failedParticles;
+    for (auto &output : outputs) {
+      std::move(output.particlesInitial.begin(), output.particlesInitial.end(),
+                std::back_inserter(simulatedParticlesInitial));
+      std::move(output.particlesFinal.begin(), output.particlesFinal.end(),
+                std::back_inserter(simulatedParticlesFinal));
+      std::move(output.hits.begin(), output.hits.end(),
+                std::back_inserter(hits));
+      std::move(output.failedParticles.begin(), output.failedParticles.end(),
+                std::back_inserter(failedParticles));
+    }
+
+    return failedParticles;
+  }
+
  private:
+  /// Simulate a single input particle and all its secondaries.
+  ///
+  /// The single particle results are stored in the given buffer which is
+  /// reused for all particles of the tree.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  /// @tparam particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  template <typename generator_t, typename particles_t, typename hits_t>
+  void simulateParticleTree(const Acts::GeometryContext &geoCtx,
+                            const Acts::MagneticFieldContext &magCtx,
+                            generator_t &generator,
+                            const Particle &inputParticle,
+                            particles_t &simulatedParticlesInitial,
+                            particles_t &simulatedParticlesFinal, hits_t &hits,
+                            std::vector<FailedParticle> &failedParticles,
+                            SimulationResult &buffer) const {
+    // Do a *depth-first* simulation of the particle and its secondaries,
+    // i.e. we simulate all secondaries, tertiaries, ... before simulating
+    // the next primary particle. Use the end of the output container as
+    // a queue to store particles that should be simulated.
+    //
+    // WARNING the initial particle state output container will be modified
+    //         during iteration. New secondaries are added to and failed
+    //         particles might be removed. To avoid issues, access must always
+    //         occur via indices.
+    auto iinitial = simulatedParticlesInitial.size();
+    simulatedParticlesInitial.push_back(inputParticle);
+    for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
+      const auto &initialParticle = simulatedParticlesInitial[iinitial];
+
+      // only simulatable particles are pushed to the container and here we
+      // only need to switch between charged/neutral.
+      Acts::Result<void> result = Acts::Result<void>::success();
+      if (initialParticle.charge() != Particle::Scalar(0)) {
+        result = charged.simulate(geoCtx, magCtx, generator, initialParticle,
+                                  buffer);
+      } else {
+        result = neutral.simulate(geoCtx, magCtx, generator, initialParticle,
+                                  buffer);
+      }
+
+      if (!result.ok()) {
+        // remove particle from output container since it was not simulated.
+        simulatedParticlesInitial.erase(
+            std::next(simulatedParticlesInitial.begin(), iinitial));
+        // record the particle as failed
+        failedParticles.push_back({initialParticle, result.error()});
+        continue;
+      }
+
+      copyOutputs(buffer, simulatedParticlesInitial, simulatedParticlesFinal,
+                  hits);
+      // since physics processes are independent, there can be particle id
+      // collisions within the generated secondaries. they can be resolved by
+      // renumbering within each sub-particle generation. this must happen
+      // before the particle is simulated since the particle id is used to
+      // associate generated hits back to the particle.
+      renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+    }
+  }
+
+  template <typename container_t>
+  using ReserveMethod =
+      decltype(std::declval<container_t &>().reserve(std::size_t{}));
+
+  /// Reserve space for additional elements if the container supports it.
+  ///
+  /// The capacity is at least doubled when growing, so repeated calls with
+  /// the same containers do not reallocate for every call.
+  ///
+  /// @tparam container_t is a SequenceContainer
+  template <typename container_t>
+  static void reserveAdditional(container_t &container, std::size_t n) {
+    if constexpr (Acts::Concepts::exists<ReserveMethod, container_t>) {
+      const std::size_t required = container.size() + n;
+      if (container.capacity() < required) {
+        container.reserve(std::max<std::size_t>(required,
+                                                2 * container.capacity()));
+      }
+    }
+  }
+
   /// Select if the particle should be simulated at all.
   bool selectParticle(const Particle &particle) const {
     if (particle.charge() != Particle::Scalar(0)) {
@@ -8,17 +8,58 @@
 
 #pragma once
 
+#include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Common.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace ActsFatras {
 namespace detail {
 
+/// @brief Cumulative distribution with a guide table for fast inverse sampling
+///
+/// The guide table divides the range of the cumulative values, up to the
+/// last bin content, into one interval per bin and stores for each interval
+/// the first bin that could contain a value of the interval. The bin search
+/// thus starts close to the target bin and needs O(1) steps on average
+/// instead of a binary search, also for distributions which are not
+/// normalised. The result is identical to @c std::upper_bound on the
+/// cumulative values.
+struct CumulativeDistribution {
+  /// Histogram representation as (bin borders, cumulative bin contents)
+  using Histogram = std::pair<std::vector<float>, std::vector<uint32_t>>;
+
+  /// Bin borders
+  std::vector<float> binBorders;
+  /// Cumulative bin contents scaled to the range of uint32_t
+  std::vector<uint32_t> binContents;
+  /// First bin for each interval of the cumulative values
+  std::vector<uint32_t> guide;
+
+  CumulativeDistribution() = default;
+
+  /// Construct from a decomposed histogram and build the guide table
+  ///
+  /// @param histogram The bin borders and cumulative bin contents
+  CumulativeDistribution(Histogram histogram);
+
+  /// Test whether the distribution has any content
+  bool empty() const { return binContents.empty(); }
+
+  /// Find the first bin with a cumulative content larger than a value
+  ///
+  /// @param [in] value The cumulative value
+  ///
+  /// @return The bin index, equal to the number of bins if there is none
+  std::size_t findBin(uint32_t value) const;
+};
+
 /// @brief Data storage of the parametrized nuclear interaction
 struct NuclearInteractionParameters {
-  using CumulativeDistribution =
-      std::pair<std::vector<float>, std::vector<uint32_t>>;
+  using CumulativeDistribution = detail::CumulativeDistribution;
   using Distributions = std::vector<CumulativeDistribution>;
   using PdgMap =
       std::vector<std::pair<int, std::vector<std::pair<int, float>>>>;
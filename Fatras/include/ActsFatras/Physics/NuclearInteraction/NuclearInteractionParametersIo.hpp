@@ -0,0 +1,43 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsFatras/Physics/NuclearInteraction/NuclearInteractionParameters.hpp"
+
+#include <iosfwd>
+
+namespace ActsFatras {
+namespace detail {
+
+/// Write the parametrisation in a compact binary format
+///
+/// The format does not need ROOT and is much faster to read than the
+/// decomposed ROOT histograms. The values are stored with the native byte
+/// order, field by field without padding.
+///
+/// @param [in, out] os The output stream, opened in binary mode
+/// @param [in] mpp The parametrisation to write
+void writeBinaryParametrisation(
+    std::ostream& os,
+    const MultiParticleNuclearInteractionParametrisation& mpp);
+
+/// Read a parametrisation written by @c writeBinaryParametrisation
+///
+/// The stream must be seekable. All element counts are checked against the
+/// remaining size of the stream before anything is allocated.
+///
+/// @param [in, out] is The input stream, opened in binary mode
+///
+/// @return The parametrisation, with the guide tables of all distributions
+/// @throw std::runtime_error if the input is not a valid parametrisation
+MultiParticleNuclearInteractionParametrisation readBinaryParametrisation(
+    std::istream& is);
+
+}  // namespace detail
+}  // namespace ActsFatras
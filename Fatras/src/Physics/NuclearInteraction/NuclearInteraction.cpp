@@ -17,6 +17,50 @@
 
 namespace ActsFatras {
 
+namespace detail {
+
+CumulativeDistribution::CumulativeDistribution(Histogram histogram)
+    : binBorders(std::move(histogram.first)),
+      binContents(std::move(histogram.second)) {
+  if (binContents.empty()) {
+    return;
+  }
+
+  // the intervals cover [0, back] so that distributions which are not
+  // normalised, like the interaction probability, use all of them. the
+  // smallest cumulative value of interval k is ceil(k * (back + 1) / n)
+  const std::uint64_t range = std::uint64_t{binContents.back()} + 1;
+  const std::uint64_t nIntervals = binContents.size();
+  guide.resize(nIntervals);
+  for (std::uint64_t k = 0; k < nIntervals; ++k) {
+    const std::uint64_t lowest = (k * range + nIntervals - 1) / nIntervals;
+    const auto it =
+        std::upper_bound(binContents.begin(), binContents.end(), lowest);
+    guide[k] = static_cast<uint32_t>(std::distance(binContents.begin(), it));
+  }
+}
+
+std::size_t CumulativeDistribution::findBin(uint32_t value) const {
+  const std::size_t nBins = binContents.size();
+  if (nBins == 0 || value >= binContents.back()) {
+    return nBins;
+  }
+  if (guide.size() != nBins) {
+    // the bin contents were set without building the guide table
+    return std::distance(
+        binContents.begin(),
+        std::upper_bound(binContents.begin(), binContents.end(), value));
+  }
+  const std::uint64_t range = std::uint64_t{binContents.back()} + 1;
+  std::size_t iBin = guide[static_cast<std::uint64_t>(value) * nBins / range];
+  while (binContents[iBin] <= value) {
+    ++iBin;
+  }
+  return iBin;
+}
+
+}  // namespace detail
+
 const detail::NuclearInteractionParameters& NuclearInteraction::findParameters(
     double rnd,
     const detail::NuclearInteractionParametrisation& parametrisation,
@@ -50,20 +94,17 @@ unsigned int NuclearInteraction::sampleDiscreteValues(
     const detail::NuclearInteractionParameters::CumulativeDistribution&
         distribution) const {
   // Fast exit
-  if (distribution.second.empty()) {
+  if (distribution.empty()) {
     return 0;
   }
 
   // Find the bin
   const uint32_t int_rnd = static_cast<uint32_t>(UINT32_MAX * rnd);
-  const auto it = std::upper_bound(distribution.second.begin(),
-                                   distribution.second.end(), int_rnd);
-  std::size_t iBin =
-      std::min((std::size_t)std::distance(distribution.second.begin(), it),
-               distribution.second.size() - 1);
+  std::size_t iBin = std::min(distribution.findBin(int_rnd),
+                              distribution.binContents.size() - 1);
 
   // Return the corresponding bin
-  return static_cast<unsigned int>(distribution.first[iBin]);
+  return static_cast<unsigned int>(distribution.binBorders[iBin]);
 }
 
 Particle::Scalar NuclearInteraction::sampleContinuousValues(
@@ -72,32 +113,32 @@ Particle::Scalar NuclearInteraction::sampleContinuousValues(
         distribution,
     bool interpolate) const {
   // Fast exit
-  if (distribution.second.empty()) {
+  if (distribution.empty()) {
     return std::numeric_limits<Scalar>::infinity();
   }
 
+  const auto& binBorders = distribution.binBorders;
+  const auto& binContents = distribution.binContents;
+
   // Find the bin
   const uint32_t int_rnd = static_cast<uint32_t>(UINT32_MAX * rnd);
   // Fast exit for non-normalised CDFs like interaction probabiltiy
-  if (int_rnd > distribution.second.back()) {
+  if (int_rnd > binContents.back()) {
     return std::numeric_limits<Scalar>::infinity();
   }
-  const auto it = std::upper_bound(distribution.second.begin(),
-                                   distribution.second.end(), int_rnd);
   std::size_t iBin =
-      std::min((std::size_t)std::distance(distribution.second.begin(), it),
-               distribution.second.size() - 1);
+      std::min(distribution.findBin(int_rnd), binContents.size() - 1);
 
   if (interpolate) {
     // Interpolate between neighbouring bins and return a diced intermediate
     // value
-    const uint32_t basecont = (iBin > 0 ? distribution.second[iBin - 1] : 0);
-    const uint32_t dcont = distribution.second[iBin] - basecont;
-    return distribution.first[iBin] +
-           (distribution.first[iBin + 1] - distribution.first[iBin]) *
-               (dcont > 0 ? (int_rnd - basecont) / dcont : 0.5);
+    const uint32_t basecont = (iBin > 0 ? binContents[iBin - 1] : 0);
+    const uint32_t dcont = binContents[iBin] - basecont;
+    return binBorders[iBin] + (binBorders[iBin + 1] - binBorders[iBin]) *
+                                  (dcont > 0 ? (int_rnd - basecont) / dcont
+                                             : 0.5);
   } else {
-    return distribution.first[iBin];
+    return binBorders[iBin];
   }
 }
 
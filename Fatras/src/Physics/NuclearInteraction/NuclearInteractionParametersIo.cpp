@@ -0,0 +1,300 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsFatras/Physics/NuclearInteraction/NuclearInteractionParametersIo.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using ActsFatras::detail::CumulativeDistribution;
+using ActsFatras::detail::MultiParticleNuclearInteractionParametrisation;
+using ActsFatras::detail::NuclearInteractionParameters;
+using ParametersWithFixedMultiplicity =
+    NuclearInteractionParameters::ParametersWithFixedMultiplicity;
+
+/// Identifier of the binary parametrisation format
+constexpr char s_binaryMagic[8] = {'A', 'C', 'T', 'S', 'N', 'I', '0', '1'};
+
+// The smallest encoded size of the elements of the counted collections, used
+// to reject counts which do not fit into the remaining input
+constexpr std::uint64_t s_countSize = sizeof(std::uint64_t);
+constexpr std::uint64_t s_distributionSize = 2 * s_countSize;
+constexpr std::uint64_t s_kinematicSize = 1 + 10 * s_countSize;
+
+class Writer {
+ public:
+  explicit Writer(std::ostream& os) : m_os(os) {}
+
+  template <typename T>
+  void value(const T& value) {
+    m_os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  void array(const std::vector<T>& values) {
+    value<std::uint64_t>(values.size());
+    m_os.write(reinterpret_cast<const char*>(values.data()),
+               values.size() * sizeof(T));
+  }
+
+  void vector(const Acts::ActsDynamicVector& vector) {
+    value<std::uint64_t>(vector.size());
+    m_os.write(reinterpret_cast<const char*>(vector.data()),
+               vector.size() * sizeof(Acts::ActsScalar));
+  }
+
+  void matrix(const Acts::ActsDynamicMatrix& matrix) {
+    value<std::uint64_t>(matrix.rows());
+    value<std::uint64_t>(matrix.cols());
+    m_os.write(reinterpret_cast<const char*>(matrix.data()),
+               matrix.size() * sizeof(Acts::ActsScalar));
+  }
+
+  void distribution(const CumulativeDistribution& distribution) {
+    array(distribution.binBorders);
+    array(distribution.binContents);
+  }
+
+  void kinematics(
+      const std::vector<ParametersWithFixedMultiplicity>& parameters) {
+    value<std::uint64_t>(parameters.size());
+    for (const auto& p : parameters) {
+      value<std::uint8_t>(p.validParametrisation ? 1 : 0);
+      value<std::uint64_t>(p.momentumDistributions.size());
+      for (const auto& d : p.momentumDistributions) {
+        distribution(d);
+      }
+      vector(p.eigenvaluesMomentum);
+      matrix(p.eigenvectorsMomentum);
+      vector(p.meanMomentum);
+      value<std::uint64_t>(p.invariantMassDistributions.size());
+      for (const auto& d : p.invariantMassDistributions) {
+        distribution(d);
+      }
+      vector(p.eigenvaluesInvariantMass);
+      matrix(p.eigenvectorsInvariantMass);
+      vector(p.meanInvariantMass);
+    }
+  }
+
+ private:
+  std::ostream& m_os;
+};
+
+class Reader {
+ public:
+  explicit Reader(std::istream& is) : m_is(is) {
+    const auto begin = m_is.tellg();
+    m_is.seekg(0, std::ios::end);
+    const auto end = m_is.tellg();
+    m_is.seekg(begin);
+    if (!m_is || begin < 0 || end < begin) {
+      throw std::runtime_error("Nuclear interaction input is not seekable");
+    }
+    m_remaining = static_cast<std::uint64_t>(end - begin);
+  }
+
+  template <typename T>
+  T value() {
+    T value{};
+    bytes(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+
+  /// Read a count of elements which take at least @p elementSize bytes each
+  std::uint64_t count(std::uint64_t elementSize) {
+    const auto n = value<std::uint64_t>();
+    if (n > m_remaining / elementSize) {
+      throw std::runtime_error(
+          "Corrupt nuclear interaction input: count exceeds the input size");
+    }
+    return n;
+  }
+
+  template <typename T>
+  std::vector<T> array() {
+    std::vector<T> values(count(sizeof(T)));
+    bytes(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+    return values;
+  }
+
+  Acts::ActsDynamicVector vector() {
+    Acts::ActsDynamicVector vector(count(sizeof(Acts::ActsScalar)));
+    bytes(reinterpret_cast<char*>(vector.data()),
+          vector.size() * sizeof(Acts::ActsScalar));
+    return vector;
+  }
+
+  Acts::ActsDynamicMatrix matrix() {
+    const auto rows = value<std::uint64_t>();
+    const auto cols = value<std::uint64_t>();
+    if (cols != 0 && rows > m_remaining / sizeof(Acts::ActsScalar) / cols) {
+      throw std::runtime_error(
+          "Corrupt nuclear interaction input: matrix exceeds the input size");
+    }
+    Acts::ActsDynamicMatrix matrix(rows, cols);
+    bytes(reinterpret_cast<char*>(matrix.data()),
+          matrix.size() * sizeof(Acts::ActsScalar));
+    return matrix;
+  }
+
+  CumulativeDistribution distribution() {
+    auto binBorders = array<float>();
+    auto binContents = array<std::uint32_t>();
+    // the interpolation reads the upper border of every bin
+    if (!binContents.empty() && binBorders.size() != binContents.size() + 1) {
+      throw std::runtime_error(
+          "Corrupt nuclear interaction input: bin borders do not match the "
+          "bin contents");
+    }
+    return {std::make_pair(std::move(binBorders), std::move(binContents))};
+  }
+
+  NuclearInteractionParameters::Distributions distributions() {
+    NuclearInteractionParameters::Distributions distributions(
+        count(s_distributionSize));
+    for (auto& d : distributions) {
+      d = distribution();
+    }
+    return distributions;
+  }
+
+  std::vector<ParametersWithFixedMultiplicity> kinematics() {
+    std::vector<ParametersWithFixedMultiplicity> parameters(
+        count(s_kinematicSize));
+    for (auto& p : parameters) {
+      p.validParametrisation = value<std::uint8_t>() != 0;
+      p.momentumDistributions = distributions();
+      p.eigenvaluesMomentum = vector();
+      p.eigenvectorsMomentum = matrix();
+      p.meanMomentum = vector();
+      p.invariantMassDistributions = distributions();
+      p.eigenvaluesInvariantMass = vector();
+      p.eigenvectorsInvariantMass = matrix();
+      p.meanInvariantMass = vector();
+    }
+    return parameters;
+  }
+
+  bool atEnd() const { return m_remaining == 0; }
+
+ private:
+  void bytes(char* data, std::uint64_t size) {
+    if (size > m_remaining) {
+      throw std::runtime_error("Unexpected end of nuclear interaction input");
+    }
+    m_is.read(data, static_cast<std::streamsize>(size));
+    if (!m_is) {
+      throw std::runtime_error("Could not read nuclear interaction input");
+    }
+    m_remaining -= size;
+  }
+
+  std::istream& m_is;
+  std::uint64_t m_remaining = 0;
+};
+
+}  // namespace
+
+void ActsFatras::detail::writeBinaryParametrisation(
+    std::ostream& os,
+    const MultiParticleNuclearInteractionParametrisation& mpp) {
+  Writer writer(os);
+  os.write(s_binaryMagic, sizeof(s_binaryMagic));
+  writer.value<std::uint64_t>(mpp.size());
+  for (const auto& [pdg, parametrisation] : mpp) {
+    writer.value<std::int32_t>(pdg);
+    writer.value<std::uint64_t>(parametrisation.size());
+    for (const auto& [momentum, parameters] : parametrisation) {
+      writer.value<float>(momentum);
+      writer.value<float>(parameters.softInteractionProbability);
+
+      writer.value<std::uint64_t>(parameters.pdgMap.size());
+      for (const auto& [producer, targets] : parameters.pdgMap) {
+        writer.value<std::int32_t>(producer);
+        writer.value<std::uint64_t>(targets.size());
+        for (const auto& [target, probability] : targets) {
+          writer.value<std::int32_t>(target);
+          writer.value<float>(probability);
+        }
+      }
+
+      writer.distribution(parameters.nuclearInteractionProbability);
+      writer.distribution(parameters.softMultiplicity);
+      writer.distribution(parameters.hardMultiplicity);
+      writer.kinematics(parameters.softKinematicParameters);
+      writer.kinematics(parameters.hardKinematicParameters);
+    }
+  }
+  if (!os) {
+    throw std::runtime_error("Could not write nuclear interaction output");
+  }
+}
+
+ActsFatras::detail::MultiParticleNuclearInteractionParametrisation
+ActsFatras::detail::readBinaryParametrisation(std::istream& is) {
+  Reader reader(is);
+
+  char magic[sizeof(s_binaryMagic)];
+  for (char& c : magic) {
+    c = reader.value<char>();
+  }
+  if (!std::equal(std::begin(magic), std::end(magic),
+                  std::begin(s_binaryMagic))) {
+    throw std::runtime_error("Invalid nuclear interaction input");
+  }
+
+  // Smallest encoded size of a particle and of a momentum entry
+  constexpr std::uint64_t particleSize = sizeof(std::int32_t) + s_countSize;
+  constexpr std::uint64_t momentumSize =
+      2 * sizeof(float) + s_countSize + 3 * s_distributionSize +
+      2 * s_countSize;
+  constexpr std::uint64_t producerSize = sizeof(std::int32_t) + s_countSize;
+  constexpr std::uint64_t targetSize = sizeof(std::int32_t) + sizeof(float);
+
+  MultiParticleNuclearInteractionParametrisation mpp(
+      reader.count(particleSize));
+  for (auto& [pdg, parametrisation] : mpp) {
+    pdg = reader.value<std::int32_t>();
+    parametrisation.resize(reader.count(momentumSize));
+    for (auto& [momentum, parameters] : parametrisation) {
+      momentum = reader.value<float>();
+      parameters.momentum = momentum;
+      parameters.softInteractionProbability = reader.value<float>();
+
+      parameters.pdgMap.resize(reader.count(producerSize));
+      for (auto& [producer, targets] : parameters.pdgMap) {
+        producer = reader.value<std::int32_t>();
+        targets.resize(reader.count(targetSize));
+        for (auto& [target, probability] : targets) {
+          target = reader.value<std::int32_t>();
+          probability = reader.value<float>();
+        }
+      }
+
+      parameters.nuclearInteractionProbability = reader.distribution();
+      parameters.softMultiplicity = reader.distribution();
+      parameters.hardMultiplicity = reader.distribution();
+      parameters.softKinematicParameters = reader.kinematics();
+      parameters.hardKinematicParameters = reader.kinematics();
+    }
+  }
+  if (!reader.atEnd()) {
+    throw std::runtime_error(
+        "Corrupt nuclear interaction input: unexpected trailing data");
+  }
+  return mpp;
+}
@@ -0,0 +1,63 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Plugins/Json/ActsJson.hpp"
+
+#include <string>
+
+namespace Acts {
+
+namespace JsonFileHelper {
+
+/// The file formats a json document can be stored in
+enum class Format {
+  /// Plain text
+  Json,
+  /// Concise Binary Object Representation
+  Cbor,
+  /// MessagePack
+  MessagePack,
+  /// Universal Binary JSON
+  UbJson
+};
+
+/// @brief Deduce the file format from the file name extension
+///
+/// `.cbor`, `.msgpack`/`.mpk` and `.ubj`/`.ubjson` select the binary formats,
+/// all other extensions are read as plain text
+///
+/// @param fileName the file name
+Format format(const std::string& fileName);
+
+/// @brief Read a json document from file
+///
+/// The format is deduced from the file name extension. The file is read
+/// into memory in one go and parsed from the contiguous buffer, which avoids
+/// the per-character overhead of parsing from a stream. The binary formats
+/// are considerably faster to parse than text, in particular for large
+/// material maps that are dominated by numbers.
+///
+/// @param fileName the input file name
+///
+/// @return the parsed json document
+nlohmann::json read(const std::string& fileName);
+
+/// @brief Write a json document to file
+///
+/// The format is deduced from the file name extension.
+///
+/// @param j the json document
+/// @param fileName the output file name
+/// @param indent the indentation for the plain text format
+void write(const nlohmann::json& j, const std::string& fileName,
+           int indent = 4);
+
+}  // namespace JsonFileHelper
+}  // namespace Acts
@@ -0,0 +1,89 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Json/JsonFileHelper.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+bool hasExtension(const std::string& fileName, const std::string& extension) {
+  return fileName.size() >= extension.size() &&
+         fileName.compare(fileName.size() - extension.size(),
+                          extension.size(), extension) == 0;
+}
+
+}  // namespace
+
+Acts::JsonFileHelper::Format Acts::JsonFileHelper::format(
+    const std::string& fileName) {
+  if (hasExtension(fileName, ".cbor")) {
+    return Format::Cbor;
+  }
+  if (hasExtension(fileName, ".msgpack") || hasExtension(fileName, ".mpk")) {
+    return Format::MessagePack;
+  }
+  if (hasExtension(fileName, ".ubj") || hasExtension(fileName, ".ubjson")) {
+    return Format::UbJson;
+  }
+  return Format::Json;
+}
+
+nlohmann::json Acts::JsonFileHelper::read(const std::string& fileName) {
+  std::ifstream in(fileName, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!in.good()) {
+    throw std::runtime_error{"Unable to open input JSON file: " + fileName};
+  }
+
+  // Read the full file in one go
+  std::vector<std::uint8_t> buffer(static_cast<std::size_t>(in.tellg()));
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+  if (!in.good()) {
+    throw std::runtime_error{"Unable to read input JSON file: " + fileName};
+  }
+
+  switch (format(fileName)) {
+    case Format::Cbor:
+      return nlohmann::json::from_cbor(buffer);
+    case Format::MessagePack:
+      return nlohmann::json::from_msgpack(buffer);
+    case Format::UbJson:
+      return nlohmann::json::from_ubjson(buffer);
+    default:
+      return nlohmann::json::parse(buffer);
+  }
+}
+
+void Acts::JsonFileHelper::write(const nlohmann::json& j,
+                                 const std::string& fileName, int indent) {
+  std::ofstream out(fileName, std::ios::out | std::ios::binary);
+  if (!out.good()) {
+    throw std::runtime_error{"Unable to open output JSON file: " + fileName};
+  }
+
+  std::vector<std::uint8_t> buffer;
+  switch (format(fileName)) {
+    case Format::Cbor:
+      buffer = nlohmann::json::to_cbor(j);
+      break;
+    case Format::MessagePack:
+      buffer = nlohmann::json::to_msgpack(j);
+      break;
+    case Format::UbJson:
+      buffer = nlohmann::json::to_ubjson(j);
+      break;
+    default:
+      out << j.dump(indent) << std::endl;
+      return;
+  }
+  out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
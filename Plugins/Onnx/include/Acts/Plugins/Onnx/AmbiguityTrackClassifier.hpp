@@ -10,10 +10,12 @@
 
 #include "Acts/EventData/MultiTrajectoryHelpers.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/Plugins/Onnx/OnnxInferenceExecutor.hpp"
 #include "Acts/Plugins/Onnx/OnnxRuntimeBase.hpp"
 #include "Acts/TrackFinding/detail/AmbiguityTrackClustering.hpp"
 
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -28,8 +30,28 @@ class AmbiguityTrackClassifier {
   ///
   /// @param modelPath path to the model file
   AmbiguityTrackClassifier(const char* modelPath)
-      : m_env(ORT_LOGGING_LEVEL_WARNING, "MLClassifier"),
-        m_duplicateClassifier(m_env, modelPath) {}
+      : AmbiguityTrackClassifier(OnnxInferenceExecutor::Config{modelPath}) {}
+
+  /// Construct the ambiguity scoring algorithm with its own inference
+  /// executor.
+  ///
+  /// @param cfg configuration of the inference executor
+  AmbiguityTrackClassifier(const OnnxInferenceExecutor::Config& cfg)
+      : m_duplicateClassifier(
+            std::make_shared<const OnnxInferenceExecutor>(cfg)) {}
+
+  /// Construct the ambiguity scoring algorithm with a shared inference
+  /// executor.
+  ///
+  /// @param executor the inference executor of the track scoring model
+  AmbiguityTrackClassifier(
+      std::shared_ptr<const OnnxInferenceExecutor> executor)
+      : m_duplicateClassifier(std::move(executor)) {}
+
+  /// @return the executor running the network inference
+  const OnnxInferenceExecutor& executor() const {
+    return *m_duplicateClassifier;
+  }
 
   /// Compute a score for each track to be used in the track selection
   ///
@@ -71,7 +93,7 @@ class AmbiguityTrackClassifier {
     }
     // Use the network to compute a score for all the tracks.
     std::vector<std::vector<float>> outputTensor =
-        m_duplicateClassifier.runONNXInference(networkInput);
+        m_duplicateClassifier->run(networkInput);
     return outputTensor;
   }
 
@@ -122,10 +144,8 @@ class AmbiguityTrackClassifier {
   }
 
  private:
-  // ONNX environment
-  Ort::Env m_env;
   // ONNX model for the duplicate neural network
-  Acts::OnnxRuntimeBase m_duplicateClassifier;
+  std::shared_ptr<const OnnxInferenceExecutor> m_duplicateClassifier;
 };
 
 }  // namespace Acts
@@ -0,0 +1,87 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace Acts {
+
+/// Merge the inputs of concurrent calls into a single batch for an
+/// inference function.
+///
+/// The first call waits up to @c window for further calls, copies all the
+/// pending inputs into a reused buffer, runs the inference once and hands
+/// the output rows back to the waiting calls. Further calls arriving while
+/// a batch runs start collecting the next batch. An exception thrown by the
+/// inference is rethrown in every call of the batch.
+class BatchCoalescer {
+ public:
+  /// Row major input with one row per input, same as @c NetworkBatchInput
+  using Input =
+      Eigen::Array<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  /// Output values, one vector per input row
+  using Output = std::vector<std::vector<float>>;
+  /// The inference run for each batch, one output per input row
+  using Inference = std::function<Output(Eigen::Map<Input>)>;
+
+  struct Config {
+    /// Maximum time the first call waits for the inputs of further calls
+    std::chrono::microseconds window{500};
+    /// Stop waiting for further inputs once this many rows are pending
+    std::size_t maxBatchRows = 16384;
+  };
+
+  /// @param cfg the coalescing configuration
+  /// @param inference the inference run for each batch
+  BatchCoalescer(const Config& cfg, Inference inference);
+
+  BatchCoalescer(const BatchCoalescer&) = delete;
+  BatchCoalescer& operator=(const BatchCoalescer&) = delete;
+
+  /// Run the inference for the input together with concurrent calls.
+  ///
+  /// @param input the input values, one row per input
+  /// @return the output values, one vector per input row
+  Output run(Input& input) const;
+
+ private:
+  /// One call waiting for a coalesced inference
+  struct Request {
+    Input* input = nullptr;
+    Output output;
+    std::exception_ptr error;
+    bool done = false;
+  };
+
+  /// Run one inference for all the requests, using the given buffer
+  void runBatch(const std::vector<Request*>& requests,
+                std::vector<float>& buffer) const;
+
+  Config m_cfg;
+  Inference m_inference;
+
+  // Requests waiting for the next inference
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_condition;
+  mutable std::vector<Request*> m_pending;
+  mutable std::size_t m_pendingRows = 0;
+  mutable bool m_collecting = false;
+  // Batch buffers which are not in use, kept to avoid reallocations
+  mutable std::vector<std::vector<float>> m_freeBuffers;
+};
+
+}  // namespace Acts
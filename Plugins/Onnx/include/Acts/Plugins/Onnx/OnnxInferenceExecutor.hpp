@@ -0,0 +1,114 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Plugins/Onnx/BatchCoalescer.hpp"
+#include "Acts/Plugins/Onnx/OnnxRuntimeBase.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <onnxruntime_cxx_api.h>
+
+namespace Acts {
+
+/// Thread-safe inference of a single-input, single-output ONNX model which
+/// is shared by all the events in flight.
+///
+/// The inference can be called concurrently from several threads. With
+/// @c coalesceBatches the inputs of concurrent calls are merged into one
+/// batch: the first call waits up to @c coalesceWindow for further inputs,
+/// copies all of them into a reused buffer, runs a single inference and
+/// hands the output rows back to the waiting calls. This requires a model
+/// with a dynamic batch dimension. The coalescing is done by a
+/// @c BatchCoalescer.
+class OnnxInferenceExecutor {
+ public:
+  struct Config {
+    /// Path to the ML model in *.onnx format
+    std::string modelPath;
+    /// Number of threads used within one node, 0 for the runtime default
+    int intraOpNumThreads = 0;
+    /// Number of threads used to run independent nodes concurrently, 0 for
+    /// the runtime default
+    int interOpNumThreads = 0;
+    /// Merge the inputs of concurrent calls into one inference
+    bool coalesceBatches = false;
+    /// Maximum time the first call waits for the inputs of further calls
+    std::chrono::microseconds coalesceWindow{500};
+    /// Stop waiting for further inputs once this many rows are pending
+    std::size_t maxBatchRows = 16384;
+  };
+
+  /// Counters accumulated over all the calls
+  struct Metrics {
+    /// Number of calls to @c run
+    std::size_t nRequests = 0;
+    /// Number of inferences run by the ONNX runtime
+    std::size_t nInferences = 0;
+    /// Number of input rows
+    std::size_t nRows = 0;
+    /// Total time spent in the ONNX runtime in seconds
+    double inferenceTime = 0;
+    /// Total time spent in @c run, including the waiting, in seconds
+    double requestTime = 0;
+  };
+
+  /// Load the model and set up the ONNX runtime session.
+  ///
+  /// @param cfg the executor configuration
+  explicit OnnxInferenceExecutor(const Config& cfg);
+
+  OnnxInferenceExecutor(const OnnxInferenceExecutor&) = delete;
+  OnnxInferenceExecutor& operator=(const OnnxInferenceExecutor&) = delete;
+
+  /// Run the inference for a batch of inputs.
+  ///
+  /// @param inputTensorValues the input feature values, one row per input
+  /// @return the output values, one vector per input row
+  std::vector<std::vector<float>> run(
+      NetworkBatchInput& inputTensorValues) const;
+
+  /// @return the counters accumulated so far
+  Metrics metrics() const;
+
+  /// Const access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// Run the inference directly on the given map and record the timing
+  std::vector<std::vector<float>> infer(
+      Eigen::Map<NetworkBatchInput> inputTensorValues) const;
+
+  Config m_cfg;
+  // ONNX environment
+  Ort::Env m_env;
+  // ONNX model
+  OnnxRuntimeBase m_model;
+  // Merges concurrent calls, only set with coalesced batches
+  std::unique_ptr<BatchCoalescer> m_coalescer;
+
+  mutable std::atomic<std::size_t> m_nRequests{0};
+  mutable std::atomic<std::size_t> m_nInferences{0};
+  mutable std::atomic<std::size_t> m_nRows{0};
+  mutable std::atomic<std::int64_t> m_inferenceNs{0};
+  mutable std::atomic<std::int64_t> m_requestNs{0};
+};
+
+/// Print a one line summary of the inference metrics
+std::ostream& operator<<(std::ostream& os,
+                         const OnnxInferenceExecutor::Metrics& metrics);
+
+}  // namespace Acts
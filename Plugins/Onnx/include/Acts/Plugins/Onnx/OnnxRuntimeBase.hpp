@@ -30,6 +30,14 @@ class OnnxRuntimeBase {
   /// @param modelPath the path to the ML model in *.onnx format
   OnnxRuntimeBase(Ort::Env& env, const char* modelPath);
 
+  /// @brief Parametrized constructor with custom session options
+  ///
+  /// @param env the ONNX runtime environment
+  /// @param modelPath the path to the ML model in *.onnx format
+  /// @param sessionOptions the options of the ONNX runtime session
+  OnnxRuntimeBase(Ort::Env& env, const char* modelPath,
+                  const Ort::SessionOptions& sessionOptions);
+
   /// @brief Default destructor
   ~OnnxRuntimeBase() = default;
 
@@ -49,6 +57,14 @@ class OnnxRuntimeBase {
   std::vector<std::vector<float>> runONNXInference(
       NetworkBatchInput& inputTensorValues) const;
 
+  /// @brief Run the ONNX inference function for a batch of input stored in an external buffer
+  ///
+  /// @param inputTensorValues Map of the input feature values of all the inputs used for prediction
+  ///
+  /// @return The vector of output (predicted) values
+  std::vector<std::vector<float>> runONNXInference(
+      Eigen::Map<NetworkBatchInput> inputTensorValues) const;
+
   /// @brief Run the multi-output ONNX inference function for a batch of input
   ///
   /// @param inputTensorValues Vector of the input feature values of all the inputs used for prediction
@@ -57,6 +73,14 @@ class OnnxRuntimeBase {
   std::vector<std::vector<std::vector<float>>> runONNXInferenceMultiOutput(
       NetworkBatchInput& inputTensorValues) const;
 
+  /// @brief Run the multi-output ONNX inference function for a batch of input stored in an external buffer
+  ///
+  /// @param inputTensorValues Map of the input feature values of all the inputs used for prediction
+  ///
+  /// @return The vector of output (predicted) values, one for each output
+  std::vector<std::vector<std::vector<float>>> runONNXInferenceMultiOutput(
+      Eigen::Map<NetworkBatchInput> inputTensorValues) const;
+
  private:
   /// ONNX runtime session / model properties
   std::unique_ptr<Ort::Session> m_session;
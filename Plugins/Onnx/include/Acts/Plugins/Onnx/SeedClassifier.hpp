@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include "Acts/Plugins/Onnx/OnnxInferenceExecutor.hpp"
 #include "Acts/Plugins/Onnx/OnnxRuntimeBase.hpp"
 
+#include <memory>
 #include <vector>
 
 #include <onnxruntime_cxx_api.h>
@@ -23,8 +25,25 @@ class SeedClassifier {
   ///
   /// @param modelPath path to the model file
   SeedClassifier(const char* modelPath)
-      : m_env(ORT_LOGGING_LEVEL_WARNING, "MLSeedClassifier"),
-        m_duplicateClassifier(m_env, modelPath){};
+      : SeedClassifier(OnnxInferenceExecutor::Config{modelPath}) {}
+
+  /// Construct the scoring algorithm with its own inference executor.
+  ///
+  /// @param cfg configuration of the inference executor
+  SeedClassifier(const OnnxInferenceExecutor::Config& cfg)
+      : m_duplicateClassifier(
+            std::make_shared<const OnnxInferenceExecutor>(cfg)) {}
+
+  /// Construct the scoring algorithm with a shared inference executor.
+  ///
+  /// @param executor the inference executor of the seed scoring model
+  SeedClassifier(std::shared_ptr<const OnnxInferenceExecutor> executor)
+      : m_duplicateClassifier(std::move(executor)) {}
+
+  /// @return the executor running the network inference
+  const OnnxInferenceExecutor& executor() const {
+    return *m_duplicateClassifier;
+  }
 
   /// Compute a score for each seed to be used in the seed selection
   ///
@@ -34,7 +53,7 @@ class SeedClassifier {
       Acts::NetworkBatchInput& networkInput) const {
     // Use the network to compute a score for all the Seeds.
     std::vector<std::vector<float>> outputTensor =
-        m_duplicateClassifier.runONNXInference(networkInput);
+        m_duplicateClassifier->run(networkInput);
     return outputTensor;
   }
 
@@ -83,10 +102,8 @@ class SeedClassifier {
   }
 
  private:
-  // ONNX environment
-  Ort::Env m_env;
   // ONNX model for the duplicate neural network
-  Acts::OnnxRuntimeBase m_duplicateClassifier;
+  std::shared_ptr<const OnnxInferenceExecutor> m_duplicateClassifier;
 };
 
 }  // namespace Acts
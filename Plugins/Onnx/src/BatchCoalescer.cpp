@@ -0,0 +1,111 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Onnx/BatchCoalescer.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+Acts::BatchCoalescer::BatchCoalescer(const Config& cfg, Inference inference)
+    : m_cfg(cfg), m_inference(std::move(inference)) {
+  if (!m_inference) {
+    throw std::invalid_argument("Missing inference function");
+  }
+  if (m_cfg.maxBatchRows == 0) {
+    throw std::invalid_argument("Coalesced batches need a maximum size");
+  }
+}
+
+Acts::BatchCoalescer::Output Acts::BatchCoalescer::run(Input& input) const {
+  Request request;
+  request.input = &input;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_pending.push_back(&request);
+  m_pendingRows += input.rows();
+  if (m_collecting) {
+    // Another call collects the batch and runs the inference for us
+    m_condition.notify_all();
+    m_condition.wait(lock, [&] { return request.done; });
+  } else {
+    // Collect the inputs of the concurrent calls for a while
+    m_collecting = true;
+    m_condition.wait_for(lock, m_cfg.window, [&] {
+      return m_pendingRows >= m_cfg.maxBatchRows;
+    });
+    std::vector<Request*> requests = std::move(m_pending);
+    m_pending.clear();
+    m_pendingRows = 0;
+    m_collecting = false;
+    std::vector<float> buffer;
+    if (!m_freeBuffers.empty()) {
+      buffer = std::move(m_freeBuffers.back());
+      m_freeBuffers.pop_back();
+    }
+
+    // The next calls can start collecting while this batch runs
+    lock.unlock();
+    runBatch(requests, buffer);
+    lock.lock();
+
+    m_freeBuffers.push_back(std::move(buffer));
+    for (Request* waiting : requests) {
+      waiting->done = true;
+    }
+    m_condition.notify_all();
+  }
+  lock.unlock();
+
+  if (request.error) {
+    std::rethrow_exception(request.error);
+  }
+  return std::move(request.output);
+}
+
+void Acts::BatchCoalescer::runBatch(const std::vector<Request*>& requests,
+                                    std::vector<float>& buffer) const {
+  try {
+    const auto nCols = requests.front()->input->cols();
+    std::size_t nRows = 0;
+    for (const Request* request : requests) {
+      if (request->input->cols() != nCols) {
+        throw std::invalid_argument(
+            "BatchCoalescer: inputs with different number of features can "
+            "not be coalesced");
+      }
+      nRows += request->input->rows();
+    }
+
+    // The inputs are stored row major and can be copied one after another
+    buffer.resize(nRows * nCols);
+    auto next = buffer.begin();
+    for (const Request* request : requests) {
+      next = std::copy_n(request->input->data(), request->input->size(), next);
+    }
+    auto output = m_inference(Eigen::Map<Input>(
+        buffer.data(), static_cast<Eigen::Index>(nRows), nCols));
+    if (output.size() != nRows) {
+      throw std::runtime_error(
+          "BatchCoalescer: the inference did not return one output per row");
+    }
+
+    auto outputBegin = output.begin();
+    for (Request* request : requests) {
+      auto outputEnd = std::next(outputBegin, request->input->rows());
+      request->output.assign(std::make_move_iterator(outputBegin),
+                             std::make_move_iterator(outputEnd));
+      outputBegin = outputEnd;
+    }
+  } catch (...) {
+    for (Request* request : requests) {
+      request->error = std::current_exception();
+    }
+  }
+}
@@ -0,0 +1,105 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Onnx/OnnxInferenceExecutor.hpp"
+
+#include <ostream>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::int64_t elapsedNs(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                              start)
+      .count();
+}
+
+Ort::SessionOptions makeSessionOptions(
+    const Acts::OnnxInferenceExecutor::Config& cfg) {
+  Ort::SessionOptions sessionOptions;
+  sessionOptions.SetGraphOptimizationLevel(
+      GraphOptimizationLevel::ORT_ENABLE_BASIC);
+  if (cfg.intraOpNumThreads > 0) {
+    sessionOptions.SetIntraOpNumThreads(cfg.intraOpNumThreads);
+  }
+  if (cfg.interOpNumThreads > 0) {
+    // the inter-op threads are only used in the parallel execution mode
+    sessionOptions.SetInterOpNumThreads(cfg.interOpNumThreads);
+    sessionOptions.SetExecutionMode(cfg.interOpNumThreads > 1
+                                        ? ExecutionMode::ORT_PARALLEL
+                                        : ExecutionMode::ORT_SEQUENTIAL);
+  }
+  return sessionOptions;
+}
+
+}  // namespace
+
+Acts::OnnxInferenceExecutor::OnnxInferenceExecutor(const Config& cfg)
+    : m_cfg(cfg),
+      m_env(ORT_LOGGING_LEVEL_WARNING, "OnnxInferenceExecutor"),
+      m_model(m_env, m_cfg.modelPath.c_str(), makeSessionOptions(m_cfg)) {
+  if (m_cfg.coalesceBatches) {
+    BatchCoalescer::Config coalescerCfg;
+    coalescerCfg.window = m_cfg.coalesceWindow;
+    coalescerCfg.maxBatchRows = m_cfg.maxBatchRows;
+    m_coalescer = std::make_unique<BatchCoalescer>(
+        coalescerCfg, [this](Eigen::Map<NetworkBatchInput> input) {
+          return infer(input);
+        });
+  }
+}
+
+std::vector<std::vector<float>> Acts::OnnxInferenceExecutor::run(
+    NetworkBatchInput& inputTensorValues) const {
+  const auto start = Clock::now();
+  const std::size_t nRows = inputTensorValues.rows();
+  ++m_nRequests;
+  m_nRows += nRows;
+
+  if (!m_cfg.coalesceBatches) {
+    auto output = infer(Eigen::Map<NetworkBatchInput>(
+        inputTensorValues.data(), inputTensorValues.rows(),
+        inputTensorValues.cols()));
+    m_requestNs += elapsedNs(start);
+    return output;
+  }
+
+  auto output = m_coalescer->run(inputTensorValues);
+  m_requestNs += elapsedNs(start);
+  return output;
+}
+
+Acts::OnnxInferenceExecutor::Metrics Acts::OnnxInferenceExecutor::metrics()
+    const {
+  Metrics metrics;
+  metrics.nRequests = m_nRequests;
+  metrics.nInferences = m_nInferences;
+  metrics.nRows = m_nRows;
+  metrics.inferenceTime = 1e-9 * m_inferenceNs;
+  metrics.requestTime = 1e-9 * m_requestNs;
+  return metrics;
+}
+
+std::vector<std::vector<float>> Acts::OnnxInferenceExecutor::infer(
+    Eigen::Map<NetworkBatchInput> inputTensorValues) const {
+  const auto start = Clock::now();
+  auto output = m_model.runONNXInference(inputTensorValues);
+  m_inferenceNs += elapsedNs(start);
+  ++m_nInferences;
+  return output;
+}
+
+std::ostream& Acts::operator<<(
+    std::ostream& os, const OnnxInferenceExecutor::Metrics& metrics) {
+  os << metrics.nRows << " inputs from " << metrics.nRequests
+     << " requests in " << metrics.nInferences << " inferences, "
+     << metrics.inferenceTime << " s inference time, " << metrics.requestTime
+     << " s request time";
+  return os;
+}
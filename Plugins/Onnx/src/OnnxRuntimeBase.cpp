@@ -12,12 +12,20 @@
 #include <stdexcept>
 
 // Parametrized constructor
-Acts::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env, const char* modelPath) {
-  // Set the ONNX runtime session options
-  Ort::SessionOptions sessionOptions;
-  // Set graph optimization level
-  sessionOptions.SetGraphOptimizationLevel(
-      GraphOptimizationLevel::ORT_ENABLE_BASIC);
+Acts::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env, const char* modelPath)
+    : OnnxRuntimeBase(env, modelPath, [] {
+        // Set the ONNX runtime session options
+        Ort::SessionOptions sessionOptions;
+        // Set graph optimization level
+        sessionOptions.SetGraphOptimizationLevel(
+            GraphOptimizationLevel::ORT_ENABLE_BASIC);
+        return sessionOptions;
+      }()) {}
+
+// Parametrized constructor with custom session options
+Acts::OnnxRuntimeBase::OnnxRuntimeBase(
+    Ort::Env& env, const char* modelPath,
+    const Ort::SessionOptions& sessionOptions) {
   // Create the Ort session
   m_session = std::make_unique<Ort::Session>(env, modelPath, sessionOptions);
   // Default allocator
@@ -71,10 +79,26 @@ std::vector<std::vector<float>> Acts::OnnxRuntimeBase::runONNXInference(
   return runONNXInferenceMultiOutput(inputTensorValues).front();
 }
 
+// Inference function using ONNX runtime on an external buffer
+std::vector<std::vector<float>> Acts::OnnxRuntimeBase::runONNXInference(
+    Eigen::Map<NetworkBatchInput> inputTensorValues) const {
+  return runONNXInferenceMultiOutput(inputTensorValues).front();
+}
+
 // Inference function for single-input, multi-output models
 std::vector<std::vector<std::vector<float>>>
 Acts::OnnxRuntimeBase::runONNXInferenceMultiOutput(
     NetworkBatchInput& inputTensorValues) const {
+  return runONNXInferenceMultiOutput(Eigen::Map<NetworkBatchInput>(
+      inputTensorValues.data(), inputTensorValues.rows(),
+      inputTensorValues.cols()));
+}
+
+// Inference function for single-input, multi-output models on an external
+// buffer
+std::vector<std::vector<std::vector<float>>>
+Acts::OnnxRuntimeBase::runONNXInferenceMultiOutput(
+    Eigen::Map<NetworkBatchInput> inputTensorValues) const {
   int batchSize = inputTensorValues.rows();
   std::vector<int64_t> inputNodeDims = m_inputNodeDims;
   std::vector<std::vector<int64_t>> outputNodeDims = m_outputNodeDims;
@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Detector/FrozenDetector.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Navigation/DetectorNavigator.hpp"
+#include "Acts/Navigation/StaticNavigationPolicy.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalDetector.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::Experimental;
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  unsigned int toys = 1;
+  unsigned int runs = 1;
+  double maxEta = 1;
+  unsigned int lvl = Acts::Logging::INFO;
+
+  // Create a test context
+  GeometryContext tgContext = GeometryContext();
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("toys",po::value<unsigned int>(&toys)->default_value(1000),"number of tracks per run")
+      ("runs",po::value<unsigned int>(&runs)->default_value(20),"number of benchmark runs")
+      ("eta",po::value<double>(&maxEta)->default_value(2.5),"maximum absolute pseudorapidity")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("DetectorNavigator", Acts::Logging::Level(lvl)));
+
+  Test::CylindricalTrackingGeometry cGeometry(tgContext);
+  Test::CylindricalTrackingGeometry::DetectorStore dStore;
+  auto detector =
+      Test::buildBarrelEndcapsDetector(tgContext, cGeometry, dStore);
+
+  StaticNavigationPolicy policy(*detector);
+  ACTS_INFO("statically resolved " << policy.resolvedVolumes()
+                                   << " volumes and "
+                                   << policy.resolvedPortals() << " portals");
+
+  using Propagator_type = Propagator<StraightLineStepper, DetectorNavigator>;
+
+  DetectorNavigator::Config navCfg;
+  navCfg.detector = detector.get();
+  Propagator_type propagator{StraightLineStepper(), DetectorNavigator(navCfg)};
+
+  DetectorNavigator::Config staticNavCfg = navCfg;
+  staticNavCfg.staticPolicy = &policy;
+  Propagator_type staticPropagator{StraightLineStepper(),
+                                   DetectorNavigator(staticNavCfg)};
+
+  FrozenDetector frozen(*detector);
+  DetectorNavigator::Config frozenNavCfg = navCfg;
+  frozenNavCfg.frozenDetector = &frozen;
+  Propagator_type frozenPropagator{StraightLineStepper(),
+                                   DetectorNavigator(frozenNavCfg)};
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = 1_m;
+
+  // Tracks start close to the layers, the surface grids are looked up at
+  // the start position
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> etaDist(-maxEta, maxEta);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::vector<CurvilinearTrackParameters> tracks;
+  tracks.reserve(toys);
+  for (unsigned int i = 0; i < toys; ++i) {
+    const double phi = phiDist(rng);
+    const double theta = 2. * std::atan(std::exp(-etaDist(rng)));
+    tracks.emplace_back(
+        Vector4(60. * std::cos(phi), 60. * std::sin(phi), 0., 0.),
+        Vector3(std::cos(phi) * std::sin(theta),
+                std::sin(phi) * std::sin(theta), std::cos(theta)),
+        1_e / 1_GeV, std::nullopt, ParticleHypothesis::pion());
+  }
+
+  ACTS_INFO("propagating " << toys << " tracks in " << runs << " runs");
+
+  const auto delegate_bench_result = Acts::Test::microBenchmark(
+      [&](const auto& pars) {
+        return propagator.propagate(pars, options).value();
+      },
+      tracks, runs);
+  ACTS_INFO("Delegate navigation: " << delegate_bench_result);
+
+  const auto static_bench_result = Acts::Test::microBenchmark(
+      [&](const auto& pars) {
+        return staticPropagator.propagate(pars, options).value();
+      },
+      tracks, runs);
+  ACTS_INFO("Static navigation: " << static_bench_result);
+
+  const auto frozen_bench_result = Acts::Test::microBenchmark(
+      [&](const auto& pars) {
+        return frozenPropagator.propagate(pars, options).value();
+      },
+      tracks, runs);
+  ACTS_INFO("Frozen navigation: " << frozen_bench_result);
+
+  return 0;
+}
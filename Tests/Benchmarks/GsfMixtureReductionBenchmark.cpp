@@ -0,0 +1,180 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/TrackFitting/GsfMixtureReduction.hpp"
+#include "Acts/TrackFitting/GsfOptions.hpp"
+#include "Acts/TrackFitting/detail/FixedSizeSymmetricKlDistanceMatrix.hpp"
+#include "Acts/TrackFitting/detail/SymmetricKlDistanceMatrix.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+using Mixture = std::vector<GsfComponent>;
+
+namespace {
+// Heap allocations through the global operator new, to show which mixture
+// sizes are reduced without allocating
+std::size_t s_nAllocations = 0;
+}  // namespace
+
+void* operator new(std::size_t size) {
+  ++s_nAllocations;
+  if (void* ptr = std::malloc(size != 0u ? size : 1u); ptr != nullptr) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t nMixtures = 100;
+  std::size_t targetComponents = 12;
+  std::size_t nRuns = 1000;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "produce help message")
+        ("mixtures", po::value<std::size_t>(&nMixtures)->default_value(100), "number of random mixtures per run")
+        ("target", po::value<std::size_t>(&targetComponents)->default_value(12), "number of components after reduction")
+        ("runs", po::value<std::size_t>(&nRuns)->default_value(1000), "number of benchmark runs");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  auto surface = Surface::makeShared<PlaneSurface>(Vector3{0, 0, 0},
+                                                   Vector3{1, 0, 0});
+  const auto proj = [](auto& a) -> decltype(auto) { return a; };
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> qopDist(0.1, 1.0);
+  std::uniform_real_distribution<double> varDist(0.001, 0.1);
+  std::uniform_real_distribution<double> weightDist(0.01, 1.0);
+
+  auto makeMixtures = [&](std::size_t nComponents) {
+    std::vector<Mixture> mixtures(nMixtures);
+    for (auto& mixture : mixtures) {
+      for (auto i = 0ul; i < nComponents; ++i) {
+        GsfComponent cmp;
+        cmp.boundPars = BoundVector::Zero();
+        cmp.boundCov = BoundSquareMatrix::Identity();
+        cmp.weight = weightDist(rng);
+        cmp.boundPars[eBoundQOverP] = qopDist(rng);
+        cmp.boundCov(eBoundQOverP, eBoundQOverP) = varDist(rng);
+        mixture.push_back(cmp);
+      }
+    }
+    return mixtures;
+  };
+
+  // Benchmark the distance matrix of the given capacity
+  auto benchmarkFixedSize = [&](auto capacity, const auto& mixtures,
+                                std::size_t nComponents, const auto& desc) {
+    constexpr std::size_t N = decltype(capacity)::value;
+    const auto result = Test::microBenchmark(
+        [&](const Mixture& input) {
+          auto cmps = input;
+          detail::reduceWithKLDistance<
+              detail::FixedSizeSymmetricKLDistanceMatrix<N>>(
+              cmps, std::min(targetComponents, nComponents), proj, desc);
+          return cmps;
+        },
+        mixtures, nRuns);
+    std::cout << "FixedSizeSymmetricKLDistanceMatrix<" << N << ">:" << result
+              << std::endl;
+  };
+
+  // Mixtures as they occur in the GSF, maxComponents times the number of
+  // Bethe-Heitler components, on both sides of the dispatch between the
+  // fixed size matrices in GsfMixtureReduction.cpp
+  for (std::size_t nComponents :
+       {12ul, 24ul, 32ul, 36ul, 48ul, 72ul, 96ul, 128ul}) {
+    const auto mixtures = makeMixtures(nComponents);
+
+    std::cout << "=== " << nComponents << " -> " << targetComponents
+              << " components ===" << std::endl;
+
+    detail::angleDescriptionSwitch(*surface, [&](const auto& desc) {
+      const auto dynamicResult = Test::microBenchmark(
+          [&](const Mixture& input) {
+            auto cmps = input;
+            detail::reduceWithKLDistance<detail::SymmetricKLDistanceMatrix>(
+                cmps, std::min(targetComponents, nComponents), proj, desc);
+            return cmps;
+          },
+          mixtures, nRuns);
+      std::cout << "SymmetricKLDistanceMatrix:" << dynamicResult << std::endl;
+
+      // the capacities instantiated by the production code
+      if (nComponents <= 32) {
+        benchmarkFixedSize(std::integral_constant<std::size_t, 32>{},
+                           mixtures, nComponents, desc);
+      }
+      if (nComponents <= 80) {
+        benchmarkFixedSize(std::integral_constant<std::size_t, 80>{},
+                           mixtures, nComponents, desc);
+      }
+      benchmarkFixedSize(std::integral_constant<std::size_t, 128>{}, mixtures,
+                         nComponents, desc);
+    });
+
+    // the production entry point including the dispatch
+    const auto productionResult = Test::microBenchmark(
+        [&](const Mixture& input) {
+          auto cmps = input;
+          reduceMixtureWithKLDistance(
+              cmps, std::min(targetComponents, nComponents), *surface);
+          return cmps;
+        },
+        mixtures, nRuns);
+    std::cout << "reduceMixtureWithKLDistance:" << productionResult
+              << std::endl;
+
+    // the input is copied before counting, only the reduction is seen
+    auto cmps = mixtures.front();
+    const std::size_t nBefore = s_nAllocations;
+    reduceMixtureWithKLDistance(cmps, std::min(targetComponents, nComponents),
+                                *surface);
+    std::cout << "reduceMixtureWithKLDistance heap allocations: "
+              << s_nAllocations - nBefore << std::endl;
+  }
+
+  return 0;
+}
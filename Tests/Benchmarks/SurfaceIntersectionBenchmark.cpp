@@ -16,13 +16,16 @@
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/DiscSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 
 #include <cmath>
 #include <random>
+#include <vector>
 
 namespace bdata = boost::unit_test::data;
 using namespace Acts::UnitLiterals;
@@ -123,5 +126,58 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+BOOST_AUTO_TEST_CASE(benchmark_plane_batch_intersections) {
+  // A barrel-like ring of rectangle and trapezoid modules
+  const unsigned int nModules = 64;
+  std::vector<std::shared_ptr<PlaneSurface>> modules;
+  std::vector<const PlaneSurface*> surfaces;
+  for (unsigned int im = 0; im < nModules; ++im) {
+    const double phi = im * 2 * M_PI / nModules;
+    Transform3 transform = Transform3::Identity() *
+                           Translation3(0.5_m * std::cos(phi),
+                                        0.5_m * std::sin(phi), 0.) *
+                           AngleAxis3(phi, Vector3::UnitZ()) *
+                           AngleAxis3(0.5 * M_PI, Vector3::UnitY());
+    std::shared_ptr<PlanarBounds> bounds;
+    if (im % 2 == 0) {
+      bounds = std::make_shared<RectangleBounds>(0.5_m, 30_mm);
+    } else {
+      bounds = std::make_shared<TrapezoidBounds>(20_mm, 30_mm, 0.5_m);
+    }
+    modules.push_back(Surface::makeShared<PlaneSurface>(transform, bounds));
+    surfaces.push_back(modules.back().get());
+  }
+  PlaneSurfaceBatch batch(tgContext, surfaces);
+  PlaneSurfaceBatch::Intersections intersections;
+
+  const Vector3 direction = Vector3(0.3, 0.9, 0.1).normalized();
+  const BoundaryCheck bcheck(true);
+
+  const auto single_bench_result = Acts::Test::microBenchmark(
+      [&] {
+        std::size_t nValid = 0;
+        for (const auto* surface : surfaces) {
+          auto sIntersection =
+              surface->intersect(tgContext, origin, direction, bcheck);
+          nValid += sIntersection.closest() ? 1u : 0u;
+        }
+        return nValid;
+      },
+      nrepts);
+  const auto batch_bench_result = Acts::Test::microBenchmark(
+      [&] {
+        batch.intersect(origin, direction, bcheck, s_onSurfaceTolerance,
+                        intersections);
+        return intersections.status.size();
+      },
+      nrepts);
+
+  std::cout << std::endl
+            << "Benchmarking " << nModules << " plane intersections..."
+            << std::endl;
+  std::cout << "- Single: " << single_bench_result << std::endl;
+  std::cout << "- Batch: " << batch_bench_result << std::endl;
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -0,0 +1,106 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/DetectorElementStub.hpp"
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+unsigned int nrepts = 1000;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+/// Detector element caching the inverse of its transform
+class CachedElementStub : public DetectorElementStub {
+ public:
+  CachedElementStub(const Transform3& transform,
+                    std::shared_ptr<const PlanarBounds> pBounds)
+      : DetectorElementStub(transform, std::move(pBounds), 0.),
+        m_inverseTransform(transform.inverse()) {}
+
+  Transform3 inverseTransform(
+      const GeometryContext& /*gctx*/) const override {
+    return m_inverseTransform;
+  }
+
+ private:
+  Transform3 m_inverseTransform;
+};
+
+// Some random transform
+Transform3 at = Transform3::Identity() * Translation3(0_m, 0_m, 10_m) *
+                AngleAxis3(0.15, Vector3(1.2, 1.2, 0.12).normalized());
+
+auto rb = std::make_shared<const RectangleBounds>(1_m, 1_m);
+
+/// Inverse transform and global to local transformation of a surface,
+/// against the inverse computed from the transform on every call
+void benchmarkSurface(const std::string& name, const Surface& surface,
+                      const std::vector<Vector3>& positions) {
+  std::cout << "- " << name << std::endl;
+  std::cout << "  transform().inverse(): "
+            << microBenchmark(
+                   [&] { return surface.transform(tgContext).inverse(); },
+                   nrepts)
+            << std::endl;
+  std::cout << "  inverseTransform(): "
+            << microBenchmark(
+                   [&] { return surface.inverseTransform(tgContext); },
+                   nrepts)
+            << std::endl;
+  std::cout << "  globalToLocal(): "
+            << microBenchmark(
+                   [&](const Vector3& position) {
+                     return surface.globalToLocal(tgContext, position,
+                                                  Vector3::UnitZ());
+                   },
+                   positions, nrepts)
+            << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_surface_inverse_transform) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-1_m, 1_m);
+  std::vector<Vector3> positions;
+  for (unsigned int i = 0; i < 100; ++i) {
+    // positions on the plane, globalToLocal fails elsewhere
+    positions.push_back(at * Vector3(dist(rng), dist(rng), 0.));
+  }
+
+  auto freePlane = Surface::makeShared<PlaneSurface>(at, rb);
+
+  DetectorElementStub element(at, rb, 0.);
+  CachedElementStub cachedElement(at, rb);
+
+  benchmarkSurface("Free plane", *freePlane, positions);
+  benchmarkSurface("Detector element, computed inverse", element.surface(),
+                   positions);
+  benchmarkSurface("Detector element, cached inverse",
+                   cachedElement.surface(), positions);
+}
+
+}  // namespace Test
+}  // namespace Acts
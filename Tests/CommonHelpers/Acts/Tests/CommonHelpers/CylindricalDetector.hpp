@@ -0,0 +1,132 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Detector/Detector.hpp"
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Detector/GeometryIdGenerator.hpp"
+#include "Acts/Detector/IndexedRootVolumeFinderBuilder.hpp"
+#include "Acts/Detector/LayerStructureBuilder.hpp"
+#include "Acts/Detector/PortalGenerators.hpp"
+#include "Acts/Detector/detail/CylindricalDetectorHelper.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Navigation/DetectorVolumeFinders.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+/// Share the ownership of surfaces that are held by the detector store
+///
+/// @param surfaces the surfaces to be unpacked
+inline std::vector<std::shared_ptr<Surface>> unpackSurfaces(
+    const std::vector<const Surface*>& surfaces) {
+  std::vector<std::shared_ptr<Surface>> uSurfaces;
+  uSurfaces.reserve(surfaces.size());
+  for (const auto& s : surfaces) {
+    Surface* ncs = const_cast<Surface*>(s);
+    uSurfaces.push_back(ncs->getSharedPtr());
+  }
+  return uSurfaces;
+}
+
+/// Build a cylindrical volume with an indexed layer of surfaces
+///
+/// @param gctx the geometry context
+/// @param name the volume name
+/// @param transform the volume placement
+/// @param halfZ the half length of the volume, the outer radius is 100
+/// @param layerSurfaces the surfaces of the layer
+/// @param binnings the binning of the indexed surface grid
+inline std::shared_ptr<Experimental::DetectorVolume> buildLayerVolume(
+    const GeometryContext& gctx, const std::string& name,
+    const Transform3& transform, ActsScalar halfZ,
+    const std::vector<const Surface*>& layerSurfaces,
+    const std::vector<Experimental::ProtoBinning>& binnings) {
+  Experimental::LayerStructureBuilder::Config lsConfig;
+  lsConfig.surfacesProvider =
+      std::make_shared<Experimental::LayerStructureBuilder::SurfacesHolder>(
+          unpackSurfaces(layerSurfaces));
+  lsConfig.binnings = binnings;
+  Experimental::LayerStructureBuilder builder(
+      lsConfig, getDefaultLogger(name, Logging::INFO));
+  auto [surfaces, volumes, surfacesUpdater, volumeUpdater] =
+      builder.construct(gctx);
+
+  return Experimental::DetectorVolumeFactory::construct(
+      Experimental::defaultPortalGenerator(), gctx, name, transform,
+      std::make_unique<CylinderVolumeBounds>(0., 100., halfZ), surfaces,
+      volumes, std::move(volumeUpdater), std::move(surfacesUpdater));
+}
+
+/// Build a pixel-like barrel with a (z, phi) surface grid between two
+/// endcaps with (phi) surface grids, connected in z
+///
+/// @param gctx the geometry context
+/// @param cGeometry the generator of the surfaces
+/// @param dStore the store of the detector elements
+/// @param indexedRootFinder use an indexed root volume finder instead of
+///        trying all root volumes
+inline std::shared_ptr<Experimental::Detector> buildBarrelEndcapsDetector(
+    const GeometryContext& gctx, CylindricalTrackingGeometry& cGeometry,
+    CylindricalTrackingGeometry::DetectorStore& dStore,
+    bool indexedRootFinder = false) {
+  using Experimental::ProtoBinning;
+
+  std::vector<std::shared_ptr<Experimental::DetectorVolume>> zVolumes;
+  for (int side : {-1, 1}) {
+    zVolumes.push_back(buildLayerVolume(
+        gctx, side < 0 ? "NegativeEndcap" : "PositiveEndcap",
+        Transform3(Translation3(0., 0., side * 600.)), 100.,
+        cGeometry.surfacesRing(dStore, 6.4, 12.4, 36., 0.125, 0., 55.,
+                               side * 600., 2., 22u),
+        {ProtoBinning(binPhi, detail::AxisBoundaryType::Closed, -M_PI, M_PI,
+                      22u, 1u)}));
+  }
+  zVolumes.insert(
+      zVolumes.begin() + 1u,
+      buildLayerVolume(
+          gctx, "Barrel", Transform3::Identity(), 500.,
+          cGeometry.surfacesCylinder(dStore, 8.4, 36., 0.15, 0.145, 72, 3.,
+                                     2., {32u, 14u}),
+          {ProtoBinning(binZ, detail::AxisBoundaryType::Bound, -480., 480.,
+                        14u, 1u),
+           ProtoBinning(binPhi, detail::AxisBoundaryType::Closed, -M_PI,
+                        M_PI, 32u, 1u)}));
+
+  Experimental::detail::CylindricalDetectorHelper::connectInZ(gctx, zVolumes);
+
+  Experimental::GeometryIdGenerator::Config generatorConfig;
+  Experimental::GeometryIdGenerator generator(
+      generatorConfig, getDefaultLogger("GeometryIdGenerator", Logging::INFO));
+  auto cache = generator.generateCache();
+  for (auto& volume : zVolumes) {
+    generator.assignGeometryId(cache, *volume);
+  }
+
+  Experimental::DetectorVolumeUpdater rootFinder =
+      indexedRootFinder
+          ? Experimental::IndexedRootVolumeFinderBuilder({binZ, binR})
+                .construct(gctx, zVolumes)
+          : Experimental::tryRootVolumes();
+  return Experimental::Detector::makeShared("Detector", zVolumes,
+                                            std::move(rootFinder));
+}
+
+}  // namespace Test
+}  // namespace Acts
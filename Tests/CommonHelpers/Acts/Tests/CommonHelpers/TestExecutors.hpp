@@ -0,0 +1,37 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/ParallelExecutor.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Acts::Test {
+
+/// Executor running the tasks serially in reverse order
+///
+/// Results which must not depend on the execution order can be compared
+/// against an empty executor, which runs the tasks in order.
+///
+/// @param executed optional record of the executed task indices, has to
+///        outlive the executor
+inline ParallelExecutor makeReverseExecutor(
+    std::vector<std::size_t>* executed = nullptr) {
+  return [executed](std::size_t nTasks, const ParallelTask& task) {
+    for (std::size_t it = nTasks; it > 0u; --it) {
+      if (executed != nullptr) {
+        executed->push_back(it - 1u);
+      }
+      task(it - 1u);
+    }
+  };
+}
+
+}  // namespace Acts::Test
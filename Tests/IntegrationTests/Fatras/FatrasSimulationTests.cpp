@@ -26,7 +26,9 @@
 #include "ActsFatras/Selectors/SurfaceSelectors.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <random>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -148,16 +150,10 @@ bool containsParticleId(const Container& sortedByParticleId,
                             });
 }
 
-}  // namespace
-
-BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
-                     numParticles) {
-  using namespace Acts::UnitLiterals;
-
-  Acts::GeometryContext geoCtx;
-  Acts::MagneticFieldContext magCtx;
-  Acts::Logging::Level logLevel = Acts::Logging::Level::DEBUG;
-
+/// Build the simulator on the cylindrical test geometry in a constant
+/// magnetic field
+Simulation makeSimulator(const Acts::GeometryContext& geoCtx,
+                         Acts::Logging::Level logLevel) {
   // construct the example detector
   Acts::Test::CylindricalTrackingGeometry geoBuilder(geoCtx);
   auto trackingGeometry = geoBuilder();
@@ -176,19 +172,15 @@ BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
   NeutralSimulation simulatorNeutral(
       std::move(neutralPropagator),
       Acts::getDefaultLogger("NeutralSimulation", logLevel));
-  Simulation simulator(std::move(simulatorCharged),
-                       std::move(simulatorNeutral));
+  return Simulation(std::move(simulatorCharged), std::move(simulatorNeutral));
+}
 
-  // prepare simulation call parameters
-  // random number generator
-  Generator generator;
-  // input/ output particle and hits containers
+/// Create the primary particles of a data-driven test case
+std::vector<ActsFatras::Particle> makeInput(Acts::PdgParticle pdg, double phi,
+                                            double eta, double p,
+                                            int numParticles) {
   std::vector<ActsFatras::Particle> input;
-  std::vector<ActsFatras::Particle> simulatedInitial;
-  std::vector<ActsFatras::Particle> simulatedFinal;
-  std::vector<ActsFatras::Hit> hits;
-
-  // create input particles. particle number should ne non-zero.
+  // particle number should ne non-zero.
   for (auto i = numParticles; 0 < i; --i) {
     const auto pid = ActsFatras::Barcode().setVertexPrimary(42).setParticle(i);
     const auto particle =
@@ -197,16 +189,14 @@ BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
             .setAbsoluteMomentum(p);
     input.push_back(std::move(particle));
   }
-  BOOST_TEST_INFO(input.front());
-  BOOST_CHECK_EQUAL(input.size(), numParticles);
-
-  // run the simulation
-  auto result = simulator.simulate(geoCtx, magCtx, generator, input,
-                                   simulatedInitial, simulatedFinal, hits);
-
-  // should always succeed
-  BOOST_CHECK(result.ok());
+  return input;
+}
 
+/// Check the simulation outputs against the input particles
+void checkOutputs(std::vector<ActsFatras::Particle> input,
+                  std::vector<ActsFatras::Particle> simulatedInitial,
+                  std::vector<ActsFatras::Particle> simulatedFinal,
+                  std::vector<ActsFatras::Hit> hits, Acts::PdgParticle pdg) {
   // ensure simulated particle containers have consistent content
   BOOST_CHECK_EQUAL(simulatedInitial.size(), simulatedFinal.size());
   for (std::size_t i = 0; i < simulatedInitial.size(); ++i) {
@@ -251,3 +241,180 @@ BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
     BOOST_CHECK(containsParticleId(simulatedFinal, hit));
   }
 }
+
+// seed each primary only from its particle id
+Generator makeGenerator(const ActsFatras::Particle& particle) {
+  return Generator(particle.particleId().value());
+}
+
+// run the primaries of the concurrent simulation in order
+void executeForward(std::size_t n,
+                    const std::function<void(std::size_t)>& body) {
+  for (std::size_t i = 0; i < n; ++i) {
+    body(i);
+  }
+}
+
+// run the primaries of the concurrent simulation in reverse order
+void executeBackward(std::size_t n,
+                     const std::function<void(std::size_t)>& body) {
+  for (std::size_t i = n; 0 < i; --i) {
+    body(i - 1);
+  }
+}
+
+}  // namespace
+
+BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
+                     numParticles) {
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  auto simulator = makeSimulator(geoCtx, Acts::Logging::Level::DEBUG);
+
+  // prepare simulation call parameters
+  // random number generator
+  Generator generator;
+  // input/ output particle and hits containers
+  auto input = makeInput(pdg, phi, eta, p, numParticles);
+  std::vector<ActsFatras::Particle> simulatedInitial;
+  std::vector<ActsFatras::Particle> simulatedFinal;
+  std::vector<ActsFatras::Hit> hits;
+  BOOST_TEST_INFO(input.front());
+  BOOST_CHECK_EQUAL(input.size(), numParticles);
+
+  // run the simulation
+  auto result = simulator.simulate(geoCtx, magCtx, generator, input,
+                                   simulatedInitial, simulatedFinal, hits);
+
+  // should always succeed
+  BOOST_CHECK(result.ok());
+  checkOutputs(input, simulatedInitial, simulatedFinal, hits, pdg);
+}
+
+BOOST_DATA_TEST_CASE(FatrasSimulationConcurrently, dataset, pdg, phi, eta, p,
+                     numParticles) {
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  auto simulator = makeSimulator(geoCtx, Acts::Logging::Level::INFO);
+
+  auto input = makeInput(pdg, phi, eta, p, numParticles);
+  BOOST_TEST_INFO(input.front());
+
+  std::vector<ActsFatras::Particle> initialForward;
+  std::vector<ActsFatras::Particle> finalForward;
+  std::vector<ActsFatras::Hit> hitsForward;
+  auto resultForward = simulator.simulateConcurrently(
+      geoCtx, magCtx, makeGenerator, executeForward, input, initialForward,
+      finalForward, hitsForward);
+
+  std::vector<ActsFatras::Particle> initialBackward;
+  std::vector<ActsFatras::Particle> finalBackward;
+  std::vector<ActsFatras::Hit> hitsBackward;
+  auto resultBackward = simulator.simulateConcurrently(
+      geoCtx, magCtx, makeGenerator, executeBackward, input, initialBackward,
+      finalBackward, hitsBackward);
+
+  BOOST_CHECK(resultForward.ok());
+  BOOST_CHECK(resultBackward.ok());
+  checkOutputs(input, initialForward, finalForward, hitsForward, pdg);
+
+  // outputs must not depend on the execution order
+  BOOST_REQUIRE_EQUAL(initialForward.size(), initialBackward.size());
+  BOOST_REQUIRE_EQUAL(finalForward.size(), finalBackward.size());
+  BOOST_REQUIRE_EQUAL(hitsForward.size(), hitsBackward.size());
+  for (std::size_t i = 0; i < finalForward.size(); ++i) {
+    BOOST_CHECK_EQUAL(finalForward[i].particleId(),
+                      finalBackward[i].particleId());
+    BOOST_CHECK_EQUAL(finalForward[i].fourMomentum(),
+                      finalBackward[i].fourMomentum());
+  }
+  for (std::size_t i = 0; i < hitsForward.size(); ++i) {
+    BOOST_CHECK_EQUAL(hitsForward[i].particleId(),
+                      hitsBackward[i].particleId());
+    BOOST_CHECK_EQUAL(hitsForward[i].fourPosition(),
+                      hitsBackward[i].fourPosition());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FatrasSimulationReusedContainers) {
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  auto simulator = makeSimulator(geoCtx, Acts::Logging::Level::INFO);
+
+  std::vector<ActsFatras::Particle> input;
+  for (auto i = 1u; i <= 8u; ++i) {
+    const auto pid = ActsFatras::Barcode().setVertexPrimary(42).setParticle(i);
+    input.push_back(
+        ActsFatras::Particle(pid, Acts::PdgParticle::eElectron)
+            .setDirection(Acts::makeDirectionFromPhiEta(i * 40_degree, 0.5))
+            .setAbsoluteMomentum(10_GeV));
+  }
+
+  // the same containers are used for two simulations of the same event
+  std::vector<ActsFatras::Particle> simulatedInitial;
+  std::vector<ActsFatras::Particle> simulatedFinal;
+  std::vector<ActsFatras::Hit> hits;
+  auto simulateTwice = [&](bool concurrently) {
+    auto simulate = [&]() {
+      simulatedInitial.clear();
+      simulatedFinal.clear();
+      hits.clear();
+      if (concurrently) {
+        return simulator.simulateConcurrently(
+            geoCtx, magCtx, makeGenerator, executeForward, input,
+            simulatedInitial, simulatedFinal, hits);
+      }
+      Generator generator(23);
+      return simulator.simulate(geoCtx, magCtx, generator, input,
+                                simulatedInitial, simulatedFinal, hits);
+    };
+
+    BOOST_CHECK(simulate().ok());
+    const auto firstFinal = simulatedFinal;
+    const auto firstHits = hits;
+    const auto* initialData = simulatedInitial.data();
+    const auto* finalData = simulatedFinal.data();
+    const auto* hitsData = hits.data();
+
+    BOOST_CHECK(simulate().ok());
+    // the second simulation fits into the memory of the first one
+    BOOST_CHECK_EQUAL(simulatedInitial.data(), initialData);
+    BOOST_CHECK_EQUAL(simulatedFinal.data(), finalData);
+    BOOST_CHECK_EQUAL(hits.data(), hitsData);
+
+    // and produces the same output
+    BOOST_CHECK_LT(input.size(), simulatedFinal.size());
+    BOOST_CHECK_LT(0u, hits.size());
+    BOOST_REQUIRE_EQUAL(simulatedFinal.size(), firstFinal.size());
+    BOOST_REQUIRE_EQUAL(hits.size(), firstHits.size());
+    for (std::size_t i = 0; i < simulatedFinal.size(); ++i) {
+      BOOST_CHECK_EQUAL(simulatedFinal[i].particleId(),
+                        firstFinal[i].particleId());
+      BOOST_CHECK_EQUAL(simulatedFinal[i].fourMomentum(),
+                        firstFinal[i].fourMomentum());
+    }
+    for (std::size_t i = 0; i < hits.size(); ++i) {
+      BOOST_CHECK_EQUAL(hits[i].particleId(), firstHits[i].particleId());
+      BOOST_CHECK_EQUAL(hits[i].fourPosition(), firstHits[i].fourPosition());
+    }
+  };
+
+  // the input particles are reserved in the particle containers
+  simulateTwice(false);
+  BOOST_CHECK_LE(input.size(), simulatedInitial.capacity());
+
+  // the concurrent outputs are reserved with their final sizes in the empty
+  // containers
+  simulatedInitial = std::vector<ActsFatras::Particle>();
+  simulatedFinal = std::vector<ActsFatras::Particle>();
+  hits = std::vector<ActsFatras::Hit>();
+  BOOST_CHECK(simulator
+                  .simulateConcurrently(geoCtx, magCtx, makeGenerator,
+                                        executeForward, input,
+                                        simulatedInitial, simulatedFinal, hits)
+                  .ok());
+  BOOST_CHECK_EQUAL(simulatedInitial.capacity(), simulatedInitial.size());
+  BOOST_CHECK_EQUAL(simulatedFinal.capacity(), simulatedFinal.size());
+  BOOST_CHECK_EQUAL(hits.capacity(), hits.size());
+  simulateTwice(true);
+}
@@ -35,6 +35,7 @@
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
 #include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "Acts/Tests/CommonHelpers/TestExecutors.hpp"
 #include "Acts/TrackFitting/GainMatrixSmoother.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
 #include "Acts/TrackFitting/KalmanFitter.hpp"
@@ -383,4 +384,114 @@ BOOST_AUTO_TEST_CASE(ZeroFieldKalmanAlignment) {
       alignZero.align(trajCollection, sParametersCollection, alignOptions);
 
   // BOOST_CHECK(alignRes.ok());
+
+  // The committer is called once, after all detector elements are updated
+  std::size_t nUpdated = 0;
+  std::size_t nCommitted = 0;
+  AlignmentResult updateResult;
+  updateResult.idxedAlignSurfaces = idxedAlignSurfaces;
+  updateResult.deltaAlignmentParameters =
+      ActsDynamicVector::Zero(eAlignmentSize * idxedAlignSurfaces.size());
+  BOOST_REQUIRE(
+      alignZero
+          .updateAlignmentParameters(
+              geoCtx, alignOptions.alignedDetElements,
+              [&](DetectorElementBase* /*element*/,
+                  const GeometryContext& /*gctx*/,
+                  const Transform3& /*transform*/) {
+                ++nUpdated;
+                return true;
+              },
+              updateResult,
+              [&](const GeometryContext& /*gctx*/) {
+                BOOST_CHECK_EQUAL(nUpdated, idxedAlignSurfaces.size());
+                ++nCommitted;
+              })
+          .ok());
+  BOOST_CHECK_EQUAL(nCommitted, 1u);
+
+  // Test the concurrent accumulation with the sparse solver. The rotations
+  // around the first and the third local axis are degenerate for the
+  // telescope, so one of them is fixed to get a unique solution.
+  const AlignmentMask alignMask = AlignmentMask::Center0 |
+                                  AlignmentMask::Center1 |
+                                  AlignmentMask::Center2 |
+                                  AlignmentMask::Rotation0 |
+                                  AlignmentMask::Rotation1;
+  AlignmentResult denseResult;
+  denseResult.idxedAlignSurfaces = idxedAlignSurfaces;
+  BOOST_REQUIRE(alignZero
+                    .calculateAlignmentParameters(
+                        trajCollection, sParametersCollection, kfOptions,
+                        denseResult, alignMask, AlignmentSolver::Dense)
+                    .ok());
+  AlignmentResult sparseResult;
+  sparseResult.idxedAlignSurfaces = idxedAlignSurfaces;
+  BOOST_REQUIRE(alignZero
+                    .calculateAlignmentParameters(
+                        trajCollection, sParametersCollection, kfOptions,
+                        sparseResult, alignMask, AlignmentSolver::SparseLDLT,
+                        Acts::Test::makeReverseExecutor())
+                    .ok());
+  BOOST_CHECK_EQUAL(sparseResult.measurementDim, denseResult.measurementDim);
+  CHECK_CLOSE_REL(sparseResult.chi2, denseResult.chi2, 1e-10);
+  BOOST_REQUIRE_EQUAL(sparseResult.deltaAlignmentParameters.size(),
+                      denseResult.deltaAlignmentParameters.size());
+  CHECK_CLOSE_ABS(sparseResult.deltaAlignmentParameters,
+                  denseResult.deltaAlignmentParameters, 1e-6);
+  CHECK_CLOSE_REL(sparseResult.deltaChi2, denseResult.deltaChi2, 1e-6);
+  BOOST_CHECK_EQUAL(sparseResult.alignmentCovariance.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SparseSolver) {
+  std::mt19937 rng(42);
+  std::normal_distribution<double> gauss(0., 1.);
+  auto random = [&]() { return gauss(rng); };
+
+  // A track crossing the surfaces 0 and 2 out of 3 surfaces
+  auto first = Surface::makeShared<PlaneSurface>(Vector3::Zero(),
+                                                 Vector3::UnitX());
+  auto third = Surface::makeShared<PlaneSurface>(Vector3::UnitX(),
+                                                 Vector3::UnitX());
+  ActsAlignment::detail::TrackAlignmentState alignState;
+  alignState.chi2 = 1;
+  alignState.measurementDim = 4;
+  alignState.alignedSurfaces[first.get()] = {0, 0};
+  alignState.alignedSurfaces[third.get()] = {2, 1};
+  const ActsDynamicMatrix jac =
+      ActsDynamicMatrix::NullaryExpr(2 * eAlignmentSize, 20, random);
+  alignState.alignmentToChi2SecondDerivative = jac * jac.transpose();
+  alignState.alignmentToChi2Derivative =
+      ActsDynamicVector::NullaryExpr(2 * eAlignmentSize, random);
+
+  // Split the contribution over two accumulators
+  ActsAlignment::detail::Chi2DerivativeAccumulator sum(3);
+  ActsAlignment::detail::Chi2DerivativeAccumulator other(3);
+  sum.add(alignState);
+  other.add(alignState);
+  sum.merge(other);
+  BOOST_CHECK_EQUAL(sum.measurementDim, 8);
+  CHECK_CLOSE_REL(sum.chi2, 2, 1e-10);
+
+  const ActsDynamicMatrix dense = sum.denseChi2SecondDerivative();
+  CHECK_CLOSE_ABS(dense, ActsDynamicMatrix(sum.sparseChi2SecondDerivative()),
+                  1e-12);
+
+  // Reference solution of the constrained surfaces only
+  const ActsDynamicVector reference =
+      -alignState.alignmentToChi2SecondDerivative.ldlt().solve(
+          alignState.alignmentToChi2Derivative);
+
+  for (auto solver :
+       {AlignmentSolver::SparseLDLT, AlignmentSolver::ConjugateGradient}) {
+    auto delta = ActsAlignment::detail::solveSparse(
+        sum.sparseChi2SecondDerivative(), sum.chi2Derivative(), solver);
+    BOOST_REQUIRE(delta.has_value());
+    CHECK_CLOSE_ABS(delta->segment<eAlignmentSize>(0),
+                    reference.segment<eAlignmentSize>(0), 1e-6);
+    CHECK_CLOSE_ABS(delta->segment<eAlignmentSize>(eAlignmentSize),
+                    AlignmentVector::Zero(), 1e-12);
+    CHECK_CLOSE_ABS(delta->segment<eAlignmentSize>(2 * eAlignmentSize),
+                    reference.segment<eAlignmentSize>(eAlignmentSize), 1e-6);
+  }
 }
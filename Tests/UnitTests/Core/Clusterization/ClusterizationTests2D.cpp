@@ -248,5 +248,81 @@ BOOST_AUTO_TEST_CASE(Grid_2D_rand) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(Grid_2D_rand_rowscan) {
+  using Cell = Cell2D;
+  using CellC = std::vector<Cell>;
+  using Cluster = Cluster2D;
+  using ClusterC = std::vector<Cluster>;
+
+  std::size_t startSeed = 71902647;
+  std::size_t ntries = 40;
+
+  // The scratch memory is shared by all tries
+  Ccl::RowScanBuffer buffer;
+
+  auto checkEqual = [](ClusterC expected, ClusterC found) {
+    for (Cluster& cl : expected) {
+      hash(cl);
+    }
+    for (Cluster& cl : found) {
+      hash(cl);
+    }
+    std::sort(expected.begin(), expected.end(), clHashComp);
+    std::sort(found.begin(), found.end(), clHashComp);
+    BOOST_CHECK_EQUAL(expected.size(), found.size());
+    for (std::size_t i = 0; i < std::min(expected.size(), found.size());
+         i++) {
+      BOOST_CHECK_EQUAL(expected.at(i).hash, found.at(i).hash);
+    }
+  };
+
+  while (ntries-- > 0) {
+    std::mt19937_64 rnd(startSeed++);
+    // Alternate between a dense label image and sparse hashed pixels
+    int size = ntries % 2 == 0 ? 1000 : 40;
+
+    std::vector<Cluster> cls;
+    std::vector<Cell> cells;
+    for (Rectangle& rect : segment(0, 0, size, size, rnd)) {
+      auto& [x0, y0, x1, y1] = rect;
+      Cluster cl = gencluster(x0, y0, x1, y1, rnd);
+      cells.insert(cells.end(), cl.cells.begin(), cl.cells.end());
+      cls.push_back(cl);
+    }
+    std::shuffle(cells.begin(), cells.end(), rnd);
+
+    // The cell order is kept
+    CellC rowScanCells = cells;
+    ClusterC newCls =
+        Ccl::createClustersRowScan<CellC, ClusterC>(rowScanCells, true,
+                                                    buffer);
+    BOOST_CHECK(rowScanCells == cells);
+    checkEqual(cls, newCls);
+    // The image is empty again after use
+    BOOST_CHECK(std::all_of(buffer.image.begin(), buffer.image.end(),
+                            [](Ccl::Label l) { return l == Ccl::NO_LABEL; }));
+
+    // 4-cell connectivity agrees with the sorted clusterization
+    CellC sortedCells = cells;
+    checkEqual(Ccl::createClusters<CellC, ClusterC>(
+                   sortedCells, Ccl::DefaultConnect<Cell>(false)),
+               Ccl::createClustersRowScan<CellC, ClusterC>(cells, false,
+                                                           buffer));
+
+    // Few clusters far apart are looked up in the hash table
+    if (cls.size() < 2) {
+      continue;
+    }
+    std::vector<Cluster> sparseCls = {cls.front(), cls.back()};
+    CellC sparseCells = sparseCls.front().cells;
+    sparseCells.insert(sparseCells.end(), sparseCls.back().cells.begin(),
+                       sparseCls.back().cells.end());
+    ClusterC sparseNewCls =
+        Ccl::createClustersRowScan<CellC, ClusterC>(sparseCells, true,
+                                                    buffer);
+    checkEqual(sparseCls, sparseNewCls);
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -26,9 +26,11 @@
 #include "Acts/Surfaces/DiscSurface.hpp"
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/TestExecutors.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Enumerate.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
 
 #include <any>
 #include <cmath>
@@ -205,6 +207,47 @@ BOOST_AUTO_TEST_CASE(CylindricaContainerBuildingZ) {
   BOOST_CHECK_EQUAL(portals[3u]->surface().surfaceMaterial(), nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(CylindricaContainerBuildingExecutor) {
+  // Build a triple in z with a given executor
+  auto buildTripleZ = [](const ParallelExecutor& executor) {
+    std::vector<std::shared_ptr<const IDetectorComponentBuilder>> builders;
+    for (auto [iz, name] : enumerate(std::vector<std::string>{
+             "NegativeDisc", "Barrel0", "Barrel1", "PositiveDisc"})) {
+      Transform3 transform = Transform3::Identity();
+      transform.pretranslate(Vector3(0., 0., -300. + iz * 200.));
+      builders.push_back(
+          std::make_shared<
+              CylindricalVolumeBuilder<CylinderSurface, CylinderBounds>>(
+              transform, CylinderVolumeBounds(50., 200., 100.),
+              CylinderBounds(80., 90.), name));
+    }
+    CylindricalContainerBuilder::Config cfg;
+    cfg.builders = builders;
+    cfg.binning = {binZ};
+    cfg.geoIdGenerator = std::make_shared<VolumeGeoIdGenerator>();
+    cfg.executor = executor;
+    return CylindricalContainerBuilder(cfg).construct(tContext);
+  };
+
+  // The executor runs the builders in reverse order
+  std::vector<std::size_t> executed;
+  auto sequential = buildTripleZ(ParallelExecutor{});
+  auto reversed = buildTripleZ(Test::makeReverseExecutor(&executed));
+
+  BOOST_CHECK(executed == std::vector<std::size_t>({3u, 2u, 1u, 0u}));
+  BOOST_CHECK_EQUAL(reversed.portals.size(), sequential.portals.size());
+  BOOST_REQUIRE_EQUAL(reversed.rootVolumes.volumes.size(), 4u);
+  BOOST_REQUIRE_EQUAL(sequential.rootVolumes.volumes.size(), 4u);
+  // Volume order and geometry ids do not depend on the execution order
+  for (std::size_t iv = 0; iv < 4u; ++iv) {
+    const auto& rVolume = reversed.rootVolumes.volumes[iv];
+    const auto& sVolume = sequential.rootVolumes.volumes[iv];
+    BOOST_CHECK_EQUAL(rVolume->name(), sVolume->name());
+    BOOST_CHECK_EQUAL(rVolume->geometryId(), sVolume->geometryId());
+    BOOST_CHECK_EQUAL(rVolume->geometryId().volume(), iv + 1u);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(CylindricaContainerBuildingR) {
   // Declare a barrel builder
   auto barrel0 = std::make_shared<
@@ -0,0 +1,402 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Detector/Detector.hpp"
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Detector/FrozenDetector.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Navigation/DetectorNavigator.hpp"
+#include "Acts/Navigation/DetectorVolumeFinders.hpp"
+#include "Acts/Navigation/DetectorVolumeUpdaters.hpp"
+#include "Acts/Navigation/NavigationState.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalDetector.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Experimental;
+using namespace Acts::UnitLiterals;
+
+GeometryContext tContext;
+MagneticFieldContext mfContext;
+Test::CylindricalTrackingGeometry cGeometry =
+    Test::CylindricalTrackingGeometry(tContext);
+
+namespace {
+
+/// The candidate surfaces of the original navigation delegates
+std::vector<const Surface*> delegateCandidates(const Detector& detector,
+                                               const DetectorVolume& volume,
+                                               const Vector3& position,
+                                               const Vector3& direction) {
+  NavigationState nState;
+  nState.currentDetector = &detector;
+  nState.position = position;
+  nState.direction = direction;
+  volume.updateNavigationState(tContext, nState);
+  std::vector<const Surface*> candidates;
+  for (const auto& c : nState.surfaceCandidates) {
+    candidates.push_back(c.surface != nullptr ? c.surface
+                                              : &c.portal->surface());
+  }
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+/// The candidate surfaces of the frozen detector
+std::vector<const Surface*> frozenCandidates(const FrozenDetector& frozen,
+                                             FrozenDetector::Index volume,
+                                             const Vector3& position,
+                                             const Vector3& direction) {
+  FrozenDetector::Candidates fCandidates;
+  frozen.fillCandidates(tContext, volume, position, direction,
+                        BoundaryCheck(true), -100_um, fCandidates);
+  BOOST_CHECK(std::is_sorted(
+      fCandidates.begin(), fCandidates.end(), [](const auto& a, const auto& b) {
+        return a.objectIntersection.pathLength() <
+               b.objectIntersection.pathLength();
+      }));
+  std::vector<const Surface*> candidates;
+  for (const auto& c : fCandidates) {
+    candidates.push_back(&frozen.candidateSurface(c));
+  }
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+std::string loadContent(const std::string& fileName) {
+  std::ifstream is(fileName, std::ios::binary);
+  return {std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+}
+
+void saveContent(const std::string& fileName, const std::string& content) {
+  std::ofstream os(fileName, std::ios::binary);
+  os.write(content.data(), content.size());
+}
+
+std::vector<Vector3> testDirections() {
+  std::vector<Vector3> directions;
+  for (double eta : {-2., -1., -0.3, 0., 0.4, 1.2, 2.5}) {
+    for (double phi : {-3., -1.5, 0.1, 0.8, 2.}) {
+      const double theta = 2. * std::atan(std::exp(-eta));
+      directions.emplace_back(std::cos(phi) * std::sin(theta),
+                              std::sin(phi) * std::sin(theta),
+                              std::cos(theta));
+    }
+  }
+  return directions;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Experimental)
+
+BOOST_AUTO_TEST_CASE(FrozenDetectorStructure) {
+  Test::CylindricalTrackingGeometry::DetectorStore dStore;
+  auto detector =
+      Test::buildBarrelEndcapsDetector(tContext, cGeometry, dStore, true);
+
+  FrozenDetector frozen(*detector);
+
+  BOOST_CHECK_EQUAL(frozen.volumes().size(), 3u);
+  BOOST_CHECK_EQUAL(frozen.numberOfSurfaces(), 448u + 2u * 22u);
+  for (std::size_t iv = 0; iv < 3u; ++iv) {
+    BOOST_CHECK_EQUAL(frozen.volume(iv), detector->volumes()[iv]);
+  }
+
+  // The indexed delegates are compiled, none is kept as fallback
+  BOOST_CHECK(frozen.rootVolumeLink().type == FrozenDetector::LinkType::Grid);
+  for (const auto& volume : frozen.volumes()) {
+    BOOST_CHECK(volume.candidates ==
+                FrozenDetector::CandidatesType::PortalsAndGrid);
+  }
+  std::size_t nSingle = 0;
+  std::size_t nGrid = 0;
+  for (const auto& portal : frozen.portals()) {
+    for (const auto& link : portal.links) {
+      BOOST_CHECK(link.type != FrozenDetector::LinkType::Delegate);
+      nSingle += link.type == FrozenDetector::LinkType::Volume ? 1u : 0u;
+      nGrid += link.type == FrozenDetector::LinkType::Grid ? 1u : 0u;
+    }
+  }
+  BOOST_CHECK_GT(nSingle, 0u);
+  BOOST_CHECK_GT(nGrid, 0u);
+
+  // Volume finding agrees with the delegates
+  for (double z : {-690., -550., -499., 0., 123., 480., 501., 650.}) {
+    for (double r : {0., 20., 72., 99.}) {
+      const Vector3 position(r * std::cos(0.3), r * std::sin(0.3), z);
+      auto index = frozen.findVolume(tContext, position);
+      BOOST_REQUIRE_NE(index, FrozenDetector::s_noIndex);
+      BOOST_CHECK_EQUAL(frozen.volume(index),
+                        detector->findDetectorVolume(tContext, position));
+    }
+  }
+
+  // Candidates agree with the delegates
+  for (const auto& position :
+       {Vector3(0., 0., 0.), Vector3(10., -5., 200.), Vector3(50., 30., -450.),
+        Vector3(0., 0., -600.)}) {
+    auto index = frozen.findVolume(tContext, position);
+    for (const auto& direction : testDirections()) {
+      BOOST_CHECK(frozenCandidates(frozen, index, position, direction) ==
+                  delegateCandidates(*detector, *frozen.volume(index),
+                                     position, direction));
+    }
+  }
+
+  // Portal links agree with the delegates
+  for (FrozenDetector::Index ip = 0; ip < frozen.portals().size(); ++ip) {
+    const auto* portal = frozen.portal(ip);
+    const Vector3 position =
+        portal->surface().center(tContext) + Vector3(10., 5., 0.);
+    const Vector3 normal = portal->surface().normal(tContext, position);
+    for (const auto& direction : {normal, Vector3(-normal)}) {
+      NavigationState nState;
+      nState.currentDetector = detector.get();
+      nState.position = position;
+      nState.direction = direction;
+      portal->updateDetectorVolume(tContext, nState);
+      auto target = frozen.portalTarget(tContext, ip, position, direction);
+      BOOST_CHECK_EQUAL(target != FrozenDetector::s_noIndex
+                            ? frozen.volume(target)
+                            : nullptr,
+                        nState.currentVolume);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FrozenDetectorSaveLoad) {
+  Test::CylindricalTrackingGeometry::DetectorStore dStore;
+  auto detector =
+      Test::buildBarrelEndcapsDetector(tContext, cGeometry, dStore, true);
+
+  FrozenDetector frozen(*detector);
+  const std::string fileName =
+      (std::filesystem::temp_directory_path() / "FrozenDetectorTests.bin")
+          .string();
+  frozen.save(fileName);
+
+  // The output is reproducible
+  const std::string copyName = fileName + ".copy";
+  FrozenDetector::load(fileName, *detector).save(copyName);
+  BOOST_CHECK(loadContent(copyName) == loadContent(fileName));
+  std::remove(copyName.c_str());
+
+  auto loaded = FrozenDetector::load(fileName, *detector);
+  BOOST_CHECK_EQUAL(loaded.volumes().size(), frozen.volumes().size());
+  BOOST_CHECK_EQUAL(loaded.portals().size(), frozen.portals().size());
+  BOOST_CHECK_EQUAL(loaded.grids().size(), frozen.grids().size());
+
+  const Vector3 position(10., -5., 200.);
+  auto index = loaded.findVolume(tContext, position);
+  BOOST_CHECK_EQUAL(index, frozen.findVolume(tContext, position));
+  for (const auto& direction : testDirections()) {
+    BOOST_CHECK(frozenCandidates(loaded, index, position, direction) ==
+                frozenCandidates(frozen, index, position, direction));
+  }
+
+  // A different detector is rejected
+  Test::CylindricalTrackingGeometry::DetectorStore otherStore;
+  auto other =
+      Test::buildBarrelEndcapsDetector(tContext, cGeometry, otherStore);
+  other->volumePtrs()[1u]->surfacePtrs().front()->assignGeometryId(
+      GeometryIdentifier().setVolume(42u));
+  BOOST_CHECK_THROW(FrozenDetector::load(fileName, *other),
+                    std::invalid_argument);
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(FrozenDetectorCorruptInput) {
+  Test::CylindricalTrackingGeometry::DetectorStore dStore;
+  auto detector =
+      Test::buildBarrelEndcapsDetector(tContext, cGeometry, dStore, true);
+
+  FrozenDetector frozen(*detector);
+  const std::string fileName =
+      (std::filesystem::temp_directory_path() / "FrozenDetectorCorrupt.bin")
+          .string();
+  frozen.save(fileName);
+  const std::string content = loadContent(fileName);
+
+  auto loadCorrupted = [&](const std::string& corrupted) {
+    saveContent(fileName, corrupted);
+    return FrozenDetector::load(fileName, *detector);
+  };
+
+  // Truncated and trailing input
+  for (std::size_t size = 8u; size < content.size(); size += 101u) {
+    BOOST_CHECK_THROW(loadCorrupted(content.substr(0u, size)),
+                      std::runtime_error);
+  }
+  BOOST_CHECK_THROW(loadCorrupted(content + '\0'), std::runtime_error);
+
+  // The root volume link is the last entry: an unknown type and a grid
+  // index out of range
+  const std::size_t rootLink = content.size() - 5u;
+  std::string badType = content;
+  badType[rootLink] = 7;
+  BOOST_CHECK_THROW(loadCorrupted(badType), std::runtime_error);
+  std::string badGrid = content;
+  badGrid.replace(rootLink + 1u, 4u, "\xff\xff\xff\x7f");
+  BOOST_CHECK_THROW(loadCorrupted(badGrid), std::runtime_error);
+
+  // The first portal index of the first volume out of range, it follows the
+  // format identifier, the geometry identifiers, the volume and the portal
+  // entries, and the array sizes
+  const std::size_t volumePortals =
+      8u + 6u * 8u +
+      8u * (frozen.volumes().size() + frozen.portals().size() +
+            frozen.numberOfSurfaces()) +
+      21u * frozen.volumes().size() + 10u * frozen.portals().size();
+  std::string badPortal = content;
+  badPortal.replace(volumePortals, 4u, "\xff\xff\x00\x00", 4u);
+  BOOST_CHECK_THROW(loadCorrupted(badPortal), std::runtime_error);
+
+  // The uncorrupted content still loads
+  BOOST_CHECK_NO_THROW(loadCorrupted(content));
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(FrozenDetectorNavigation) {
+  Test::CylindricalTrackingGeometry::DetectorStore dStore;
+  // The root volumes are tried, which is not compiled and used as fallback
+  auto detector = Test::buildBarrelEndcapsDetector(tContext, cGeometry, dStore);
+
+  FrozenDetector frozen(*detector);
+  BOOST_CHECK(frozen.rootVolumeLink().type ==
+              FrozenDetector::LinkType::Delegate);
+
+  using ActionListType = ActionList<SurfaceCollector<>>;
+  using AbortListType = AbortList<>;
+
+  DetectorNavigator::Config navCfg;
+  navCfg.detector = detector.get();
+  Propagator<StraightLineStepper, DetectorNavigator> propagator{
+      StraightLineStepper(), DetectorNavigator(navCfg)};
+
+  DetectorNavigator::Config frozenNavCfg = navCfg;
+  frozenNavCfg.frozenDetector = &frozen;
+  Propagator<StraightLineStepper, DetectorNavigator> frozenPropagator{
+      StraightLineStepper(), DetectorNavigator(frozenNavCfg)};
+
+  PropagatorOptions<ActionListType, AbortListType> options(tContext,
+                                                           mfContext);
+  options.pathLimit = 1_m;
+
+  std::size_t nHits = 0;
+  for (const auto& direction : testDirections()) {
+    // Start close to the barrel, the surface grid is looked up at the start
+    const Vector3 transverse = Vector3(direction.x(), direction.y(), 0.);
+    const Vector3 position = 60. * transverse.normalized();
+    CurvilinearTrackParameters start(
+        Vector4(position.x(), position.y(), position.z(), 0.), direction,
+        1_e / 1_GeV, std::nullopt, ParticleHypothesis::pion());
+
+    auto result = propagator.propagate(start, options);
+    auto frozenResult = frozenPropagator.propagate(start, options);
+    BOOST_REQUIRE(result.ok());
+    BOOST_REQUIRE(frozenResult.ok());
+
+    const auto& hits =
+        result->get<SurfaceCollector<>::result_type>().collected;
+    const auto& frozenHits =
+        frozenResult->get<SurfaceCollector<>::result_type>().collected;
+    BOOST_REQUIRE_EQUAL(hits.size(), frozenHits.size());
+    for (std::size_t i = 0; i < hits.size(); ++i) {
+      BOOST_CHECK_EQUAL(hits[i].surface, frozenHits[i].surface);
+    }
+    nHits += hits.size();
+  }
+  BOOST_CHECK_GT(nHits, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(FrozenDetectorLeaveWorld) {
+  Test::CylindricalTrackingGeometry::DetectorStore dStore;
+  // The root volumes are tried, which finds no volume outside the world
+  auto detector = Test::buildBarrelEndcapsDetector(tContext, cGeometry, dStore);
+
+  // The portals out of the world try the root volumes as well
+  std::size_t nOuter = 0;
+  for (auto& volume : detector->volumePtrs()) {
+    for (auto& portal : volume->portalPtrs()) {
+      for (Direction dir : {Direction::Backward, Direction::Forward}) {
+        const auto& updater = portal->detectorVolumeUpdaters()[dir.index()];
+        if (!updater.connected() ||
+            dynamic_cast<const EndOfWorldImpl*>(updater.instance()) !=
+                nullptr) {
+          portal->assignDetectorVolumeUpdater(dir, tryRootVolumes(), {});
+          ++nOuter;
+        }
+      }
+    }
+  }
+  BOOST_REQUIRE_GT(nOuter, 0u);
+
+  FrozenDetector frozen(*detector);
+  BOOST_CHECK(frozen.rootVolumeLink().type ==
+              FrozenDetector::LinkType::Delegate);
+
+  for (const auto& position :
+       {Vector3(0., 0., 2_m), Vector3(0., 0., -2_m), Vector3(1_m, 0., 0.)}) {
+    BOOST_CHECK_EQUAL(frozen.findVolume(tContext, position),
+                      FrozenDetector::s_noIndex);
+    BOOST_CHECK_EQUAL(frozen.findDetectorVolume(tContext, position), nullptr);
+  }
+
+  // Step through the portals out of the world
+  std::size_t nLeaving = 0;
+  for (FrozenDetector::Index ip = 0; ip < frozen.portals().size(); ++ip) {
+    const auto* portal = frozen.portal(ip);
+    const Vector3 onSurface =
+        portal->surface().binningPosition(tContext, binR);
+    const Vector3 normal = portal->surface().normal(tContext, onSurface);
+    for (const auto& direction : {normal, Vector3(-normal)}) {
+      // Just behind the portal, the root volumes are not found outside
+      const Vector3 position = onSurface + 1_mm * direction;
+      NavigationState nState;
+      nState.currentDetector = detector.get();
+      nState.position = position;
+      nState.direction = direction;
+      portal->updateDetectorVolume(tContext, nState);
+      auto target = frozen.portalTarget(tContext, ip, position, direction);
+      BOOST_CHECK_EQUAL(target != FrozenDetector::s_noIndex
+                            ? frozen.volume(target)
+                            : nullptr,
+                        nState.currentVolume);
+      nLeaving += target == FrozenDetector::s_noIndex ? 1u : 0u;
+    }
+  }
+  BOOST_CHECK_GT(nLeaving, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
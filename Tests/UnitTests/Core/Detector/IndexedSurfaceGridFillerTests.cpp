@@ -19,6 +19,7 @@
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/TestExecutors.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Enumerate.hpp"
 #include "Acts/Utilities/Grid.hpp"
@@ -333,4 +334,46 @@ BOOST_AUTO_TEST_CASE(IndexGridZPhiYOneSurfaceMPIPolyhedronBinExpansion) {
   BOOST_CHECK_EQUAL(nonEmptyBins, 9u);
 }
 
+BOOST_AUTO_TEST_CASE(IndexGridZPhiYMultiSurfaceExecutor) {
+  ACTS_LOCAL_LOGGER(getDefaultLogger("*** Test 5", logLevel));
+  ACTS_INFO("Testing Phi-Z grid.");
+  ACTS_INFO("Testing several surfaces filled with an executor");
+
+  // z-phi Axes & Grid
+  Axis<AxisType::Equidistant, AxisBoundaryType::Bound> axisZ(-9., 9., 9);
+  Axis<AxisType::Equidistant, AxisBoundaryType::Closed> axisPhi(-M_PI, M_PI,
+                                                                36);
+  using GridType =
+      Grid<std::vector<unsigned int>, decltype(axisZ), decltype(axisPhi)>;
+
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  for (unsigned int is = 0; is < 8u; ++is) {
+    auto cBounds = std::make_shared<CylinderBounds>(10, 2., M_PI / 10, 0.);
+    auto tf = AngleAxis3(is * M_PI / 4, Vector3::UnitZ()) *
+              Transform3(Translation3(0., 0., -6. + 1.5 * is));
+    surfaces.push_back(
+        Surface::makeShared<CylinderSurface>(tf, std::move(cBounds)));
+  }
+  PolyhedronReferenceGenerator<1u, true> generator;
+
+  // Sequential fill
+  IndexedSurfacesImpl<GridType> sequentialGrid(GridType({axisZ, axisPhi}),
+                                               {binZ, binPhi});
+  IndexedGridFiller sequentialFiller{{0u, 1u}};
+  sequentialFiller.fill(tContext, sequentialGrid, surfaces, generator);
+
+  // Fill with an executor that runs the tasks in reverse order
+  IndexedSurfacesImpl<GridType> executorGrid(GridType({axisZ, axisPhi}),
+                                             {binZ, binPhi});
+  IndexedGridFiller executorFiller{{0u, 1u}};
+  executorFiller.executor = Test::makeReverseExecutor();
+  executorFiller.fill(tContext, executorGrid, surfaces, generator);
+
+  BOOST_CHECK_GT(countBins(sequentialGrid), 0u);
+  BOOST_REQUIRE_EQUAL(sequentialGrid.grid.size(), executorGrid.grid.size());
+  for (std::size_t igb = 0u; igb < sequentialGrid.grid.size(); ++igb) {
+    BOOST_CHECK(sequentialGrid.grid.at(igb) == executorGrid.grid.at(igb));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
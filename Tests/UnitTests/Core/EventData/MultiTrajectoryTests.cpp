@@ -15,6 +15,7 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/ProxyAccessor.hpp"
+#include "Acts/EventData/SourceLinkTable.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
@@ -27,6 +28,7 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
 #include <ostream>
 #include <random>
 #include <stdexcept>
@@ -63,6 +65,20 @@ struct Factory {
 
 using CommonTests = MultiTrajectoryTestsCommon<Factory>;
 
+struct SourceLinkTableFactory {
+  using trajectory_t = VectorMultiTrajectory;
+  using const_trajectory_t = ConstVectorMultiTrajectory;
+
+  VectorMultiTrajectory create() {
+    return VectorMultiTrajectory{std::make_shared<SourceLinkTable>()};
+  }
+  ConstVectorMultiTrajectory createConst() { return {}; }
+};
+
+SourceLinkTable::Handle lookupTestSourceLink(const SourceLink& sourceLink) {
+  return sourceLink.get<TestSourceLink>().sourceId;
+}
+
 }  // namespace
 
 BOOST_AUTO_TEST_SUITE(EventDataMultiTrajectory)
@@ -273,4 +289,151 @@ BOOST_AUTO_TEST_CASE(Accessors) {
   // superChi2Const(ts) = 66.66;
 }
 
+BOOST_AUTO_TEST_CASE(StorageReuse) {
+  VectorMultiTrajectory mtj;
+  mtj.reserve(100);
+  BOOST_CHECK_GE(mtj.capacity(), 100u);
+
+  auto fill = [&]() {
+    for (std::size_t i = 0; i < 5000; ++i) {
+      auto ts = mtj.getTrackState(mtj.addTrackState());
+      const std::size_t measdim = 1 + i % eBoundSize;
+      ts.allocateCalibrated(measdim);
+      ts.effectiveCalibrated().setConstant(i);
+      ts.effectiveCalibratedCovariance().setConstant(i);
+    }
+  };
+
+  fill();
+  const std::size_t grown = mtj.capacity();
+  BOOST_CHECK_GE(grown, 5000u);
+  const double* predicted = mtj.getTrackState(0).predicted().data();
+  const double* calibrated =
+      mtj.getTrackState(4999).effectiveCalibrated().data();
+
+  // The storage is kept on clear, and refilling it does not reallocate
+  mtj.clear();
+  BOOST_CHECK_EQUAL(mtj.size(), 0u);
+  BOOST_CHECK_EQUAL(mtj.capacity(), grown);
+
+  fill();
+  BOOST_CHECK_EQUAL(mtj.capacity(), grown);
+  BOOST_CHECK_EQUAL(mtj.getTrackState(0).predicted().data(), predicted);
+  BOOST_CHECK_EQUAL(mtj.getTrackState(4999).effectiveCalibrated().data(),
+                    calibrated);
+
+  for (std::size_t i = 0; i < mtj.size(); ++i) {
+    auto ts = mtj.getTrackState(i);
+    const std::size_t measdim = 1 + i % eBoundSize;
+    BOOST_REQUIRE_EQUAL(ts.calibratedSize(), measdim);
+    for (std::size_t j = 0; j < measdim; ++j) {
+      BOOST_CHECK_EQUAL(ts.effectiveCalibrated()[j], static_cast<double>(i));
+      BOOST_CHECK_EQUAL(ts.effectiveCalibratedCovariance()(j, measdim - 1),
+                        static_cast<double>(i));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SourceLinkTableStorage) {
+  MultiTrajectoryTestsCommon<SourceLinkTableFactory> ct;
+  ct.testTrackStateProxyCrossTalk(rng);
+  ct.testTrackStateReassignment(rng);
+  ct.testTrackStateProxyCopy(rng);
+  ct.testTrackStateProxyCopyDiffMTJ();
+
+  // One source link per measurement, found again from its source id
+  SourceLinkTable::Lookup lookup;
+  lookup.connect<&lookupTestSourceLink>();
+  auto table = std::make_shared<SourceLinkTable>(std::move(lookup));
+  for (std::size_t i = 0; i < 10; ++i) {
+    TestSourceLink sl(eBoundLoc0, 0.1, 0.01, GeometryIdentifier(i + 1), i);
+    BOOST_CHECK_EQUAL(table->insert(SourceLink{sl}), i);
+  }
+
+  VectorMultiTrajectory mtj(table);
+  BOOST_CHECK_EQUAL(mtj.sourceLinkTable(), table);
+  mtj.reserve(100);
+  auto ts = mtj.getTrackState(mtj.addTrackState());
+  BOOST_CHECK(!ts.hasUncalibratedSourceLink());
+
+  // Source links which are already in the table are not copied
+  ts.setUncalibratedSourceLink(SourceLink{table->at(3)});
+  BOOST_CHECK_EQUAL(table->size(), 10u);
+  BOOST_CHECK_EQUAL(mtj.uncalibratedSourceLinkHandle(ts.index()), 3u);
+  TestSourceLink other(eBoundLoc1, 0.2, 0.01, GeometryIdentifier(11),
+                       SourceLinkTable::kInvalidHandle);
+  ts.setUncalibratedSourceLink(SourceLink{other});
+  BOOST_CHECK_EQUAL(table->size(), 11u);
+  BOOST_CHECK(ts.getUncalibratedSourceLink().get<TestSourceLink>() == other);
+
+  // Storing the handles does not allocate, even for large source links
+#if defined(_ACTS_ANY_ENABLE_COUNT_ALLOCATIONS)
+  const AnyHeapAllocations before = anyHeapAllocations();
+#endif
+  for (std::size_t i = 0; i < 100; ++i) {
+    auto state = mtj.getTrackState(mtj.addTrackState());
+    mtj.setUncalibratedSourceLinkHandle(state.index(), i % 10);
+    BOOST_CHECK(state.hasUncalibratedSourceLink());
+    BOOST_CHECK_EQUAL(
+        table->at(mtj.uncalibratedSourceLinkHandle(state.index()))
+            .get<TestSourceLink>()
+            .sourceId,
+        i % 10);
+  }
+#if defined(_ACTS_ANY_ENABLE_COUNT_ALLOCATIONS)
+  const AnyHeapAllocations after = anyHeapAllocations();
+  BOOST_CHECK_EQUAL(after.allocations, before.allocations);
+  BOOST_CHECK_EQUAL(after.deallocations, before.deallocations);
+#endif
+
+  // The table is kept when the trajectory is cleared or copied
+  VectorMultiTrajectory copy = mtj;
+  BOOST_CHECK_EQUAL(copy.sourceLinkTable(), table);
+  mtj.clear();
+  BOOST_CHECK_EQUAL(table->size(), 11u);
+  BOOST_CHECK(copy.getTrackState(1).getUncalibratedSourceLink()
+                  .get<TestSourceLink>() ==
+              table->at(0).get<TestSourceLink>());
+  BOOST_CHECK_EQUAL(&copy.uncalibratedSourceLink(1), &table->at(0));
+}
+
+BOOST_AUTO_TEST_CASE(SourceLinkTableCopy) {
+  // No lookup, every source link set by value is added to the table
+  auto table = std::make_shared<SourceLinkTable>();
+  VectorMultiTrajectory source(table);
+  for (std::size_t i = 0; i < 5; ++i) {
+    auto ts = source.getTrackState(source.addTrackState());
+    ts.setUncalibratedSourceLink(SourceLink{
+        TestSourceLink(eBoundLoc0, 0.1, 0.01, GeometryIdentifier(i + 1), i)});
+  }
+  BOOST_CHECK_EQUAL(table->size(), 5u);
+
+  // Copying into a trajectory with the same table only copies the handles
+  VectorMultiTrajectory shared(table);
+  for (std::size_t i = 0; i < 5; ++i) {
+    auto ts = shared.getTrackState(shared.addTrackState());
+    ts.copyFrom(source.getTrackState(i), TrackStatePropMask::Predicted);
+    BOOST_CHECK_EQUAL(shared.uncalibratedSourceLinkHandle(ts.index()),
+                      source.uncalibratedSourceLinkHandle(i));
+  }
+  BOOST_CHECK_EQUAL(table->size(), 5u);
+
+  // With another table or without one, the source links are copied
+  auto otherTable = std::make_shared<SourceLinkTable>();
+  VectorMultiTrajectory other(otherTable);
+  VectorMultiTrajectory plain;
+  for (std::size_t i = 0; i < 5; ++i) {
+    other.getTrackState(other.addTrackState())
+        .copyFrom(source.getTrackState(i), TrackStatePropMask::Predicted);
+    plain.getTrackState(plain.addTrackState())
+        .copyFrom(source.getTrackState(i), TrackStatePropMask::Predicted);
+    BOOST_CHECK(other.uncalibratedSourceLink(i).get<TestSourceLink>() ==
+                table->at(i).get<TestSourceLink>());
+    BOOST_CHECK(plain.uncalibratedSourceLink(i).get<TestSourceLink>() ==
+                table->at(i).get<TestSourceLink>());
+  }
+  BOOST_CHECK_EQUAL(table->size(), 5u);
+  BOOST_CHECK_EQUAL(otherTable->size(), 5u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Detector/Detector.hpp"
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Navigation/DetectorNavigator.hpp"
+#include "Acts/Navigation/NavigationState.hpp"
+#include "Acts/Navigation/StaticNavigationPolicy.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalDetector.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <cmath>
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Experimental;
+using namespace Acts::UnitLiterals;
+
+GeometryContext tContext;
+MagneticFieldContext mfContext;
+Test::CylindricalTrackingGeometry cGeometry =
+    Test::CylindricalTrackingGeometry(tContext);
+
+BOOST_AUTO_TEST_SUITE(Experimental)
+
+BOOST_AUTO_TEST_CASE(StaticNavigationPolicyResolution) {
+  Test::CylindricalTrackingGeometry::DetectorStore dStore;
+  auto detector = Test::buildBarrelEndcapsDetector(tContext, cGeometry, dStore);
+
+  StaticNavigationPolicy policy(*detector);
+
+  // All volumes and portals are resolved, portals are shared
+  std::set<const Portal*> portals;
+  for (const auto* volume : detector->volumes()) {
+    portals.insert(volume->portals().begin(), volume->portals().end());
+  }
+  BOOST_CHECK_EQUAL(policy.resolvedVolumes(), 3u);
+  BOOST_CHECK_EQUAL(policy.resolvedPortals(), portals.size());
+
+  // The candidates agree with the delegates
+  for (const auto& position : {Vector3(60., 0., 0.), Vector3(0., 70., 300.),
+                               Vector3(40., 20., -620.)}) {
+    const auto* volume = detector->findDetectorVolume(tContext, position);
+    BOOST_REQUIRE(volume != nullptr);
+    for (double phi : {-2.5, -0.4, 1.1}) {
+      for (double theta : {0.3, 1.2, 1.9, 2.8}) {
+        NavigationState delegateState;
+        delegateState.currentDetector = detector.get();
+        delegateState.currentVolume = volume;
+        delegateState.position = position;
+        delegateState.direction =
+            Vector3(std::cos(phi) * std::sin(theta),
+                    std::sin(phi) * std::sin(theta), std::cos(theta));
+        NavigationState policyState = delegateState;
+
+        volume->updateNavigationState(tContext, delegateState);
+        policy.updateNavigationState(tContext, policyState);
+
+        BOOST_REQUIRE_EQUAL(policyState.surfaceCandidates.size(),
+                            delegateState.surfaceCandidates.size());
+        for (std::size_t i = 0; i < policyState.surfaceCandidates.size();
+             ++i) {
+          const auto& pc = policyState.surfaceCandidates[i];
+          const auto& dc = delegateState.surfaceCandidates[i];
+          BOOST_CHECK_EQUAL(pc.surface, dc.surface);
+          BOOST_CHECK_EQUAL(pc.portal, dc.portal);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(StaticNavigationPolicyNavigation) {
+  Test::CylindricalTrackingGeometry::DetectorStore dStore;
+  auto detector = Test::buildBarrelEndcapsDetector(tContext, cGeometry, dStore);
+
+  StaticNavigationPolicy policy(*detector);
+
+  using ActionListType = ActionList<SurfaceCollector<>>;
+  using AbortListType = AbortList<>;
+
+  DetectorNavigator::Config navCfg;
+  navCfg.detector = detector.get();
+  Propagator<StraightLineStepper, DetectorNavigator> propagator{
+      StraightLineStepper(), DetectorNavigator(navCfg)};
+
+  DetectorNavigator::Config staticNavCfg = navCfg;
+  staticNavCfg.staticPolicy = &policy;
+  Propagator<StraightLineStepper, DetectorNavigator> staticPropagator{
+      StraightLineStepper(), DetectorNavigator(staticNavCfg)};
+
+  PropagatorOptions<ActionListType, AbortListType> options(tContext,
+                                                           mfContext);
+  options.pathLimit = 1_m;
+
+  std::size_t nHits = 0;
+  for (double eta : {-2.5, -1., 0., 0.5, 2.}) {
+    for (double phi : {-3., -1., 0.2, 1.7}) {
+      const double theta = 2. * std::atan(std::exp(-eta));
+      const Vector3 direction(std::cos(phi) * std::sin(theta),
+                              std::sin(phi) * std::sin(theta),
+                              std::cos(theta));
+      // Start close to the layers, the surface grids are looked up at start
+      const Vector3 position(60. * std::cos(phi), 60. * std::sin(phi), 0.);
+      CurvilinearTrackParameters start(
+          Vector4(position.x(), position.y(), position.z(), 0.), direction,
+          1_e / 1_GeV, std::nullopt, ParticleHypothesis::pion());
+
+      auto result = propagator.propagate(start, options);
+      auto staticResult = staticPropagator.propagate(start, options);
+      BOOST_REQUIRE(result.ok());
+      BOOST_REQUIRE(staticResult.ok());
+
+      const auto& hits =
+          result->get<SurfaceCollector<>::result_type>().collected;
+      const auto& staticHits =
+          staticResult->get<SurfaceCollector<>::result_type>().collected;
+      BOOST_REQUIRE_EQUAL(hits.size(), staticHits.size());
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+        BOOST_CHECK_EQUAL(hits[i].surface, staticHits[i].surface);
+      }
+      nHits += hits.size();
+    }
+  }
+  BOOST_CHECK_GT(nHits, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
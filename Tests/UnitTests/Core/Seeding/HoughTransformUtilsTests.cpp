@@ -0,0 +1,146 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/HoughTransformUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+namespace Acts::Test {
+
+using namespace Acts::HoughTransformUtils;
+
+namespace {
+
+/// A straight line y = y0 + slope * x, with its uncertainty
+struct Line {
+  double y0 = 0;
+  double slope = 0;
+  double width = 0;
+};
+
+/// Reference bin content with the unique hits and layers of the bin
+struct ReferenceCell {
+  std::unordered_set<unsigned> hits;
+  std::unordered_set<unsigned> layers;
+
+  void fill(unsigned id, unsigned layer) {
+    hits.insert(id);
+    layers.insert(layer);
+  }
+  YieldType nHits() const { return hits.size(); }
+  YieldType nLayers() const { return layers.size(); }
+};
+
+/// Reference fill with one cell per bin
+void referenceFill(std::vector<ReferenceCell>& cells,
+                   const HoughPlaneConfig& cfg, const HoughAxisRanges& ranges,
+                   const Line& line, double sign, unsigned id,
+                   unsigned layer) {
+  for (std::size_t xBin = 0; xBin < cfg.nBinsX; ++xBin) {
+    double x = binCenter(ranges.xMin, ranges.xMax, cfg.nBinsX, xBin);
+    double y = line.y0 + sign * line.slope * x;
+    int yDown = binIndex(ranges.yMin, ranges.yMax, cfg.nBinsY, y - line.width);
+    int yUp = binIndex(ranges.yMin, ranges.yMax, cfg.nBinsY, y + line.width);
+    for (int yBin = yDown; yBin <= yUp; ++yBin) {
+      if (yBin < 0 || yBin >= static_cast<int>(cfg.nBinsY)) {
+        continue;
+      }
+      cells[xBin * cfg.nBinsY + yBin].fill(id, layer);
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(HoughTransformUtils)
+
+BOOST_AUTO_TEST_CASE(HoughPlaneFillMatchesCells) {
+  HoughPlaneConfig cfg;
+  cfg.nBinsX = 40;
+  cfg.nBinsY = 60;
+  HoughAxisRanges ranges{-1., 1., -10., 10.};
+
+  HoughPlane<unsigned> plane(cfg);
+  std::vector<ReferenceCell> cells(cfg.nBinsX * cfg.nBinsY);
+
+  auto linePos = [](double x, const Line& line) {
+    return line.y0 + line.slope * x;
+  };
+  auto lineNeg = [](double x, const Line& line) {
+    return line.y0 - line.slope * x;
+  };
+  auto width = [](double, const Line& line) { return line.width; };
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  for (unsigned id = 0; id < 30; ++id) {
+    Line line{8. * uniform(rng), 12. * uniform(rng),
+              0.05 + 0.3 * std::abs(uniform(rng))};
+    unsigned layer = id % 7;
+    // two solutions per hit, overlapping around x = 0
+    plane.fill<Line>(line, ranges, linePos, width, id, layer);
+    referenceFill(cells, cfg, ranges, line, 1., id, layer);
+    plane.fill<Line>(line, ranges, lineNeg, width, id, layer);
+    referenceFill(cells, cfg, ranges, line, -1., id, layer);
+  }
+
+  YieldType maxHits = 0;
+  YieldType maxLayers = 0;
+  std::size_t nNonEmpty = 0;
+  for (std::size_t x = 0; x < cfg.nBinsX; ++x) {
+    for (std::size_t y = 0; y < cfg.nBinsY; ++y) {
+      const auto& cell = cells[x * cfg.nBinsY + y];
+      BOOST_CHECK_EQUAL(plane.nHits(x, y), cell.nHits());
+      BOOST_CHECK_EQUAL(plane.nLayers(x, y), cell.nLayers());
+      BOOST_CHECK(plane.hitIds(x, y) == cell.hits);
+      BOOST_CHECK(plane.layers(x, y) == cell.layers);
+      maxHits = std::max(maxHits, cell.nHits());
+      maxLayers = std::max(maxLayers, cell.nLayers());
+      nNonEmpty += cell.nHits() > 0 ? 1u : 0u;
+    }
+  }
+  BOOST_CHECK_EQUAL(plane.maxHits(), maxHits);
+  BOOST_CHECK_EQUAL(plane.maxLayers(), maxLayers);
+  auto [xMax, yMax] = plane.locMaxHits();
+  BOOST_CHECK_EQUAL(plane.nHits(xMax, yMax), maxHits);
+
+  // The non empty bins are unique and ordered
+  auto nonEmptyBins = plane.getNonEmptyBins();
+  BOOST_CHECK_EQUAL(nonEmptyBins.size(), nNonEmpty);
+  BOOST_CHECK(std::is_sorted(nonEmptyBins.begin(), nonEmptyBins.end()));
+
+  // The peak finders run on the compact plane
+  PeakFinders::LayerGuidedCombinatoric<unsigned> layerGuided({3.0f, 1});
+  for (const auto& maximum : layerGuided.findPeaks(plane)) {
+    BOOST_CHECK_GE(maximum.hitIdentifiers.size(), 3u);
+  }
+  PeakFinders::IslandsAroundMax<unsigned> islands({3.0f, 0.5f, {0., 0.}});
+  BOOST_CHECK(!islands.findPeaks(plane, ranges).empty());
+
+  // Reset empties the plane
+  plane.reset();
+  BOOST_CHECK(plane.getNonEmptyBins().empty());
+  BOOST_CHECK_EQUAL(plane.maxHits(), 0.);
+  BOOST_CHECK_EQUAL(plane.nHits(xMax, yMax), 0.);
+  BOOST_CHECK(plane.hitIds(xMax, yMax).empty());
+
+  BOOST_CHECK_THROW(plane.fill<Line>(Line{}, ranges, linePos, width, 0u,
+                                     HoughPlane<unsigned>::s_maxLayers),
+                    std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
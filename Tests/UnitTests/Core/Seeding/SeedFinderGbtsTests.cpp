@@ -0,0 +1,198 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/GbtsDataStorage.hpp"
+#include "Acts/Seeding/GbtsGeometry.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFinderGbts.hpp"
+#include "Acts/Seeding/SeedFinderGbtsConfig.hpp"
+#include "Acts/Tests/CommonHelpers/TestExecutors.hpp"
+#include "Acts/TrackFinding/GbtsConnector.hpp"
+#include "Acts/TrackFinding/RoiDescriptor.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+
+namespace {
+
+/// Minimal pixel space point, pixels have exactly one source link
+struct GbtsTestSpacePoint {
+  float m_x{};
+  float m_y{};
+  float m_z{};
+  float m_r{};
+  unsigned int m_layerKey{};
+  std::vector<int> m_sourceLinks{0};
+  float x() const { return m_x; }
+  float y() const { return m_y; }
+  float z() const { return m_z; }
+  float r() const { return m_r; }
+  const std::vector<int>& sourceLinks() const { return m_sourceLinks; }
+};
+
+using SpacePoint = GbtsTestSpacePoint;
+
+// Four barrel layers, the layer keys are the combined ids of the space points
+const std::vector<unsigned int> layerKeys = {81000, 82000, 83000, 84000};
+const std::vector<float> layerRadii = {35., 70., 110., 160.};
+const float layerHalfZ = 400.;
+
+/// Connector file linking every layer to its two next outer layers
+struct ConnectorFile {
+  std::filesystem::path path;
+
+  ConnectorFile();
+  ~ConnectorFile() { std::filesystem::remove(path); }
+};
+
+ConnectorFile::ConnectorFile()
+    : path(std::filesystem::temp_directory_path() /
+           ("acts_seed_finder_gbts_tests-" +
+            std::to_string(std::random_device{}()) + ".txt")) {
+  std::vector<std::pair<unsigned int, unsigned int>> links;  // src, dst
+  for (std::size_t dst = 0; dst < layerKeys.size(); ++dst) {
+    for (std::size_t src = dst + 1; src < layerKeys.size() && src < dst + 3;
+         ++src) {
+      links.emplace_back(layerKeys[src], layerKeys[dst]);
+    }
+  }
+
+  std::ofstream file(path);
+  // number of links and eta bin width
+  file << links.size() << " 0.2\n";
+  for (std::size_t l = 0; l < links.size(); ++l) {
+    // index, stage, src, dst, height, width, entries and the bin table
+    file << l << " 1 " << links[l].first << " " << links[l].second
+         << " 1 1 1\n1\n";
+  }
+}
+
+/// Space points of prompt tracks in a 2T field on all the layers
+std::vector<SpacePoint> makeSpacePoints(std::size_t nTracks, double ptCoeff) {
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> cotThetaDist(-0.8, 0.8);
+  std::uniform_real_distribution<double> ptDist(2000., 20000.);
+  std::uniform_real_distribution<double> z0Dist(-50., 50.);
+  std::bernoulli_distribution chargeDist;
+
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(nTracks * layerRadii.size());
+  for (std::size_t it = 0; it < nTracks; ++it) {
+    const double phi0 = phiDist(gen);
+    const double cotTheta = cotThetaDist(gen);
+    const double radius = ptDist(gen) / ptCoeff;
+    const double charge = chargeDist(gen) ? 1. : -1.;
+    const double z0 = z0Dist(gen);
+    for (std::size_t il = 0; il < layerRadii.size(); ++il) {
+      const double r = layerRadii[il];
+      // the helix through the origin crosses the layer after the arc length
+      const double s = 2. * radius * std::asin(r / (2. * radius));
+      const double phi = phi0 + charge * std::asin(r / (2. * radius));
+      SpacePoint sp;
+      sp.m_x = r * std::cos(phi);
+      sp.m_y = r * std::sin(phi);
+      sp.m_z = z0 + s * cotTheta;
+      sp.m_r = r;
+      sp.m_layerKey = layerKeys[il];
+      spacePoints.push_back(sp);
+    }
+  }
+  return spacePoints;
+}
+
+std::vector<Seed<SpacePoint>> findSeeds(
+    const std::vector<SpacePoint>& spacePoints,
+    const ParallelExecutor& executor) {
+  ConnectorFile connectorFile;
+  std::ifstream connectorStream(connectorFile.path);
+  auto connector = std::make_unique<GbtsConnector>(connectorStream);
+
+  std::vector<TrigInDetSiLayer> layers;
+  for (std::size_t il = 0; il < layerKeys.size(); ++il) {
+    layers.emplace_back(layerKeys[il], 0, layerRadii[il], -layerHalfZ,
+                        layerHalfZ);
+  }
+  GbtsGeometry<SpacePoint> geometry(layers, connector);
+
+  SeedFinderGbtsConfig<SpacePoint> cfg;
+  cfg.m_layerGeometry = layers;
+  cfg.executor = executor;
+
+  std::vector<GbtsSP<SpacePoint>> gbtsSpacePoints;
+  for (const auto& sp : spacePoints) {
+    gbtsSpacePoints.emplace_back(&sp, sp.m_layerKey / 1000, sp.m_layerKey);
+  }
+
+  SeedFinderGbts<SpacePoint> finder(cfg, geometry);
+  finder.loadSpacePoints(gbtsSpacePoints);
+
+  RoiDescriptor roi(0, -4.5, 4.5, 0, -M_PI, M_PI, 0, -150., 150.);
+  return finder.createSeeds(roi, geometry);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedFinderGbtsSuite)
+
+// The doublet making relies on no layer being source and destination of the
+// connections within one stage.
+BOOST_AUTO_TEST_CASE(GbtsConnectorStages) {
+  ConnectorFile connectorFile;
+  std::ifstream connectorStream(connectorFile.path);
+  GbtsConnector connector(connectorStream);
+
+  // the chained layers need one stage per layer pair
+  BOOST_CHECK_EQUAL(connector.m_layerGroups.size(), layerKeys.size() - 1);
+  for (const auto& [stage, layerGroups] : connector.m_layerGroups) {
+    std::set<unsigned int> destinations;
+    for (const auto& layerGroup : layerGroups) {
+      destinations.insert(layerGroup.m_dst);
+    }
+    for (const auto& layerGroup : layerGroups) {
+      for (const auto* connection : layerGroup.m_sources) {
+        BOOST_CHECK(destinations.count(connection->m_src) == 0u);
+      }
+    }
+  }
+}
+
+// The graph building runs through the executor, the seeds must not depend on
+// the order in which the tasks are executed.
+BOOST_AUTO_TEST_CASE(SeedFinderGbtsExecutorIndependence) {
+  SeedFinderGbtsConfig<SpacePoint> defaultCfg;
+  const auto spacePoints = makeSpacePoints(200, defaultCfg.ptCoeff);
+
+  std::vector<std::size_t> executed;
+  const auto sequential = findSeeds(spacePoints, ParallelExecutor{});
+  const auto reversed =
+      findSeeds(spacePoints, Test::makeReverseExecutor(&executed));
+
+  BOOST_CHECK(!executed.empty());
+  BOOST_REQUIRE(!sequential.empty());
+  BOOST_REQUIRE_EQUAL(sequential.size(), reversed.size());
+  for (std::size_t is = 0; is < sequential.size(); ++is) {
+    BOOST_CHECK(sequential[is].sp() == reversed[is].sp());
+    BOOST_CHECK_EQUAL(sequential[is].seedQuality(),
+                      reversed[is].seedQuality());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
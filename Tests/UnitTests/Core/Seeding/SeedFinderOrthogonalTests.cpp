@@ -0,0 +1,155 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SeedFinderOrthogonal.hpp"
+#include "Acts/Seeding/SeedFinderOrthogonalConfig.hpp"
+#include "Acts/Tests/CommonHelpers/TestExecutors.hpp"
+#include "Acts/Utilities/ParallelExecutor.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+// Four barrel layers, the two inner ones are the middle layers
+const std::vector<float> layerRadii = {35., 70., 110., 160.};
+const float rMinMiddle = 60.;
+const float rMaxMiddle = 120.;
+
+/// Space points of prompt tracks in a 2T field on all the layers
+std::vector<SpacePoint> makeSpacePoints(std::size_t nTracks) {
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> cotThetaDist(-0.8, 0.8);
+  std::uniform_real_distribution<double> ptDist(1_GeV, 10_GeV);
+  std::uniform_real_distribution<double> z0Dist(-50., 50.);
+  std::bernoulli_distribution chargeDist;
+
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(nTracks * layerRadii.size());
+  for (std::size_t it = 0; it < nTracks; ++it) {
+    const double phi0 = phiDist(gen);
+    const double cotTheta = cotThetaDist(gen);
+    // helix radius in mm of a unit charge in a 2T field
+    const double radius = ptDist(gen) / (0.3 * 2. * 1_GeV) * 1_m;
+    const double charge = chargeDist(gen) ? 1. : -1.;
+    const double z0 = z0Dist(gen);
+    for (std::size_t il = 0; il < layerRadii.size(); ++il) {
+      const double r = layerRadii[il];
+      // the helix through the origin crosses the layer after the arc length
+      const double s = 2. * radius * std::asin(r / (2. * radius));
+      const double phi = phi0 + charge * std::asin(r / (2. * radius));
+      SpacePoint sp;
+      sp.m_x = r * std::cos(phi);
+      sp.m_y = r * std::sin(phi);
+      sp.m_z = z0 + s * cotTheta;
+      sp.m_r = r;
+      sp.layer = il;
+      sp.varianceR = 0.01;
+      sp.varianceZ = 0.01;
+      spacePoints.push_back(sp);
+    }
+  }
+  return spacePoints;
+}
+
+std::vector<Seed<SpacePoint>> findSeeds(
+    const std::vector<SpacePoint>& spacePoints,
+    const ParallelExecutor& executor) {
+  SeedFilterConfig filterCfg;
+  filterCfg.maxSeedsPerSpM = 5;
+  filterCfg = filterCfg.toInternalUnits();
+
+  SeedFinderOrthogonalConfig<SpacePoint> cfg;
+  cfg.rMin = 30_mm;
+  cfg.rMax = 200_mm;
+  cfg.useVariableMiddleSPRange = false;
+  cfg.rMinMiddle = rMinMiddle;
+  cfg.rMaxMiddle = rMaxMiddle;
+  cfg.deltaRMinTopSP = 20_mm;
+  cfg.deltaRMaxTopSP = 100_mm;
+  cfg.deltaRMinBottomSP = 20_mm;
+  cfg.deltaRMaxBottomSP = 100_mm;
+  cfg.minPt = 500_MeV;
+  cfg.impactMax = 10_mm;
+  cfg.maxSeedsPerSpM = filterCfg.maxSeedsPerSpM;
+  cfg.executor = executor;
+  cfg = cfg.toInternalUnits().calculateDerivedQuantities();
+  cfg.seedFilter = std::make_shared<SeedFilter<SpacePoint>>(filterCfg);
+
+  SeedFinderOptions options;
+  options.bFieldInZ = 2_T;
+  options = options.toInternalUnits().calculateDerivedQuantities(cfg);
+
+  std::vector<const SpacePoint*> spacePointPtrs;
+  for (const auto& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
+
+  auto extractCoordinates = [](const SpacePoint* sp) {
+    return std::make_tuple(Vector3(sp->x(), sp->y(), sp->z()),
+                           Vector2(sp->varianceR, sp->varianceZ), sp->t());
+  };
+
+  SeedFinderOrthogonal<SpacePoint> finder(cfg);
+  return finder.createSeeds(options, spacePointPtrs, extractCoordinates);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedFinderOrthogonalSuite)
+
+// The tree building and the candidate searches run through the executor, the
+// seeds must not depend on the order in which the tasks are executed. The
+// middle space points are searched in batches of 1024, so there have to be
+// enough of them to span several batches.
+BOOST_AUTO_TEST_CASE(SeedFinderOrthogonalExecutorIndependence) {
+  const auto spacePoints = makeSpacePoints(1500);
+
+  std::size_t nMiddle = 0;
+  for (const auto& sp : spacePoints) {
+    if (sp.r() > rMinMiddle && sp.r() < rMaxMiddle) {
+      ++nMiddle;
+    }
+  }
+  BOOST_REQUIRE_GT(nMiddle, 2048u);
+
+  std::vector<std::size_t> executed;
+  const auto sequential = findSeeds(spacePoints, ParallelExecutor{});
+  const auto reversed =
+      findSeeds(spacePoints, Test::makeReverseExecutor(&executed));
+
+  BOOST_CHECK(!executed.empty());
+  BOOST_REQUIRE(!sequential.empty());
+  BOOST_REQUIRE_EQUAL(sequential.size(), reversed.size());
+  for (std::size_t is = 0; is < sequential.size(); ++is) {
+    BOOST_CHECK(sequential[is].sp() == reversed[is].sp());
+    BOOST_CHECK_EQUAL(sequential[is].seedQuality(),
+                      reversed[is].seedQuality());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,175 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace Acts {
+
+using namespace UnitLiterals;
+
+GeometryContext tgContext = GeometryContext();
+
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Surfaces)
+
+/// The batch intersection agrees with the single surface intersection
+BOOST_AUTO_TEST_CASE(PlaneSurfaceBatchIntersection) {
+  std::mt19937 rng(2023);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+
+  // A ring of tilted planes with rectangle, trapezoid and diamond bounds
+  std::vector<std::shared_ptr<PlaneSurface>> planes;
+  std::vector<const PlaneSurface*> surfaces;
+  for (unsigned int is = 0; is < 60u; ++is) {
+    const double phi = is * 2 * M_PI / 60.;
+    Transform3 transform = Transform3::Identity() *
+                           Translation3(100_mm * std::cos(phi),
+                                        100_mm * std::sin(phi), 20. * is) *
+                           AngleAxis3(phi, Vector3::UnitZ()) *
+                           AngleAxis3(0.5 * M_PI, Vector3::UnitY()) *
+                           AngleAxis3(0.1 * uniform(rng), Vector3::UnitX());
+    std::shared_ptr<PlanarBounds> bounds;
+    if (is % 3 == 0) {
+      bounds = std::make_shared<RectangleBounds>(Vector2(-12_mm, -40_mm),
+                                                 Vector2(8_mm, 30_mm));
+    } else if (is % 3 == 1) {
+      bounds = std::make_shared<TrapezoidBounds>(6_mm, 14_mm, 35_mm);
+    } else {
+      bounds = std::make_shared<DiamondBounds>(6_mm, 14_mm, 9_mm, 20_mm,
+                                               15_mm);
+    }
+    planes.push_back(Surface::makeShared<PlaneSurface>(transform, bounds));
+    surfaces.push_back(planes.back().get());
+  }
+
+  PlaneSurfaceBatch batch(tgContext, surfaces);
+  BOOST_CHECK_EQUAL(batch.size(), surfaces.size());
+
+  SquareMatrix2 cov;
+  cov << 4., 1., 1., 9.;
+  std::vector<BoundaryCheck> bchecks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, true, 1_mm, 3_mm), BoundaryCheck(true, false, 2_mm),
+      BoundaryCheck(cov, 2.)};
+
+  PlaneSurfaceBatch::Intersections intersections;
+  std::size_t nInside = 0;
+  for (unsigned int ir = 0; ir < 200u; ++ir) {
+    const Vector3 position(2_mm * uniform(rng), 2_mm * uniform(rng),
+                           600_mm + 600_mm * uniform(rng));
+    const double phi = M_PI * uniform(rng);
+    const double theta = 0.5 * M_PI + 0.4 * uniform(rng);
+    const Vector3 direction(std::cos(phi) * std::sin(theta),
+                            std::sin(phi) * std::sin(theta), std::cos(theta));
+    for (const auto& bcheck : bchecks) {
+      batch.intersect(position, direction, bcheck, 1_um, intersections);
+      BOOST_REQUIRE_EQUAL(intersections.status.size(), surfaces.size());
+      for (std::size_t is = 0; is < surfaces.size(); ++is) {
+        auto reference =
+            surfaces[is]
+                ->intersect(tgContext, position, direction, bcheck, 1_um)
+                .closest();
+        auto batched = batch.intersection(intersections, is);
+        BOOST_CHECK_EQUAL(batched.object(), reference.object());
+        BOOST_CHECK_EQUAL(batched.status(), reference.status());
+        BOOST_CHECK_EQUAL(batched.pathLength(), reference.pathLength());
+        BOOST_CHECK(batched.position() == reference.position());
+        nInside += (bcheck.isEnabled() && batched) ? 1u : 0u;
+      }
+    }
+  }
+  // Make sure the bounds were actually tested
+  BOOST_CHECK_GT(nInside, 0u);
+}
+
+/// The on-surface status agrees with the single surface intersection at the
+/// tolerance boundary
+BOOST_AUTO_TEST_CASE(PlaneSurfaceBatchTolerance) {
+  auto plane = Surface::makeShared<PlaneSurface>(
+      Transform3(Translation3(0., 0., 10_mm)),
+      std::make_shared<RectangleBounds>(5_mm, 5_mm));
+  PlaneSurfaceBatch batch(tgContext, {plane.get()});
+
+  const double tolerance = 1_um;
+  const Vector3 direction = Vector3(0.1, 0.2, 1.).normalized();
+  PlaneSurfaceBatch::Intersections intersections;
+  std::size_t nOnSurface = 0;
+  for (double distance :
+       {0., std::nextafter(tolerance, 0.), tolerance,
+        std::nextafter(tolerance, 1.), -tolerance, 2 * tolerance}) {
+    const Vector3 position = Vector3(0., 0., 10_mm) - distance * direction;
+    // the neighbouring start positions around the boundary
+    for (double z : {std::nextafter(position.z(), 0.), position.z(),
+                     std::nextafter(position.z(), 20_mm)}) {
+      const Vector3 start(position.x(), position.y(), z);
+      batch.intersect(start, direction, BoundaryCheck(true), tolerance,
+                      intersections);
+      auto batched = batch.intersection(intersections, 0u);
+      auto reference = plane
+                           ->intersect(tgContext, start, direction,
+                                       BoundaryCheck(true), tolerance)
+                           .closest();
+      BOOST_CHECK_EQUAL(batched.status(), reference.status());
+      BOOST_CHECK_EQUAL(batched.pathLength(), reference.pathLength());
+      BOOST_CHECK(batched.position() == reference.position());
+      nOnSurface +=
+          batched.status() == Intersection3D::Status::onSurface ? 1u : 0u;
+    }
+  }
+  // Make sure both sides of the boundary were tested
+  BOOST_CHECK_GT(nOnSurface, 0u);
+  BOOST_CHECK_LT(nOnSurface, 18u);
+}
+
+/// Rays parallel to a plane are unreachable
+BOOST_AUTO_TEST_CASE(PlaneSurfaceBatchParallel) {
+  auto plane = Surface::makeShared<PlaneSurface>(
+      Transform3(Translation3(0., 0., 10_mm)),
+      std::make_shared<RectangleBounds>(5_mm, 5_mm));
+  PlaneSurfaceBatch batch(tgContext, {plane.get()});
+
+  PlaneSurfaceBatch::Intersections intersections;
+  batch.intersect(Vector3::Zero(), Vector3::UnitX(), BoundaryCheck(true),
+                  1_um, intersections);
+  auto batched = batch.intersection(intersections, 0u);
+  BOOST_CHECK(!batched);
+  BOOST_CHECK(std::isinf(batched.pathLength()));
+
+  batch.intersect(Vector3::Zero(), Vector3::UnitZ(), BoundaryCheck(true),
+                  1_um, intersections);
+  batched = batch.intersection(intersections, 0u);
+  BOOST_CHECK(batched);
+  CHECK_CLOSE_ABS(batched.pathLength(), 10_mm, 1e-12);
+
+  BOOST_CHECK_THROW(PlaneSurfaceBatch(tgContext, {nullptr}),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
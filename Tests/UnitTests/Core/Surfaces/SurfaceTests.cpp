@@ -10,6 +10,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/DetectorElementBase.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/PlaneLayer.hpp"
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
@@ -20,7 +21,10 @@
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include "SurfaceStub.hpp"
 
@@ -46,6 +50,70 @@ namespace Test {
 // Create a test context
 GeometryContext tgContext = GeometryContext();
 
+/// Detector element with one transform per alignment, the geometry context
+/// holds the index of the alignment. The inverse transforms are cached
+/// together with the transforms if requested.
+class AlignedElementStub : public DetectorElementBase {
+ public:
+  AlignedElementStub(std::vector<Transform3> transforms, bool cacheInverse)
+      : m_cacheInverse(cacheInverse) {
+    for (const auto& transform : transforms) {
+      addAlignment(transform);
+    }
+  }
+
+  /// Replace an existing alignment
+  void setAlignment(std::size_t index, const Transform3& transform) {
+    m_transforms.at(index) = transform;
+    m_inverseTransforms.at(index) = transform.inverse();
+  }
+
+  /// Append an alignment
+  void addAlignment(const Transform3& transform) {
+    m_transforms.push_back(transform);
+    m_inverseTransforms.push_back(transform.inverse());
+  }
+
+  const Transform3& transform(const GeometryContext& gctx) const override {
+    return m_transforms.at(index(gctx));
+  }
+
+  Transform3 inverseTransform(const GeometryContext& gctx) const override {
+    if (!m_cacheInverse) {
+      return DetectorElementBase::inverseTransform(gctx);
+    }
+    ++m_nCachedInverse;
+    return m_inverseTransforms.at(index(gctx));
+  }
+
+  const Surface& surface() const override { throw std::logic_error("n/a"); }
+
+  Surface& surface() override { throw std::logic_error("n/a"); }
+
+  double thickness() const override { return 0.; }
+
+  std::size_t nCachedInverse() const { return m_nCachedInverse; }
+
+ private:
+  static std::size_t index(const GeometryContext& gctx) {
+    return gctx.hasValue() ? gctx.get<std::size_t>() : 0u;
+  }
+
+  bool m_cacheInverse = false;
+  std::vector<Transform3> m_transforms;
+  std::vector<Transform3> m_inverseTransforms;
+  mutable std::size_t m_nCachedInverse = 0;
+};
+
+/// Check that the inverse transform of a surface matches its transform
+void checkInverseTransform(const Surface& surface,
+                           const GeometryContext& gctx) {
+  const Transform3 product =
+      surface.inverseTransform(gctx) * surface.transform(gctx);
+  CHECK_CLOSE_OR_SMALL(product.matrix(), Transform3::Identity().matrix(),
+                       1e-9, 1e-12);
+}
+
 BOOST_AUTO_TEST_SUITE(Surfaces)
 
 /// todo: make test fixture; separate out different cases
@@ -174,6 +242,83 @@ BOOST_AUTO_TEST_CASE(EqualityOperators) {
   const auto sharedSurfacePtr = surfacePtr->getSharedPtr();
   BOOST_CHECK(*surfacePtr == *sharedSurfacePtr);
 }
+
+/// Unit test for the cached inverse transform of a surface
+BOOST_AUTO_TEST_CASE(SurfaceInverseTransform) {
+  auto pPlanarBound = std::make_shared<const RectangleBounds>(5., 10.);
+  Transform3 transformA = Transform3::Identity();
+  transformA.rotate(AngleAxis3(0.3, Vector3::UnitZ()));
+  transformA.pretranslate(Vector3(10., -2., 5.));
+  Transform3 transformB = Transform3::Identity();
+  transformB.rotate(AngleAxis3(-1.1, Vector3::UnitY()));
+  transformB.pretranslate(Vector3(-3., 7., 1.));
+
+  // A free surface caches the inverse of its own transform
+  auto free = Surface::makeShared<PlaneSurface>(transformA, pPlanarBound);
+  checkInverseTransform(*free, tgContext);
+  const Vector3 global(11., -1., 5.);
+  auto local = free->globalToLocal(tgContext, global, Vector3::UnitZ());
+  BOOST_REQUIRE(local.ok());
+  CHECK_CLOSE_ABS(free->localToGlobal(tgContext, *local, Vector3::UnitZ()),
+                  global, 1e-9);
+
+  // Copies with a shift and assignments carry the matching inverse
+  auto shifted = Surface::makeShared<PlaneSurface>(tgContext, *free,
+                                                   transformB);
+  checkInverseTransform(*shifted, tgContext);
+  auto assigned = Surface::makeShared<PlaneSurface>(transformB, pPlanarBound);
+  checkInverseTransform(*assigned, tgContext);
+  *assigned = *free;
+  checkInverseTransform(*assigned, tgContext);
+  CHECK_CLOSE_OR_SMALL(assigned->inverseTransform(tgContext).matrix(),
+                       free->inverseTransform(tgContext).matrix(), 1e-9,
+                       1e-12);
+
+  // A surface of a detector element forwards to the element
+  DetectorElementStub detElement{transformB, pPlanarBound, 0.2, nullptr};
+  SurfaceStub elementSurface(detElement);
+  checkInverseTransform(elementSurface, tgContext);
+  CHECK_CLOSE_OR_SMALL(elementSurface.inverseTransform(tgContext).matrix(),
+                       detElement.transform(tgContext).inverse().matrix(),
+                       1e-9, 1e-12);
+
+  // Assigning a detector element after the first call drops the cache
+  auto reassigned = Surface::makeShared<PlaneSurface>(transformA, pPlanarBound);
+  checkInverseTransform(*reassigned, tgContext);
+  reassigned->assignDetectorElement(detElement);
+  checkInverseTransform(*reassigned, tgContext);
+  CHECK_CLOSE_OR_SMALL(reassigned->inverseTransform(tgContext).matrix(),
+                       transformB.inverse().matrix(), 1e-9, 1e-12);
+
+  // The transform of a detector element changes after the first call,
+  // either by a new alignment context or by updating the alignment
+  for (bool cacheInverse : {false, true}) {
+    BOOST_TEST_CONTEXT("cache inverse " << cacheInverse) {
+      AlignedElementStub aligned({transformA}, cacheInverse);
+      SurfaceStub alignedSurface(aligned);
+      GeometryContext gctxA(std::size_t{0});
+      GeometryContext gctxB(std::size_t{1});
+
+      checkInverseTransform(alignedSurface, gctxA);
+      aligned.addAlignment(transformB);
+      checkInverseTransform(alignedSurface, gctxB);
+      CHECK_CLOSE_OR_SMALL(alignedSurface.inverseTransform(gctxB).matrix(),
+                           transformB.inverse().matrix(), 1e-9, 1e-12);
+      // the first context is not affected
+      CHECK_CLOSE_OR_SMALL(alignedSurface.inverseTransform(gctxA).matrix(),
+                           transformA.inverse().matrix(), 1e-9, 1e-12);
+
+      aligned.setAlignment(0, transformB);
+      checkInverseTransform(alignedSurface, gctxA);
+      CHECK_CLOSE_OR_SMALL(alignedSurface.inverseTransform(gctxA).matrix(),
+                           transformB.inverse().matrix(), 1e-9, 1e-12);
+
+      // the element cache is used if provided
+      BOOST_CHECK_EQUAL(aligned.nCachedInverse() > 0u, cacheInverse);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Test
 }  // namespace Acts
@@ -416,4 +416,96 @@ BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
   }
 }
 
+/// Pre-selecting source links must not change the found tracks but avoid
+/// calibrating the incompatible ones
+BOOST_AUTO_TEST_CASE(SourceLinkPreSelection) {
+  Fixture f(0_T);
+  f.measSel = Acts::MeasurementSelector({
+      {Acts::GeometryIdentifier(), {{}, {15.}, {1u}}},
+  });
+
+  /// Counts the calibrated source links
+  struct CountingCalibrator {
+    mutable std::size_t nCalibrated = 0;
+
+    void operator()(const Acts::GeometryContext& gctx,
+                    const Acts::CalibrationContext& cctx,
+                    const Acts::SourceLink& sourceLink,
+                    Fixture::Trajectory::TrackStateProxy trackState) const {
+      ++nCalibrated;
+      testSourceLinkCalibrator<Fixture::Trajectory>(gctx, cctx, sourceLink,
+                                                    trackState);
+    }
+  };
+
+  /// Checks the test source links with the measurement selector
+  struct PreSelector {
+    const Acts::MeasurementSelector* selector = nullptr;
+
+    bool operator()(const Acts::BoundTrackParameters& predicted,
+                    const Acts::SourceLink& sourceLink) const {
+      const auto& sl = sourceLink.get<TestSourceLink>();
+      if (sl.indices[1] != Acts::eBoundSize) {
+        return selector->isCompatible(
+            predicted, makeMeasurement(sourceLink, sl.parameters,
+                                       sl.covariance, sl.indices[0],
+                                       sl.indices[1]));
+      }
+      return selector->isCompatible(
+          predicted, makeMeasurement(sourceLink, sl.parameters.head<1>(),
+                                     sl.covariance.topLeftCorner<1, 1>(),
+                                     sl.indices[0]));
+    }
+  };
+
+  auto pSurface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3{-3_m, 0., 0.}, Acts::Vector3{1., 0., 0});
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  auto findTracks = [&](bool preSelect, std::size_t& nCalibrated) {
+    auto options = f.makeCkfOptions();
+    options.smoothingTargetSurface = pSurface.get();
+    options.sourcelinkAccessor
+        .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+    CountingCalibrator calibrator;
+    options.extensions.calibrator.connect<&CountingCalibrator::operator()>(
+        &calibrator);
+    PreSelector preSelector{&f.measSel};
+    if (preSelect) {
+      options.extensions.sourceLinkPreSelector
+          .connect<&PreSelector::operator()>(&preSelector);
+    }
+
+    Acts::TrackContainer tc{Acts::VectorTrackContainer{},
+                            Acts::VectorMultiTrajectory{}};
+    for (const auto& start : f.startParameters) {
+      auto res = f.ckf.findTracks(start, options, tc);
+      BOOST_REQUIRE(res.ok());
+    }
+    nCalibrated = calibrator.nCalibrated;
+
+    std::vector<std::vector<std::size_t>> hits;
+    for (std::size_t trackId = 0u; trackId < tc.size(); ++trackId) {
+      auto& trackHits = hits.emplace_back();
+      for (const auto trackState : tc.getTrack(trackId).trackStatesReversed()) {
+        auto sl = trackState.getUncalibratedSourceLink()
+                      .template get<TestSourceLink>();
+        trackHits.push_back(sl.sourceId);
+        trackHits.push_back(sl.m_geometryId.value());
+      }
+    }
+    return hits;
+  };
+
+  std::size_t nCalibratedAll = 0;
+  std::size_t nCalibratedPreSelected = 0;
+  auto hitsAll = findTracks(false, nCalibratedAll);
+  auto hitsPreSelected = findTracks(true, nCalibratedPreSelected);
+
+  BOOST_CHECK_EQUAL(hitsAll.size(), f.startParameters.size());
+  BOOST_CHECK(hitsAll == hitsPreSelected);
+  BOOST_CHECK_LT(nCalibratedPreSelected, nCalibratedAll);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,7 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/TrackFitting/GsfMixtureReduction.hpp"
+#include "Acts/TrackFitting/detail/FixedSizeSymmetricKlDistanceMatrix.hpp"
 #include "Acts/TrackFitting/detail/SymmetricKlDistanceMatrix.hpp"
 
 #include <algorithm>
@@ -19,6 +20,7 @@
 #include <cstddef>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -100,6 +102,104 @@ BOOST_AUTO_TEST_CASE(test_distance_matrix_recompute_distance) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_fixed_size_distance_matrix) {
+  std::vector<GsfComponent> cmps = {
+      {1. / 3., BoundVector::Constant(-2.), BoundSquareMatrix::Identity()},
+      {1. / 3., BoundVector::Constant(+0.), BoundSquareMatrix::Identity()},
+      {1. / 3., BoundVector::Constant(+1.), BoundSquareMatrix::Identity()},
+      {1. / 3., BoundVector::Constant(+4.), BoundSquareMatrix::Identity()}};
+
+  const auto proj = [](auto &a) -> decltype(auto) { return a; };
+  detail::SymmetricKLDistanceMatrix ref(cmps, proj);
+  detail::FixedSizeSymmetricKLDistanceMatrix<8> mat(cmps, proj);
+
+  for (auto i = 1ul; i < cmps.size(); ++i) {
+    for (auto j = 0ul; j < i; ++j) {
+      BOOST_CHECK_CLOSE(mat.at(i, j), ref.at(i, j), 1.e-8);
+    }
+  }
+
+  BOOST_CHECK(mat.minDistancePair() == ref.minDistancePair());
+
+  cmps[3].boundPars = BoundVector::Constant(0.1);
+  mat.recomputeAssociatedDistances(3, cmps, proj);
+  ref.recomputeAssociatedDistances(3, cmps, proj);
+  BOOST_CHECK(mat.minDistancePair() == ref.minDistancePair());
+
+  mat.maskAssociatedDistances(1);
+  ref.maskAssociatedDistances(1);
+  BOOST_CHECK(mat.minDistancePair() == ref.minDistancePair());
+
+  const auto [i, j] = mat.minDistancePair();
+  BOOST_CHECK_EQUAL(std::min(i, j), 2);
+  BOOST_CHECK_EQUAL(std::max(i, j), 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_fixed_size_reduction_equals_dynamic) {
+  auto surface = Acts::Surface::makeShared<PlaneSurface>(Vector3{0, 0, 0},
+                                                         Vector3{1, 0, 0});
+  const auto proj = [](auto &a) -> decltype(auto) { return a; };
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> qopDist(0.1, 1.0);
+  std::uniform_real_distribution<double> varDist(0.01, 0.1);
+
+  // The matrix of the largest capacity is allocated on the heap, the one for
+  // production sized mixtures on the stack
+  static_assert(sizeof(detail::FixedSizeSymmetricKLDistanceMatrix<128>) >
+                detail::s_maxStackDistanceMatrixSize);
+  static_assert(sizeof(detail::FixedSizeSymmetricKLDistanceMatrix<80>) <=
+                detail::s_maxStackDistanceMatrixSize);
+
+  for (std::size_t n : {12ul, 24ul, 48ul, 72ul, 128ul}) {
+    std::vector<GsfComponent> cmps;
+    for (auto i = 0ul; i < n; ++i) {
+      GsfComponent a;
+      a.boundPars = BoundVector::Zero();
+      a.boundCov = BoundSquareMatrix::Identity();
+      a.weight = 1.0 / n;
+      a.boundPars[eBoundQOverP] = qopDist(gen);
+      a.boundCov(eBoundQOverP, eBoundQOverP) = varDist(gen);
+      cmps.push_back(a);
+    }
+
+    auto cmpsRef = cmps;
+    auto cmpsFixed = cmps;
+    auto cmpsMedium = cmps;
+
+    detail::angleDescriptionSwitch(*surface, [&](const auto &desc) {
+      detail::reduceWithKLDistance<detail::SymmetricKLDistanceMatrix>(
+          cmpsRef, 12, proj, desc);
+      detail::reduceWithKLDistance<
+          detail::FixedSizeSymmetricKLDistanceMatrix<128>>(cmpsFixed, 12,
+                                                           proj, desc);
+      if (n <= 80) {
+        detail::reduceWithKLDistance<
+            detail::FixedSizeSymmetricKLDistanceMatrix<80>>(cmpsMedium, 12,
+                                                            proj, desc);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(cmpsRef.size(), 12);
+    BOOST_CHECK_EQUAL(cmpsFixed.size(), 12);
+
+    for (auto i = 0ul; i < cmpsRef.size(); ++i) {
+      BOOST_CHECK_CLOSE(cmpsRef[i].weight, cmpsFixed[i].weight, 1.e-8);
+      BOOST_CHECK_CLOSE(cmpsRef[i].boundPars[eBoundQOverP],
+                        cmpsFixed[i].boundPars[eBoundQOverP], 1.e-8);
+    }
+
+    if (n <= 80) {
+      BOOST_REQUIRE_EQUAL(cmpsMedium.size(), 12);
+      for (auto i = 0ul; i < cmpsRef.size(); ++i) {
+        BOOST_CHECK_CLOSE(cmpsRef[i].weight, cmpsMedium[i].weight, 1.e-8);
+        BOOST_CHECK_CLOSE(cmpsRef[i].boundPars[eBoundQOverP],
+                          cmpsMedium[i].boundPars[eBoundQOverP], 1.e-8);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_mixture_reduction) {
   auto meanAndSumOfWeights = [](const auto &cmps) {
     const auto mean = std::accumulate(
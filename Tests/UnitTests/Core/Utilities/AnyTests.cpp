@@ -495,4 +495,31 @@ BOOST_AUTO_TEST_CASE(LifeCycleHeap) {
   CHECK_ANY_ALLOCATIONS();
 }
 
+#if defined(_ACTS_ANY_ENABLE_COUNT_ALLOCATIONS)
+BOOST_AUTO_TEST_CASE(HeapAllocationCounters) {
+  static_assert(Any::fitsLocally<int>());
+  static_assert(!Any::fitsLocally<std::array<int, 512>>());
+
+  const AnyHeapAllocations before = anyHeapAllocations();
+  {
+    Any a{5};
+    Any b{a};
+  }
+  BOOST_CHECK_EQUAL(anyHeapAllocations().allocations, before.allocations);
+
+  {
+    Any a{std::array<int, 512>{}};
+    Any b{a};
+    Any c{std::move(a)};
+    BOOST_CHECK_EQUAL(anyHeapAllocations().allocations,
+                      before.allocations + 2);
+  }
+  const AnyHeapAllocations after = anyHeapAllocations();
+  BOOST_CHECK_EQUAL(after.allocations, before.allocations + 2);
+  BOOST_CHECK_EQUAL(after.deallocations, before.deallocations + 2);
+
+  CHECK_ANY_ALLOCATIONS();
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -8,12 +8,16 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/Tests/CommonHelpers/TestExecutors.hpp"
 #include "Acts/Utilities/DBScan.hpp"
+#include "Acts/Utilities/GridDBScan.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <iterator>
+#include <map>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -104,5 +108,193 @@ BOOST_AUTO_TEST_CASE(ClusteringTest2D) {
   clusteredPoints.clear();
 }
 
+BOOST_AUTO_TEST_CASE(GridClusteringTest2D) {
+  using DBSCAN = Acts::GridDBScan<2, double>;
+  DBSCAN dbscan(0.3, 3, false);
+
+  DBSCAN dbscan_onePoint(0, 3, true);
+
+  std::vector<int> clusteredPoints;
+
+  // Test the clustering we expect 4 clusters
+  int clusterNb = dbscan.cluster(test_vector, clusteredPoints);
+  BOOST_CHECK_EQUAL(clusterNb, 4);
+
+  // Check that it works with empty input
+  std::vector<std::array<double, 2>> empty_vector;
+  clusterNb = dbscan.cluster(empty_vector, clusteredPoints);
+  BOOST_CHECK_EQUAL(clusterNb, 0);
+  BOOST_CHECK(clusteredPoints.empty());
+
+  clusterNb = dbscan_onePoint.cluster(test_vector, clusteredPoints);
+  BOOST_CHECK_EQUAL(clusterNb, test_vector.size());
+
+  // A chain of core points with a border point at each end and one noise
+  // point, border points do not extend the cluster
+  std::vector<std::array<double, 2>> chain{
+      {0., 0.}, {0.9, 0.}, {1.8, 0.}, {2.7, 0.}, {-0.9, 0.}, {3.6, 0.},
+      {10., 0.}};
+  DBSCAN dbscan_chain(1., 3, false);
+  clusterNb = dbscan_chain.cluster(chain, clusteredPoints);
+  BOOST_CHECK_EQUAL(clusterNb, 1);
+  BOOST_CHECK(clusteredPoints == std::vector<int>({0, 0, 0, 0, 0, 0, -1}));
+}
+
+BOOST_AUTO_TEST_CASE(GridClusteringMatchesKDTree4D) {
+  // With one point per cluster every point is a core point, and both
+  // implementations have to find the connected components
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> centers(-10., 10.);
+  std::normal_distribution<double> spread(0., 0.2);
+  std::vector<std::array<double, 4>> points;
+  for (std::size_t iBlob = 0; iBlob < 30; ++iBlob) {
+    std::array<double, 4> center{centers(rng), centers(rng), centers(rng),
+                                 centers(rng)};
+    for (std::size_t i = 0; i < 20; ++i) {
+      points.push_back({center[0] + spread(rng), center[1] + spread(rng),
+                        center[2] + spread(rng), center[3] + spread(rng)});
+    }
+  }
+  std::shuffle(points.begin(), points.end(), rng);
+
+  std::vector<int> reference;
+  Acts::DBScan<4, double, 4> kdDBScan(0.3, 1, false);
+  int nReference = kdDBScan.cluster(points, reference);
+
+  for (const auto& executor :
+       {Acts::ParallelExecutor{}, Acts::Test::makeReverseExecutor()}) {
+    std::vector<int> clusteredPoints;
+    Acts::GridDBScan<4, double> gridDBScan(0.3, 1, false, executor);
+    int nClusters = gridDBScan.cluster(points, clusteredPoints);
+    BOOST_CHECK_EQUAL(nClusters, nReference);
+
+    // The partitions are identical up to the cluster numbering
+    std::map<int, int> gridToReference;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      auto [it, inserted] =
+          gridToReference.emplace(clusteredPoints[i], reference[i]);
+      BOOST_CHECK_EQUAL(it->second, reference[i]);
+    }
+    BOOST_CHECK_EQUAL(gridToReference.size(),
+                      static_cast<std::size_t>(nClusters));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GridClusteringMatchesKDTreeProduction) {
+  // The configuration of the ML seed filter and ambiguity resolution: two
+  // points form a cluster and the noise points are one point clusters
+  const double epsilon = 0.07;
+  const std::size_t minPoints = 2;
+
+  std::mt19937 rng(4321);
+  std::uniform_real_distribution<double> centers(-3., 3.);
+  std::uniform_int_distribution<std::size_t> blobSize(1, 6);
+  std::normal_distribution<double> spread(0., 0.03);
+  std::vector<std::array<double, 4>> points;
+  for (std::size_t iBlob = 0; iBlob < 200; ++iBlob) {
+    std::array<double, 4> center{centers(rng), centers(rng), centers(rng),
+                                 centers(rng)};
+    // blobs of a single point are noise unless they overlap with another one
+    for (std::size_t i = blobSize(rng); i > 0; --i) {
+      points.push_back({center[0] + spread(rng), center[1] + spread(rng),
+                        center[2] + spread(rng), center[3] + spread(rng)});
+    }
+  }
+  std::shuffle(points.begin(), points.end(), rng);
+
+  // Without a one point cluster option the noise points are counted
+  std::vector<int> withNoise;
+  Acts::DBScan<4, double, 4> noiseDBScan(epsilon, minPoints, false);
+  int nWithoutNoise = noiseDBScan.cluster(points, withNoise);
+  std::size_t nNoise = std::count(withNoise.begin(), withNoise.end(), -1);
+  BOOST_CHECK_GT(nWithoutNoise, 0);
+  BOOST_CHECK_GT(nNoise, 0u);
+
+  std::vector<int> reference;
+  Acts::DBScan<4, double, 4> kdDBScan(epsilon, minPoints, true);
+  int nReference = kdDBScan.cluster(points, reference);
+  BOOST_CHECK_EQUAL(nReference, nWithoutNoise + static_cast<int>(nNoise));
+
+  for (const auto& executor :
+       {Acts::ParallelExecutor{}, Acts::Test::makeReverseExecutor()}) {
+    std::vector<int> clusteredPoints;
+    Acts::GridDBScan<4, double> gridDBScan(epsilon, minPoints, true, executor);
+    int nClusters = gridDBScan.cluster(points, clusteredPoints);
+    BOOST_CHECK_EQUAL(nClusters, nReference);
+
+    // With two points per cluster every clustered point is a core point, so
+    // both implementations number the clusters by their first point and the
+    // noise points after them in the order of the points
+    BOOST_CHECK(clusteredPoints == reference);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      if (withNoise[i] == -1) {
+        BOOST_CHECK_EQUAL(
+            std::count(clusteredPoints.begin(), clusteredPoints.end(),
+                       clusteredPoints[i]),
+            1);
+      }
+    }
+  }
+}
+
+// The grid clustering only differs from DBScan for points which are not core
+// points. Such a point has less than minPoints - 1 other neighbours, all of
+// them need to be claimed by a core point for the results to agree. This is
+// guaranteed for minPoints up to three; clusterWithDBScan nevertheless only
+// uses the grid clustering up to two.
+BOOST_AUTO_TEST_CASE(GridClusteringMinPoints) {
+  const double epsilon = 0.07;
+
+  std::mt19937 rng(2468);
+  std::uniform_real_distribution<double> centers(-3., 3.);
+  std::uniform_int_distribution<std::size_t> blobSize(1, 8);
+  std::normal_distribution<double> spread(0., 0.04);
+  std::vector<std::array<double, 4>> points;
+  for (std::size_t iBlob = 0; iBlob < 200; ++iBlob) {
+    std::array<double, 4> center{centers(rng), centers(rng), centers(rng),
+                                 centers(rng)};
+    for (std::size_t i = blobSize(rng); i > 0; --i) {
+      points.push_back({center[0] + spread(rng), center[1] + spread(rng),
+                        center[2] + spread(rng), center[3] + spread(rng)});
+    }
+  }
+  std::shuffle(points.begin(), points.end(), rng);
+
+  for (std::size_t minPoints : {1u, 2u, 3u}) {
+    BOOST_TEST_CONTEXT("minPoints " << minPoints) {
+      std::vector<int> reference;
+      Acts::DBScan<4, double, 4> kdDBScan(epsilon, minPoints, true);
+      int nReference = kdDBScan.cluster(points, reference);
+
+      std::vector<int> clusteredPoints;
+      Acts::GridDBScan<4, double> gridDBScan(epsilon, minPoints, true);
+      int nClusters = gridDBScan.cluster(points, clusteredPoints);
+
+      // The partitions are identical up to the cluster numbering
+      BOOST_CHECK_EQUAL(nClusters, nReference);
+      std::map<int, int> gridToReference;
+      for (std::size_t i = 0; i < points.size(); ++i) {
+        auto [it, inserted] =
+            gridToReference.emplace(clusteredPoints[i], reference[i]);
+        BOOST_CHECK_EQUAL(it->second, reference[i]);
+      }
+      BOOST_CHECK_EQUAL(gridToReference.size(),
+                        static_cast<std::size_t>(nClusters));
+
+      // The dispatching helper gives the DBScan clusters
+      std::vector<int> dispatched;
+      int nDispatched = Acts::clusterWithDBScan<4, double>(
+          points, dispatched, epsilon, minPoints, true);
+      BOOST_CHECK_EQUAL(nDispatched, nReference);
+      std::map<int, int> dispatchedToReference;
+      for (std::size_t i = 0; i < points.size(); ++i) {
+        auto [it, inserted] =
+            dispatchedToReference.emplace(dispatched[i], reference[i]);
+        BOOST_CHECK_EQUAL(it->second, reference[i]);
+      }
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
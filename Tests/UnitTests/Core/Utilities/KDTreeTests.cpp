@@ -8,6 +8,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/Tests/CommonHelpers/TestExecutors.hpp"
 #include "Acts/Utilities/KDTree.hpp"
 #include "Acts/Utilities/Range1D.hpp"
 #include "Acts/Utilities/RangeXD.hpp"
@@ -590,6 +591,56 @@ BOOST_AUTO_TEST_CASE(range_search_very_big) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(range_search_parallel_build) {
+  std::vector<std::pair<std::array<double, 3>, int>> points;
+
+  for (int i = 0; i < 4000; ++i) {
+    // deterministic scatter with repeated coordinates
+    points.push_back({{static_cast<double>((i * 37) % 101) - 50.0,
+                       static_cast<double>((i * 53) % 89) - 44.0,
+                       static_cast<double>((i * 71) % 23)},
+                      i});
+  }
+
+  std::vector<std::pair<std::array<double, 3>, int>> copy1(points);
+  std::vector<std::pair<std::array<double, 3>, int>> copy2(points);
+
+  Acts::KDTree<3, int, double> serial(std::move(copy1));
+  Acts::KDTree<3, int, double> parallel(std::move(copy2),
+                                        Acts::Test::makeReverseExecutor());
+
+  BOOST_CHECK_EQUAL(serial.size(), points.size());
+  BOOST_CHECK_EQUAL(parallel.size(), points.size());
+  BOOST_CHECK(std::equal(serial.begin(), serial.end(), parallel.begin(),
+                         parallel.end()));
+
+  for (double xmin = -50.0; xmin <= 50.0; xmin += 7.0) {
+    for (double zmin = 0.0; zmin <= 22.0; zmin += 3.0) {
+      RangeXD<3, double> range;
+
+      range[0].shrink(xmin, xmin + 9.0);
+      range[1].shrink(-20.0, 30.0);
+      range[2].shrink(zmin, zmin + 4.0);
+
+      std::vector<int> valid;
+
+      for (const std::pair<std::array<double, 3>, int>& i : points) {
+        if (range.contains(i.first)) {
+          valid.push_back(i.second);
+        }
+      }
+
+      std::vector<int> result1 = serial.rangeSearch(range);
+      std::vector<int> result2 = parallel.rangeSearch(range);
+
+      BOOST_CHECK(result1 == result2);
+
+      std::sort(result1.begin(), result1.end());
+      BOOST_CHECK(result1 == valid);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(range_search_many_same) {
   int q = 0;
 
@@ -0,0 +1,183 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/Zip.hpp"
+#include "ActsExamples/Digitization/DigitizationAlgorithm.hpp"
+#include "ActsExamples/Digitization/DigitizationConfig.hpp"
+#include "ActsExamples/Digitization/Smearers.hpp"
+#include "ActsExamples/EventData/Cluster.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <tbb/task_arena.h>
+
+using namespace Acts::UnitLiterals;
+using namespace ActsExamples;
+using namespace Acts::Test;
+
+namespace {
+
+struct DigitizationOutput {
+  MeasurementContainer measurements;
+  ClusterContainer clusters;
+  IndexMultimap<ActsFatras::Barcode> measurementParticlesMap;
+  IndexMultimap<Index> measurementSimHitsMap;
+};
+
+Acts::GeometryContext gctx;
+
+/// Create a few hits per sensitive surface, each with its own particle
+SimHitContainer makeSimHits(const Acts::TrackingGeometry& tGeometry) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> loc0(-8_mm, 8_mm);
+  std::uniform_real_distribution<double> loc1(-30_mm, 30_mm);
+
+  SimHitContainer simHits;
+  std::uint64_t particle = 0;
+  tGeometry.visitSurfaces([&](const Acts::Surface* surface) {
+    for (int ih = 0; ih < 3; ++ih) {
+      const Acts::Vector2 local(loc0(gen), loc1(gen));
+      const Acts::Vector3 center = surface->center(gctx);
+      const Acts::Vector3 position =
+          surface->localToGlobal(gctx, local, center.normalized());
+      const Acts::Vector3 direction = position.normalized();
+
+      Acts::Vector4 pos4 = Acts::Vector4::Zero();
+      pos4.head<3>() = position;
+      Acts::Vector4 mom4 = Acts::Vector4::Zero();
+      mom4.head<3>() = 1_GeV * direction;
+      mom4[3] = 1_GeV;
+
+      ActsFatras::Barcode particleId;
+      particleId.setVertexPrimary(1).setParticle(++particle);
+      simHits.emplace(surface->geometryId(), particleId, pos4, mom4, mom4, 0);
+    }
+  });
+  return simHits;
+}
+
+DigitizationConfig makeConfig(
+    std::shared_ptr<const Acts::TrackingGeometry> tGeometry) {
+  Acts::BinUtility segmentation;
+  segmentation += Acts::BinUtility(160, -8_mm, 8_mm, Acts::open, Acts::binX);
+  segmentation += Acts::BinUtility(120, -30_mm, 30_mm, Acts::open, Acts::binY);
+
+  DigiComponentsConfig digiCfg;
+  digiCfg.geometricDigiConfig.indices = {Acts::eBoundLoc0, Acts::eBoundLoc1};
+  digiCfg.geometricDigiConfig.segmentation = segmentation;
+  digiCfg.geometricDigiConfig.thickness = 0.15_mm;
+  digiCfg.geometricDigiConfig.chargeSmearer = Digitization::Gauss(0.01_mm);
+  digiCfg.smearingDigiConfig = {
+      {Acts::eBoundTime, Digitization::Gauss(1_ns)}};
+
+  // A default entry applies to all modules
+  DigitizationConfig cfg(
+      false, 1., true,
+      Acts::GeometryHierarchyMap<DigiComponentsConfig>(
+          {{Acts::GeometryIdentifier(), std::move(digiCfg)}}));
+  cfg.trackingGeometry = std::move(tGeometry);
+  cfg.randomNumbers =
+      std::make_shared<const RandomNumbers>(RandomNumbers::Config{});
+  return cfg;
+}
+
+DigitizationOutput digitize(const DigitizationAlgorithm& algorithm,
+                            const SimHitContainer& simHits) {
+  const auto& cfg = algorithm.config();
+
+  WhiteBoard board;
+  AlgorithmContext ctx(0, 3, board);
+  addToWhiteBoard(cfg.inputSimHits, simHits, board);
+
+  BOOST_REQUIRE(algorithm.execute(ctx) == ProcessCode::SUCCESS);
+
+  DigitizationOutput output;
+  output.measurements =
+      getFromWhiteBoard<MeasurementContainer>(cfg.outputMeasurements, board);
+  output.clusters =
+      getFromWhiteBoard<ClusterContainer>(cfg.outputClusters, board);
+  output.measurementParticlesMap =
+      getFromWhiteBoard<IndexMultimap<ActsFatras::Barcode>>(
+          cfg.outputMeasurementParticlesMap, board);
+  output.measurementSimHitsMap = getFromWhiteBoard<IndexMultimap<Index>>(
+      cfg.outputMeasurementSimHitsMap, board);
+  return output;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(DigitizationSuite)
+
+// The modules are digitized in parallel with per-module random numbers, the
+// output must not depend on whether the TBB path is taken.
+BOOST_AUTO_TEST_CASE(DigitizationSerialVsParallel) {
+  CylindricalTrackingGeometry cGeometry(gctx);
+  auto tGeometry = cGeometry();
+
+  const auto simHits = makeSimHits(*tGeometry);
+  BOOST_REQUIRE(!simHits.empty());
+
+  DigitizationAlgorithm algorithm(makeConfig(tGeometry),
+                                  Acts::Logging::WARNING);
+
+  // enabling TBB can not be undone, the serial run has to come first
+  BOOST_REQUIRE(!tbbWrap::enableTBB());
+  const auto serial = digitize(algorithm, simHits);
+
+  BOOST_REQUIRE(tbbWrap::enableTBB(4));
+  DigitizationOutput parallel;
+  tbb::task_arena arena(4);
+  arena.execute([&]() { parallel = digitize(algorithm, simHits); });
+
+  BOOST_CHECK(!serial.measurements.empty());
+  BOOST_REQUIRE_EQUAL(serial.measurements.size(),
+                      parallel.measurements.size());
+  for (const auto& [a, b] :
+       Acts::zip(serial.measurements, parallel.measurements)) {
+    BOOST_CHECK_EQUAL(a.geometryId(), b.geometryId());
+    BOOST_CHECK_EQUAL(a.size(), b.size());
+    BOOST_CHECK(a.fullParameters() == b.fullParameters());
+    BOOST_CHECK(a.fullCovariance() == b.fullCovariance());
+  }
+
+  BOOST_REQUIRE_EQUAL(serial.clusters.size(), parallel.clusters.size());
+  for (const auto& [a, b] : Acts::zip(serial.clusters, parallel.clusters)) {
+    BOOST_CHECK_EQUAL(a.sizeLoc0, b.sizeLoc0);
+    BOOST_CHECK_EQUAL(a.sizeLoc1, b.sizeLoc1);
+    BOOST_REQUIRE_EQUAL(a.channels.size(), b.channels.size());
+    for (const auto& [ca, cb] : Acts::zip(a.channels, b.channels)) {
+      BOOST_CHECK(ca.bin == cb.bin);
+      BOOST_CHECK_EQUAL(ca.activation, cb.activation);
+    }
+  }
+
+  BOOST_CHECK(serial.measurementParticlesMap ==
+              parallel.measurementParticlesMap);
+  BOOST_CHECK(serial.measurementSimHitsMap == parallel.measurementSimHitsMap);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
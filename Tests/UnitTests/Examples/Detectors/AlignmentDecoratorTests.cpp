@@ -0,0 +1,225 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "ActsExamples/ContextualDetector/AlignmentDecorator.hpp"
+#include "ActsExamples/ContextualDetector/InternalAlignmentDecorator.hpp"
+#include "ActsExamples/ContextualDetector/InternallyAlignedDetectorElement.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+using namespace ActsExamples;
+using namespace ActsExamples::Contextual;
+
+namespace {
+
+using Registry = AlignmentDecorator::IovRegistry<const int>;
+
+/// Build a single layer of detector elements along the x axis
+InternalAlignmentDecorator::DetectorStore makeDetectorStore() {
+  auto bounds = std::make_shared<const Acts::RectangleBounds>(10_mm, 20_mm);
+  InternalAlignmentDecorator::LayerStore layer;
+  for (unsigned int id = 0; id < 4; ++id) {
+    auto transform = std::make_shared<const Acts::Transform3>(
+        Acts::Translation3(Acts::Vector3(100_mm * id, 0, 0)));
+    layer.push_back(std::make_shared<InternallyAlignedDetectorElement>(
+        id, transform, bounds, 1_mm));
+  }
+  return {layer};
+}
+
+struct DecoratorFixture {
+  InternalAlignmentDecorator::DetectorStore detectorStore =
+      makeDetectorStore();
+  std::unique_ptr<InternalAlignmentDecorator> decorator;
+  WhiteBoard eventStore;
+
+  DecoratorFixture() {
+    InternalAlignmentDecorator::Config cfg;
+    cfg.detectorStore = detectorStore;
+    cfg.randomNumberSvc =
+        std::make_shared<RandomNumbers>(RandomNumbers::Config{});
+    cfg.iovSize = 10;
+    cfg.gSigmaX = 1_mm;
+    cfg.aSigmaZ = 0.01;
+    decorator = std::make_unique<InternalAlignmentDecorator>(cfg);
+  }
+
+  /// The geometry context of the given event
+  Acts::GeometryContext decorate(std::size_t event) {
+    AlgorithmContext context(0, event, eventStore);
+    BOOST_REQUIRE(decorator->decorate(context) == ProcessCode::SUCCESS);
+    return context.geoContext;
+  }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(AlignmentDecoratorSuite)
+
+BOOST_AUTO_TEST_CASE(IovRegistryLookup) {
+  Registry registry;
+  BOOST_CHECK(registry.find(0, 1) == nullptr);
+
+  auto payload = std::make_shared<const int>(42);
+  registry.insert(0, payload, 1);
+  BOOST_CHECK(registry.find(0, 2) == payload);
+  BOOST_CHECK(registry.find(1, 2) == nullptr);
+
+  // Replacing the payload does not affect the previous lookups
+  auto previous = registry.find(0, 3);
+  BOOST_CHECK(registry.update(0, std::make_shared<const int>(43)));
+  BOOST_CHECK_EQUAL(*previous, 42);
+  BOOST_CHECK_EQUAL(*registry.find(0, 4), 43);
+  BOOST_CHECK(!registry.update(1, std::make_shared<const int>(44)));
+  BOOST_CHECK(registry.find(1, 5) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(IovRegistryEviction) {
+  Registry registry;
+  registry.insert(0, std::make_shared<const int>(0), 1);
+  registry.insert(1, std::make_shared<const int>(1), 1);
+
+  // Nothing is evicted within the flush size
+  BOOST_CHECK(registry.collectGarbage(10, 10).empty());
+
+  // Accessing an IOV keeps it alive, the other one is evicted
+  registry.find(1, 15);
+  auto removed = registry.collectGarbage(20, 10);
+  BOOST_REQUIRE_EQUAL(removed.size(), 1u);
+  BOOST_CHECK_EQUAL(removed.front(), 0u);
+  BOOST_CHECK(registry.find(0, 20) == nullptr);
+  BOOST_CHECK(registry.find(1, 20) != nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(PerIovTransforms, DecoratorFixture) {
+  auto firstEvent = decorate(0);
+  auto sameIov = decorate(5);
+  auto nextIov = decorate(10);
+
+  for (const auto& element : detectorStore.front()) {
+    const Acts::Transform3& nominal = element->nominalTransform(firstEvent);
+    const Acts::Transform3& aligned = element->transform(firstEvent);
+    BOOST_CHECK(!aligned.isApprox(nominal));
+    // The events of one IOV share the transforms, which change with the IOV
+    BOOST_CHECK(&element->transform(sameIov) == &aligned);
+    BOOST_CHECK(!element->transform(nextIov).isApprox(aligned));
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(InverseTransformConsistency, DecoratorFixture) {
+  for (std::size_t event : {0u, 10u, 20u}) {
+    auto gctx = decorate(event);
+    for (const auto& element : detectorStore.front()) {
+      BOOST_CHECK(element->inverseTransform(gctx).isApprox(
+          element->transform(gctx).inverse()));
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(AddAlignedTransform, DecoratorFixture) {
+  auto inFlight = decorate(0);
+  auto aligning = decorate(1);
+
+  auto& element = *detectorStore.front().at(1);
+  const Acts::Transform3 before = element.transform(inFlight);
+  const Acts::Transform3 updated =
+      Acts::Translation3(Acts::Vector3(1_mm, 2_mm, 3_mm)) * before;
+  element.addAlignedTransform(aligning, updated);
+
+  // The updating context sees the new transform right away
+  BOOST_CHECK(element.transform(aligning).isApprox(updated));
+  BOOST_CHECK(element.inverseTransform(aligning).isApprox(updated.inverse()));
+  BOOST_CHECK(element.transform(decorate(2)).isApprox(before));
+
+  // The later events see it once it is committed
+  InternallyAlignedDetectorElement::commitAlignedTransforms(aligning);
+  auto later = decorate(3);
+  BOOST_CHECK(element.transform(later).isApprox(updated));
+  BOOST_CHECK(element.inverseTransform(later).isApprox(updated.inverse()));
+
+  // The events in flight keep their transforms
+  BOOST_CHECK(element.transform(inFlight).isApprox(before));
+  BOOST_CHECK(element.inverseTransform(inFlight).isApprox(before.inverse()));
+
+  // The other detector elements are not affected
+  const auto& other = *detectorStore.front().at(2);
+  BOOST_CHECK(other.transform(later).isApprox(other.transform(inFlight)));
+}
+
+BOOST_FIXTURE_TEST_CASE(CommitAlignedTransforms, DecoratorFixture) {
+  auto aligning = decorate(0);
+  auto& alignContext =
+      aligning.get<InternallyAlignedDetectorElement::ContextType&>();
+
+  // Count the tables published by the decorator
+  std::vector<std::shared_ptr<
+      const InternallyAlignedDetectorElement::AlignedTransforms>>
+      published;
+  alignContext.publish =
+      [&published, publish = alignContext.publish](
+          unsigned int iov,
+          std::shared_ptr<
+              const InternallyAlignedDetectorElement::AlignedTransforms>
+              alignedTransforms) {
+        published.push_back(alignedTransforms);
+        publish(iov, std::move(alignedTransforms));
+      };
+
+  // Nothing is published without updates
+  InternallyAlignedDetectorElement::commitAlignedTransforms(aligning);
+  BOOST_CHECK(published.empty());
+
+  // Two iterations updating all detector elements
+  std::vector<Acts::Transform3> previous;
+  for (std::size_t iteration = 1; iteration <= 2; ++iteration) {
+    const auto* original = alignContext.alignedTransforms.get();
+    std::vector<Acts::Transform3> updated;
+    for (const auto& element : detectorStore.front()) {
+      updated.push_back(Acts::Translation3(Acts::Vector3(1_mm, 0, 0)) *
+                        element->transform(aligning));
+      element->addAlignedTransform(aligning, updated.back());
+    }
+    // All updates of an iteration share a single copy of the table
+    BOOST_CHECK(alignContext.alignedTransforms.get() != original);
+    BOOST_CHECK_EQUAL(published.size(), iteration - 1);
+    // The table published before is not modified
+    for (std::size_t i = 0; i < previous.size(); ++i) {
+      BOOST_CHECK(published.back()->transforms.at(i).isApprox(previous[i]));
+    }
+
+    InternallyAlignedDetectorElement::commitAlignedTransforms(aligning);
+    BOOST_REQUIRE_EQUAL(published.size(), iteration);
+    BOOST_CHECK(published.back() == alignContext.alignedTransforms);
+
+    auto later = decorate(iteration);
+    BOOST_CHECK(later.get<InternallyAlignedDetectorElement::ContextType&>()
+                    .alignedTransforms == published.back());
+    for (std::size_t i = 0; i < updated.size(); ++i) {
+      const auto& element = *detectorStore.front().at(i);
+      BOOST_CHECK(element.transform(later).isApprox(updated[i]));
+      BOOST_CHECK(
+          element.inverseTransform(later).isApprox(updated[i].inverse()));
+    }
+    previous = std::move(updated);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
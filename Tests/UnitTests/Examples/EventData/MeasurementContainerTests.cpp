@@ -0,0 +1,154 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/MeasurementCalibration.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+/// Fill the container with measurements of all sizes
+template <std::size_t... kSizes>
+void fillAllSizes(MeasurementContainer& container,
+                  std::index_sequence<kSizes...> /*sizes*/) {
+  (
+      [&] {
+        constexpr std::size_t kSize = kSizes + 1;
+        GeometryIdentifier geoId = GeometryIdentifier().setSensitive(kSize);
+        IndexSourceLink sl(geoId, static_cast<Index>(container.size()));
+        std::array<BoundIndices, kSize> indices{};
+        for (std::size_t i = 0; i < kSize; ++i) {
+          indices[i] = static_cast<BoundIndices>(i);
+        }
+        ActsVector<kSize> par = ActsVector<kSize>::Random();
+        ActsSquareMatrix<kSize> cov = ActsSquareMatrix<kSize>::Random();
+        container.push_back(Acts::Measurement<BoundIndices, kSize>(
+            SourceLink{sl}, indices, par, cov));
+      }(),
+      ...);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesEventData)
+
+BOOST_AUTO_TEST_CASE(MeasurementContainerRoundTrip) {
+  MeasurementContainer container;
+  BOOST_CHECK(container.empty());
+
+  // A strip measurement with non consecutive indices
+  IndexSourceLink stripSl(GeometryIdentifier().setVolume(1), 0);
+  container.emplaceMeasurement<1>(SourceLink{stripSl}, stripSl.geometryId(),
+                                  {eBoundLoc1}, ActsVector<1>(2.),
+                                  ActsSquareMatrix<1>(0.5));
+  fillAllSizes(container, std::make_index_sequence<eBoundSize>());
+  BOOST_CHECK_EQUAL(container.size(), 1u + eBoundSize);
+
+  auto strip = container.getMeasurement(0);
+  BOOST_CHECK_EQUAL(strip.size(), 1u);
+  BOOST_CHECK_EQUAL(strip.subspaceIndex(0), eBoundLoc1);
+  BOOST_CHECK_EQUAL(strip.parameters<1>()[0], 2.);
+  BOOST_CHECK_EQUAL(strip.covariance<1>()(0, 0), 0.5);
+  BOOST_CHECK_EQUAL(strip.geometryId(), stripSl.geometryId());
+  BOOST_CHECK(strip.sourceLink().get<IndexSourceLink>() == stripSl);
+
+  // The proxies agree with the variant measurements they are created from
+  for (std::size_t i = 1; i < container.size(); ++i) {
+    auto proxy = container.getMeasurement(i);
+    BOOST_CHECK_EQUAL(proxy.index(), i);
+    BOOST_CHECK_EQUAL(proxy.size(), i);
+    BOOST_CHECK_EQUAL(proxy.geometryId().sensitive(), i);
+    std::visit(
+        [&](const auto& meas) {
+          constexpr std::size_t kSize = std::decay_t<decltype(meas)>::size();
+          BOOST_CHECK_EQUAL(kSize, proxy.size());
+          BOOST_CHECK(meas.parameters() == proxy.effectiveParameters());
+          BOOST_CHECK(meas.covariance() == proxy.effectiveCovariance());
+          BOOST_CHECK(meas.indices() ==
+                      proxy.template subspaceIndices<kSize>());
+          BOOST_CHECK(meas.projector() == proxy.template projector<kSize>());
+          BOOST_CHECK(meas.expander() == proxy.template expander<kSize>());
+          BOOST_CHECK(meas.expander() * meas.parameters() ==
+                      proxy.fullParameters());
+          BOOST_CHECK(meas.expander() * meas.covariance() *
+                          meas.expander().transpose() ==
+                      proxy.fullCovariance());
+          for (std::size_t ipar = 0; ipar < eBoundSize; ++ipar) {
+            const auto index = static_cast<BoundIndices>(ipar);
+            BOOST_CHECK_EQUAL(meas.contains(index), proxy.contains(index));
+          }
+          BOOST_CHECK(meas.sourceLink().template get<IndexSourceLink>() ==
+                      proxy.sourceLink().get<IndexSourceLink>());
+        },
+        container[i]);
+  }
+
+  // Range iteration visits all measurements in order
+  std::size_t nVisited = 0;
+  for (const auto& proxy : container) {
+    BOOST_CHECK_EQUAL(proxy.index(), nVisited);
+    BOOST_CHECK_EQUAL(proxy.geometryId(),
+                      container.getMeasurement(nVisited).geometryId());
+    ++nVisited;
+  }
+  BOOST_CHECK_EQUAL(nVisited, container.size());
+
+  container.clear();
+  BOOST_CHECK(container.empty());
+  BOOST_CHECK(container.begin() == container.end());
+}
+
+BOOST_AUTO_TEST_CASE(MeasurementContainerPassThroughCalibration) {
+  MeasurementContainer container;
+  fillAllSizes(container, std::make_index_sequence<eBoundSize>());
+
+  PassThroughCalibrator calibrator;
+  GeometryContext gctx;
+  CalibrationContext cctx;
+  VectorMultiTrajectory traj;
+  for (std::size_t i = 0; i < container.size(); ++i) {
+    auto proxy = container.getMeasurement(i);
+    auto ts = traj.getTrackState(traj.addTrackState());
+    calibrator.calibrate(container, nullptr, gctx, cctx, proxy.sourceLink(),
+                         ts);
+    // calibrating with the variant measurement gives the same track state
+    auto ref = traj.getTrackState(traj.addTrackState());
+    std::visit([&](const auto& meas) { ref.setCalibrated(meas); },
+               container[i]);
+
+    BOOST_CHECK_EQUAL(ts.calibratedSize(), proxy.size());
+    BOOST_CHECK(ts.effectiveCalibrated() == ref.effectiveCalibrated());
+    BOOST_CHECK(ts.effectiveCalibratedCovariance() ==
+                ref.effectiveCalibratedCovariance());
+    BOOST_CHECK(ts.projector() == ref.projector());
+    BOOST_CHECK(ts.getUncalibratedSourceLink().get<IndexSourceLink>() ==
+                proxy.sourceLink().get<IndexSourceLink>());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -144,7 +144,7 @@ BOOST_AUTO_TEST_CASE(CsvMeasurementRoundTrip) {
       std::is_same_v<std::decay_t<decltype(measRead)>, decltype(measOriginal)>);
   BOOST_REQUIRE(measRead.size() == measOriginal.size());
   for (const auto &[a, b] : Acts::zip(measRead, measOriginal)) {
-    std::visit(checkMeasurementClose, a, b);
+    std::visit(checkMeasurementClose, a.variant(), b.variant());
   }
 
   static_assert(std::is_same_v<std::decay_t<decltype(clusterRead)>,
@@ -0,0 +1,276 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsFatras/Physics/NuclearInteraction/NuclearInteractionParameters.hpp"
+#include "ActsFatras/Physics/NuclearInteraction/NuclearInteractionParametersIo.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ActsFatras::detail;
+
+namespace {
+
+std::size_t upperBound(const std::vector<std::uint32_t>& contents,
+                       std::uint32_t value) {
+  return std::distance(contents.begin(), std::upper_bound(contents.begin(),
+                                                          contents.end(),
+                                                          value));
+}
+
+/// Check the guide table lookup against a binary search for the bin
+/// contents, their neighbours and random values in the full range
+void checkFindBin(const std::vector<std::uint32_t>& contents,
+                  std::mt19937& gen) {
+  std::vector<float> borders(contents.size() + 1);
+  std::iota(borders.begin(), borders.end(), 0.f);
+  const CumulativeDistribution distribution({borders, contents});
+  BOOST_CHECK_EQUAL(distribution.guide.size(), contents.size());
+
+  std::vector<std::uint32_t> values = {
+      0u, 1u, std::numeric_limits<std::uint32_t>::max() - 1u,
+      std::numeric_limits<std::uint32_t>::max()};
+  for (std::uint32_t c : contents) {
+    values.push_back(c);
+    values.push_back(c - 1u);
+    values.push_back(c + 1u);
+  }
+  std::uniform_int_distribution<std::uint32_t> uniform;
+  std::uniform_int_distribution<std::uint32_t> inRange(0u, contents.back());
+  for (unsigned int i = 0; i < 1000; ++i) {
+    values.push_back(uniform(gen));
+    values.push_back(inRange(gen));
+  }
+
+  for (std::uint32_t value : values) {
+    BOOST_CHECK_EQUAL(distribution.findBin(value),
+                      upperBound(contents, value));
+  }
+}
+
+/// Random cumulative bin contents up to @p maximum, with repeated values
+std::vector<std::uint32_t> randomContents(std::size_t nBins,
+                                          std::uint32_t maximum,
+                                          std::mt19937& gen) {
+  std::uniform_int_distribution<std::uint32_t> uniform(0u, maximum);
+  std::vector<std::uint32_t> contents(nBins);
+  for (auto& c : contents) {
+    c = uniform(gen);
+  }
+  // create ties and empty bins
+  for (std::size_t i = 1; i < nBins; i += 3) {
+    contents[i] = contents[i - 1];
+  }
+  std::sort(contents.begin(), contents.end());
+  contents.back() = maximum;
+  return contents;
+}
+
+CumulativeDistribution makeDistribution(std::vector<float> borders,
+                                        std::vector<std::uint32_t> contents) {
+  return {std::make_pair(std::move(borders), std::move(contents))};
+}
+
+MultiParticleNuclearInteractionParametrisation makeParametrisation() {
+  NuclearInteractionParameters parameters;
+  parameters.momentum = 10.f;
+  parameters.softInteractionProbability = 0.25f;
+  parameters.pdgMap = {{211, {{211, 0.5f}, {2212, 1.f}}}, {2212, {}}};
+  parameters.nuclearInteractionProbability =
+      makeDistribution({0.f, 1.f, 2.f, 3.f}, {10u, 20u, 40u});
+  parameters.softMultiplicity =
+      makeDistribution({0.f, 1.f, 2.f}, {0x80000000u, 0xffffffffu});
+  parameters.hardMultiplicity = makeDistribution({}, {});
+
+  NuclearInteractionParameters::ParametersWithFixedMultiplicity kinematics;
+  kinematics.validParametrisation = true;
+  kinematics.momentumDistributions = {
+      makeDistribution({0.f, 0.5f, 1.f}, {100u, 300u}),
+      makeDistribution({1.f, 2.f}, {7u})};
+  kinematics.eigenvaluesMomentum = Acts::ActsDynamicVector::LinSpaced(2, 1, 2);
+  kinematics.eigenvectorsMomentum = Acts::ActsDynamicMatrix::Random(2, 2);
+  kinematics.meanMomentum = Acts::ActsDynamicVector::Random(2);
+  kinematics.invariantMassDistributions = {
+      makeDistribution({0.f, 1.f}, {3u})};
+  kinematics.eigenvaluesInvariantMass = Acts::ActsDynamicVector::Random(1);
+  kinematics.eigenvectorsInvariantMass = Acts::ActsDynamicMatrix::Random(1, 1);
+  kinematics.meanInvariantMass = Acts::ActsDynamicVector::Random(1);
+  parameters.softKinematicParameters = {
+      NuclearInteractionParameters::ParametersWithFixedMultiplicity(),
+      kinematics};
+  parameters.hardKinematicParameters = {kinematics};
+
+  NuclearInteractionParameters other = parameters;
+  other.momentum = 100.f;
+  other.softKinematicParameters.clear();
+
+  return {{211, {{10.f, parameters}, {100.f, other}}}, {-211, {}}};
+}
+
+void checkEqual(const CumulativeDistribution& a,
+                const CumulativeDistribution& b) {
+  BOOST_CHECK(a.binBorders == b.binBorders);
+  BOOST_CHECK(a.binContents == b.binContents);
+  BOOST_CHECK(a.guide == b.guide);
+}
+
+void checkEqual(const NuclearInteractionParameters::Distributions& a,
+                const NuclearInteractionParameters::Distributions& b) {
+  BOOST_REQUIRE_EQUAL(a.size(), b.size());
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    checkEqual(a[i], b[i]);
+  }
+}
+
+void checkEqual(
+    const std::vector<
+        NuclearInteractionParameters::ParametersWithFixedMultiplicity>& a,
+    const std::vector<
+        NuclearInteractionParameters::ParametersWithFixedMultiplicity>& b) {
+  BOOST_REQUIRE_EQUAL(a.size(), b.size());
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    BOOST_CHECK_EQUAL(a[i].validParametrisation, b[i].validParametrisation);
+    checkEqual(a[i].momentumDistributions, b[i].momentumDistributions);
+    BOOST_CHECK(a[i].eigenvaluesMomentum == b[i].eigenvaluesMomentum);
+    BOOST_CHECK(a[i].eigenvectorsMomentum == b[i].eigenvectorsMomentum);
+    BOOST_CHECK(a[i].meanMomentum == b[i].meanMomentum);
+    checkEqual(a[i].invariantMassDistributions,
+               b[i].invariantMassDistributions);
+    BOOST_CHECK(a[i].eigenvaluesInvariantMass == b[i].eigenvaluesInvariantMass);
+    BOOST_CHECK(a[i].eigenvectorsInvariantMass ==
+                b[i].eigenvectorsInvariantMass);
+    BOOST_CHECK(a[i].meanInvariantMass == b[i].meanInvariantMass);
+  }
+}
+
+std::string writeToString(
+    const MultiParticleNuclearInteractionParametrisation& mpp) {
+  std::ostringstream os(std::ios::binary);
+  writeBinaryParametrisation(os, mpp);
+  return os.str();
+}
+
+MultiParticleNuclearInteractionParametrisation readFromString(
+    const std::string& data) {
+  std::istringstream is(data, std::ios::binary);
+  return readBinaryParametrisation(is);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(FatrasNuclearInteraction)
+
+BOOST_AUTO_TEST_CASE(FindBinMatchesUpperBound) {
+  std::mt19937 gen(42);
+
+  // normalised distributions end at the largest cumulative value
+  const std::uint32_t full = std::numeric_limits<std::uint32_t>::max();
+  for (std::size_t nBins : {1u, 2u, 3u, 17u, 100u}) {
+    checkFindBin(randomContents(nBins, full, gen), gen);
+  }
+  // distributions which are not normalised, like the interaction
+  // probability, end well below it
+  for (std::uint32_t maximum : {1u, 5u, 1000u, 0x10000000u}) {
+    for (std::size_t nBins : {1u, 4u, 25u}) {
+      checkFindBin(randomContents(nBins, maximum, gen), gen);
+    }
+  }
+  // all entries in the first or in the last bin
+  checkFindBin({full, full, full}, gen);
+  checkFindBin({0u, 0u, 0u, 12u}, gen);
+}
+
+BOOST_AUTO_TEST_CASE(FindBinWithoutGuide) {
+  CumulativeDistribution distribution;
+  BOOST_CHECK_EQUAL(distribution.findBin(0u), 0u);
+
+  distribution.binContents = {2u, 2u, 8u};
+  for (std::uint32_t value = 0; value < 10; ++value) {
+    BOOST_CHECK_EQUAL(distribution.findBin(value),
+                      upperBound(distribution.binContents, value));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BinaryRoundTrip) {
+  const auto mpp = makeParametrisation();
+  const auto read = readFromString(writeToString(mpp));
+
+  BOOST_REQUIRE_EQUAL(read.size(), mpp.size());
+  for (std::size_t i = 0; i < mpp.size(); ++i) {
+    BOOST_CHECK_EQUAL(read[i].first, mpp[i].first);
+    const auto& expected = mpp[i].second;
+    const auto& actual = read[i].second;
+    BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+    for (std::size_t j = 0; j < expected.size(); ++j) {
+      BOOST_CHECK_EQUAL(actual[j].first, expected[j].first);
+      const auto& e = expected[j].second;
+      const auto& a = actual[j].second;
+      BOOST_CHECK_EQUAL(a.momentum, e.momentum);
+      BOOST_CHECK_EQUAL(a.softInteractionProbability,
+                        e.softInteractionProbability);
+      BOOST_CHECK(a.pdgMap == e.pdgMap);
+      checkEqual(a.nuclearInteractionProbability,
+                 e.nuclearInteractionProbability);
+      checkEqual(a.softMultiplicity, e.softMultiplicity);
+      checkEqual(a.hardMultiplicity, e.hardMultiplicity);
+      checkEqual(a.softKinematicParameters, e.softKinematicParameters);
+      checkEqual(a.hardKinematicParameters, e.hardKinematicParameters);
+    }
+  }
+
+  // the encoding has no padding and is reproducible
+  BOOST_CHECK_EQUAL(writeToString(read), writeToString(mpp));
+}
+
+BOOST_AUTO_TEST_CASE(BinaryCorruptInput) {
+  const std::string data = writeToString(makeParametrisation());
+
+  // wrong format identifier
+  std::string wrongMagic = data;
+  wrongMagic[0] = 'X';
+  BOOST_CHECK_THROW(readFromString(wrongMagic), std::runtime_error);
+
+  // truncated at every position
+  for (std::size_t size = 0; size < data.size(); ++size) {
+    BOOST_CHECK_THROW(readFromString(data.substr(0, size)),
+                      std::runtime_error);
+  }
+
+  // trailing data
+  BOOST_CHECK_THROW(readFromString(data + '\0'), std::runtime_error);
+
+  // a particle count which does not fit into the input must be rejected
+  // before anything is allocated
+  std::string hugeCount = data;
+  const std::uint64_t count = std::numeric_limits<std::uint64_t>::max() / 2;
+  hugeCount.replace(8, sizeof(count),
+                    reinterpret_cast<const char*>(&count), sizeof(count));
+  BOOST_CHECK_THROW(readFromString(hugeCount), std::runtime_error);
+
+  // every bin needs a lower and an upper border, the distribution has two
+  // bins and hence needs three borders
+  for (std::size_t nBorders : {0u, 1u, 2u, 4u}) {
+    auto mpp = makeParametrisation();
+    auto& distribution = mpp.front().second.front().second.softMultiplicity;
+    distribution.binBorders.resize(nBorders, 1.f);
+    BOOST_CHECK_THROW(readFromString(writeToString(mpp)), std::runtime_error);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
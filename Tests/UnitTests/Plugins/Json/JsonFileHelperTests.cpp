@@ -0,0 +1,73 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Plugins/Json/JsonFileHelper.hpp"
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+using namespace Acts;
+
+namespace {
+
+/// Unique file name in the temporary directory, the file is removed on
+/// destruction
+struct TemporaryFile {
+  std::filesystem::path path;
+
+  explicit TemporaryFile(const std::string& extension)
+      : path(std::filesystem::temp_directory_path() /
+             ("acts_json_file_helper_tests-" +
+              std::to_string(std::random_device{}()) + extension)) {}
+  ~TemporaryFile() { std::filesystem::remove(path); }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(JsonFileHelper)
+
+BOOST_AUTO_TEST_CASE(FormatFromExtension) {
+  using Format = Acts::JsonFileHelper::Format;
+
+  BOOST_CHECK(Acts::JsonFileHelper::format("material.json") == Format::Json);
+  BOOST_CHECK(Acts::JsonFileHelper::format("material.cbor") == Format::Cbor);
+  BOOST_CHECK(Acts::JsonFileHelper::format("material.msgpack") ==
+              Format::MessagePack);
+  BOOST_CHECK(Acts::JsonFileHelper::format("material.mpk") ==
+              Format::MessagePack);
+  BOOST_CHECK(Acts::JsonFileHelper::format("material.ubj") == Format::UbJson);
+  BOOST_CHECK(Acts::JsonFileHelper::format("material.cbor.json") ==
+              Format::Json);
+}
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+  nlohmann::json reference;
+  reference["name"] = "material";
+  reference["bins"] = std::vector<int>{1, 2, 3};
+  reference["data"] = std::vector<double>{0.1, 2.5, -3.75e-4};
+  reference["nested"]["valid"] = true;
+
+  for (const std::string extension : {".json", ".cbor", ".msgpack", ".ubj"}) {
+    TemporaryFile file(extension);
+    Acts::JsonFileHelper::write(reference, file.path.string());
+    nlohmann::json j = Acts::JsonFileHelper::read(file.path.string());
+    BOOST_CHECK(j == reference);
+  }
+
+  TemporaryFile missing(".none");
+  BOOST_CHECK_THROW(Acts::JsonFileHelper::read(missing.path.string()),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,221 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Plugins/Onnx/BatchCoalescer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Acts;
+using namespace std::chrono_literals;
+
+namespace {
+
+/// Input with unique values for the given caller
+BatchCoalescer::Input makeInput(std::size_t caller, std::size_t nRows,
+                                std::size_t nCols = 3) {
+  BatchCoalescer::Input input(nRows, nCols);
+  for (std::size_t row = 0; row < nRows; ++row) {
+    for (std::size_t col = 0; col < nCols; ++col) {
+      input(row, col) = 1000. * caller + 10. * row + col;
+    }
+  }
+  return input;
+}
+
+/// Output with the first and the sum of all the features of each row
+BatchCoalescer::Output summarize(Eigen::Map<BatchCoalescer::Input> input) {
+  BatchCoalescer::Output output;
+  for (Eigen::Index row = 0; row < input.rows(); ++row) {
+    output.push_back({input(row, 0), input.row(row).sum()});
+  }
+  return output;
+}
+
+void checkOutput(const BatchCoalescer::Output& output,
+                 const BatchCoalescer::Input& input) {
+  BOOST_REQUIRE_EQUAL(output.size(), static_cast<std::size_t>(input.rows()));
+  for (Eigen::Index row = 0; row < input.rows(); ++row) {
+    BOOST_REQUIRE_EQUAL(output[row].size(), 2u);
+    BOOST_CHECK_EQUAL(output[row][0], input(row, 0));
+    BOOST_CHECK_EQUAL(output[row][1], input.row(row).sum());
+  }
+}
+
+/// Run one call per input concurrently
+///
+/// The results are only checked afterwards as the Boost.Test assertions are
+/// not thread-safe.
+void runConcurrently(const BatchCoalescer& coalescer,
+                     std::vector<BatchCoalescer::Input>& inputs,
+                     std::vector<BatchCoalescer::Output>& outputs,
+                     std::vector<std::exception_ptr>& errors) {
+  outputs.assign(inputs.size(), {});
+  errors.assign(inputs.size(), nullptr);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      try {
+        outputs[i] = coalescer.run(inputs[i]);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(OnnxBatchCoalescer)
+
+BOOST_AUTO_TEST_CASE(BatchCoalescerConstruction) {
+  BOOST_CHECK_THROW(BatchCoalescer({}, nullptr), std::invalid_argument);
+
+  BatchCoalescer::Config cfg;
+  cfg.maxBatchRows = 0;
+  BOOST_CHECK_THROW(BatchCoalescer(cfg, summarize), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(BatchCoalescerSingleCall) {
+  BatchCoalescer::Config cfg;
+  cfg.window = 1ms;
+  BatchCoalescer coalescer(cfg, summarize);
+
+  // the collecting call has to give up waiting after the window
+  auto input = makeInput(1, 5);
+  checkOutput(coalescer.run(input), input);
+}
+
+BOOST_AUTO_TEST_CASE(BatchCoalescerConcurrentCalls) {
+  const std::size_t nCallers = 8;
+  std::vector<BatchCoalescer::Input> inputs;
+  std::size_t nRows = 0;
+  for (std::size_t i = 0; i < nCallers; ++i) {
+    inputs.push_back(makeInput(i, i + 1));
+    nRows += i + 1;
+  }
+
+  // The window is long enough that the batch is only closed once all the
+  // rows are pending, all the calls end up in the same inference.
+  BatchCoalescer::Config cfg;
+  cfg.window = 60s;
+  cfg.maxBatchRows = nRows;
+  std::atomic<std::size_t> nInferences{0};
+  std::atomic<std::size_t> nInferredRows{0};
+  BatchCoalescer coalescer(cfg, [&](Eigen::Map<BatchCoalescer::Input> input) {
+    ++nInferences;
+    nInferredRows += input.rows();
+    return summarize(input);
+  });
+
+  std::vector<BatchCoalescer::Output> outputs;
+  std::vector<std::exception_ptr> errors;
+  runConcurrently(coalescer, inputs, outputs, errors);
+
+  BOOST_CHECK_EQUAL(nInferences, 1u);
+  BOOST_CHECK_EQUAL(nInferredRows, nRows);
+  for (std::size_t i = 0; i < nCallers; ++i) {
+    BOOST_CHECK(!errors[i]);
+    // each caller gets exactly its own rows back
+    checkOutput(outputs[i], inputs[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchCoalescerErrorPropagation) {
+  const std::size_t nCallers = 6;
+  std::vector<BatchCoalescer::Input> inputs;
+  for (std::size_t i = 0; i < nCallers; ++i) {
+    inputs.push_back(makeInput(i, 2));
+  }
+
+  BatchCoalescer::Config cfg;
+  cfg.window = 60s;
+  cfg.maxBatchRows = 2 * nCallers;
+  std::atomic<bool> fail{true};
+  BatchCoalescer coalescer(cfg, [&](Eigen::Map<BatchCoalescer::Input> input) {
+    if (fail) {
+      throw std::runtime_error("inference failed");
+    }
+    return summarize(input);
+  });
+
+  std::vector<BatchCoalescer::Output> outputs;
+  std::vector<std::exception_ptr> errors;
+  runConcurrently(coalescer, inputs, outputs, errors);
+
+  // the collecting call and all the waiting calls see the error
+  for (std::size_t i = 0; i < nCallers; ++i) {
+    BOOST_REQUIRE(errors[i]);
+    BOOST_CHECK_THROW(std::rethrow_exception(errors[i]), std::runtime_error);
+    BOOST_CHECK(outputs[i].empty());
+  }
+
+  // the coalescer is still usable after a failed batch
+  fail = false;
+  runConcurrently(coalescer, inputs, outputs, errors);
+  for (std::size_t i = 0; i < nCallers; ++i) {
+    BOOST_CHECK(!errors[i]);
+    checkOutput(outputs[i], inputs[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchCoalescerMismatchedFeatures) {
+  std::vector<BatchCoalescer::Input> inputs = {makeInput(0, 2, 3),
+                                               makeInput(1, 2, 4)};
+
+  BatchCoalescer::Config cfg;
+  cfg.window = 60s;
+  cfg.maxBatchRows = 4;
+  BatchCoalescer coalescer(cfg, summarize);
+
+  std::vector<BatchCoalescer::Output> outputs;
+  std::vector<std::exception_ptr> errors;
+  runConcurrently(coalescer, inputs, outputs, errors);
+
+  for (const auto& error : errors) {
+    BOOST_REQUIRE(error);
+    BOOST_CHECK_THROW(std::rethrow_exception(error), std::invalid_argument);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchCoalescerBufferRecycling) {
+  BatchCoalescer::Config cfg;
+  cfg.window = 1ms;
+  std::vector<const float*> buffers;
+  BatchCoalescer coalescer(cfg, [&](Eigen::Map<BatchCoalescer::Input> input) {
+    buffers.push_back(input.data());
+    return summarize(input);
+  });
+
+  // the consecutive batches reuse the buffer of the first one as long as
+  // they fit into it
+  auto input = makeInput(0, 16);
+  checkOutput(coalescer.run(input), input);
+  auto smaller = makeInput(1, 4);
+  checkOutput(coalescer.run(smaller), smaller);
+  checkOutput(coalescer.run(input), input);
+
+  BOOST_REQUIRE_EQUAL(buffers.size(), 3u);
+  BOOST_CHECK_EQUAL(buffers[0], buffers[1]);
+  BOOST_CHECK_EQUAL(buffers[0], buffers[2]);
+  // the input is copied into the batch buffer
+  BOOST_CHECK_NE(buffers[0], input.data());
+}
+
+BOOST_AUTO_TEST_SUITE_END()